@@ -143,7 +143,7 @@ void feVector<T>::computeVec(const VECType* in,VECType* out,double scale)
 
     const ot::Mesh * pMesh = m_uiOctDA->getMesh();
     const unsigned int nPe = pMesh->getNumNodesPerElement();
-    double * qMat = new double[nPe*nPe];
+    double * qTOut = new double[nPe];
     const unsigned int * e2n_cg = &(*(pMesh->getE2NMapping().begin()));
     const ot::TreeNode* allElements = &(*(pMesh->getAllElements().begin()));
     
@@ -153,18 +153,12 @@ void feVector<T>::computeVec(const VECType* in,VECType* out,double scale)
 
         m_uiOctDA->getElementNodalValues(_in, m_uiEleVecIn, m_uiOctDA->curr(), m_uiDof);
         const unsigned int currentId = m_uiOctDA->curr();
-        pMesh->getElementQMat(m_uiOctDA->curr(),qMat,true);
         m_uiOctDA->getElementalCoords(m_uiOctDA->curr(), m_uiEleCoords);
         elementalComputVec(m_uiEleVecIn, m_uiEleVecOut, m_uiEleCoords, scale);
         for (unsigned int dof = 0; dof < m_uiDof; dof++) {
-          for (unsigned int i = 0; i < nPe; i++) {
-            VECType ss = (VECType) 0;
-            for (unsigned int j = 0; j < nPe; j++) {
-              ss += qMat[j * nPe + i] * m_uiEleVecOut[dof*nPe + j];
-            }
-            _out[dof*totalNodalSize + e2n_cg[currentId * nPe + i]] += (VECType) ss;
-
-          }
+          pMesh->applyElementQTMat(currentId,&m_uiEleVecOut[dof*nPe],qTOut);
+          for (unsigned int i = 0; i < nPe; i++)
+            _out[dof*totalNodalSize + e2n_cg[currentId * nPe + i]] += (VECType) qTOut[i];
         }
 
     }
@@ -182,25 +176,19 @@ void feVector<T>::computeVec(const VECType* in,VECType* out,double scale)
 
         m_uiOctDA->getElementNodalValues(_in, m_uiEleVecIn, m_uiOctDA->curr(), m_uiDof);
         const unsigned int currentId = m_uiOctDA->curr();
-        pMesh->getElementQMat(m_uiOctDA->curr(),qMat,true);
         m_uiOctDA->getElementalCoords(m_uiOctDA->curr(), m_uiEleCoords);
         elementalComputVec(m_uiEleVecIn, m_uiEleVecOut, m_uiEleCoords, scale);
 
         for (unsigned int dof = 0; dof < m_uiDof; dof++) {
-          for (unsigned int i = 0; i < nPe; i++) {
-            VECType ss = (VECType) 0;
-            for (unsigned int j = 0; j < nPe; j++) {
-              ss += qMat[j * nPe + i] * m_uiEleVecOut[dof*nPe + j];
-            }
-            _out[dof*totalNodalSize + e2n_cg[currentId * nPe + i]] += (VECType) ss;
-
-          }
+          pMesh->applyElementQTMat(currentId,&m_uiEleVecOut[dof*nPe],qTOut);
+          for (unsigned int i = 0; i < nPe; i++)
+            _out[dof*totalNodalSize + e2n_cg[currentId * nPe + i]] += (VECType) qTOut[i];
         }
 
     }
 
 
-    delete [] qMat;
+    delete [] qTOut;
 
     m_uiOctDA->writeToGhostsBegin(_out,m_uiDof);
     m_uiOctDA->writeToGhostsEnd(_out,ot::DA_FLAGS::WriteMode::ADD_VALUES,m_uiDof);
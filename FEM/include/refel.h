@@ -26,6 +26,7 @@
 #include <assert.h>
 #include "interpMatrices.h"
 #include "binUtils.h"
+#include <omp.h>
 
 template<typename T>
 void dump_binary(const T* in, unsigned int n, const char* fPrefix)
@@ -84,6 +85,9 @@ private :
     /** reference element volume */
     unsigned int m_uiVol;
 
+    /** number of per thread slots in the interpolation scratch (im_vec1, im_vec2, out_p2c) */
+    unsigned int m_uiNumScratch;
+
     /** 1D reference coordinates of the interpolation nodes (uniform nodal points) */
     std::vector<double> u;
 
@@ -158,10 +162,10 @@ private :
     /**Vandermonde matrix for interpolation points of child 1   */
     std::vector<double> Vu_1;
 
-    /**intermidiate vec 1 needed during interploation */
+    /**intermidiate vec 1 needed during interploation (one slot of m_uiNp per thread) */
     std::vector<double> im_vec1;
 
-    /**intermidiate vec 1 needed during interploation */
+    /**intermidiate vec 2 needed during interploation (one slot of m_uiNp per thread) */
     std::vector<double> im_vec2;
 
     /**filter matrix for to cutoff high frequency terms. */
@@ -170,9 +174,17 @@ private :
     /**@brief unzip intergrid transwer*/
     std::vector<double> gridT;
 
-    /**@brief unzip intergrid transwer out*/
+    /**@brief unzip intergrid transwer out (one slot per thread)*/
     std::vector<double> out_p2c;
 
+    /**
+     * @brief scratch slot of the calling thread in v, so that the interpolations can run concurrently (e.g. block unzips in parallel tasks).
+     * @param[in] v: per thread scratch (m_uiNumScratch slots of n)
+     * @param[in] n: slot size
+     * @param[out] spill: used when the thread has no slot (nested active teams, or more threads than at construction)
+     */
+    double * getThreadScratch(const std::vector<double>& v, unsigned int n, std::vector<double>& spill) const;
+
     
     
 
@@ -221,6 +233,7 @@ public:
     
     inline const double * getFr1D() const {return &(*(Fr.begin()));}
 
+    /**@brief: intermediate vectors (slot of thread 0) */
     inline double * getImVec1() {return &(*(im_vec1.begin()));}
     inline double * getImVec2() {return &(*(im_vec2.begin()));}
 
@@ -243,8 +256,9 @@ public:
     inline void I3D_Parent2Child(const double * in, double* out, unsigned int childNum ) const
     {
 
-         double * im1=(double *)&(*(im_vec1.begin()));
-         double * im2=(double *)&(*(im_vec2.begin()));
+         std::vector<double> spill1, spill2;
+         double * im1=getThreadScratch(im_vec1,m_uiNp,spill1);
+         double * im2=getThreadScratch(im_vec2,m_uiNp,spill2);
 
         switch (childNum)
         {
@@ -339,7 +353,8 @@ public:
         // const double c[fd_1d] = {-1/16.0 , 9/16.0,9/16.0, -1/16.0};
 
         // replacement array for p2c resolution.
-        double * out_p = (double *)&(*(out_p2c.begin()));
+        std::vector<double> spill;
+        double * out_p = getThreadScratch(out_p2c,out_p2c.size()/m_uiNumScratch,spill);
         
 
         for(unsigned int k=0; k < sz_p[2]; k++)
@@ -414,8 +429,9 @@ public:
 
     inline void I3D_Child2Parent(const double * in, double* out, unsigned int childNum ) const
     {
-        double * im1=(double *)&(*(im_vec1.begin()));
-        double * im2=(double *)&(*(im_vec2.begin()));
+        std::vector<double> spill1, spill2;
+        double * im1=getThreadScratch(im_vec1,m_uiNp,spill1);
+        double * im2=getThreadScratch(im_vec2,m_uiNp,spill2);
 
         switch (childNum)
         {
@@ -483,8 +499,9 @@ public:
     {
 
 
-         double * im1=(double *)&(*(im_vec1.begin()));
-         double * im2=(double *)&(*(im_vec2.begin()));
+         std::vector<double> spill1, spill2;
+         double * im1=getThreadScratch(im_vec1,m_uiNp,spill1);
+         double * im2=getThreadScratch(im_vec2,m_uiNp,spill2);
 
 
 
@@ -528,8 +545,9 @@ public:
     {
 
 
-        double * im1=(double *)&(*(im_vec1.begin()));
-        double * im2=(double *)&(*(im_vec2.begin()));
+        std::vector<double> spill1, spill2;
+        double * im1=getThreadScratch(im_vec1,m_uiNp,spill1);
+        double * im2=getThreadScratch(im_vec2,m_uiNp,spill2);
 
         switch (childNum)
         {
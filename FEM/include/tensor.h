@@ -87,4 +87,118 @@ void DENDRO_TENSOR_IAX_APPLY_ELEM_2D(const int M, const double*  A, const double
 void DENDRO_TENSOR_AIX_APPLY_ELEM_2D (const int M, const double*  A, const double*  X, double*  Y);
 
 
+/**
+ * @brief compile time 1D point count specializations of the above tensor kernels. Trip counts are known at compile time,
+ * so the inner loops are fully unrolled and the contiguous (fastest varying) loop is vectorized with omp simd. The runtime
+ * versions above dispatch to these for M in [DENDRO_TENSOR_MIN_SPECIALIZED_NRP, DENDRO_TENSOR_MAX_SPECIALIZED_NRP] and fall
+ * back to the generic loops otherwise.
+ * */
+#define DENDRO_TENSOR_MIN_SPECIALIZED_NRP 2
+#define DENDRO_TENSOR_MAX_SPECIALIZED_NRP 9
+
+/**@brief Along the Z axis (compile time M)*/
+template<int M>
+inline void DENDRO_TENSOR_AIIX_APPLY_ELEM_T(const double*  A, const double*  X, double*  Y)
+{
+    for (int i = 0; i < M; ++i) {
+        double * y = Y + i * M * M;
+        const double d = A[i];
+        #pragma omp simd
+        for (int j = 0; j < M * M; ++j)
+            y[j] = d * X[j];
+
+        for (int k = 1; k < M; ++k) {
+            const double e = A[i + k * M];
+            const double * x = X + M * M * k;
+            #pragma omp simd
+            for (int j = 0; j < M * M; ++j)
+                y[j] += e * x[j];
+        }
+    }
+}
+
+/**@brief Along the X axis (compile time M)*/
+template<int M>
+inline void DENDRO_TENSOR_IIAX_APPLY_ELEM_T(const double*  A, const double*  X, double*  Y)
+{
+    for (int i = 0; i < M * M; ++i) {
+        const double * x = X + i * M;
+        double * y = Y + i * M;
+        #pragma omp simd
+        for (int j = 0; j < M; ++j)
+            y[j] = x[0] * A[j];
+
+        for (int k = 1; k < M; ++k) {
+            const double e = x[k];
+            #pragma omp simd
+            for (int j = 0; j < M; ++j)
+                y[j] += e * A[k * M + j];
+        }
+    }
+}
+
+/**@brief Along the Y axis (compile time M)*/
+template<int M>
+inline void DENDRO_TENSOR_IAIX_APPLY_ELEM_T(const double*  A, const double*  X, double*  Y)
+{
+    for (int ib = 0; ib < M; ++ib) {
+        const double * x = X + ib * M * M;
+        for (int i = 0; i < M; ++i) {
+            double * y = Y + ib * M * M + i * M;
+            const double d = A[i];
+            #pragma omp simd
+            for (int j = 0; j < M; ++j)
+                y[j] = d * x[j];
+
+            for (int k = 1; k < M; ++k) {
+                const double e = A[i + k * M];
+                #pragma omp simd
+                for (int j = 0; j < M; ++j)
+                    y[j] += e * x[M * k + j];
+            }
+        }
+    }
+}
+
+/**@brief Along the X axis for 2D face interpolations (compile time M)*/
+template<int M>
+inline void DENDRO_TENSOR_IAX_APPLY_ELEM_2D_T(const double*  A, const double*  X, double*  Y)
+{
+    for (int i = 0; i < M; ++i) {
+        const double * x = X + i * M;
+        double * y = Y + i * M;
+        #pragma omp simd
+        for (int j = 0; j < M; ++j)
+            y[j] = x[0] * A[j];
+
+        for (int k = 1; k < M; ++k) {
+            const double e = x[k];
+            #pragma omp simd
+            for (int j = 0; j < M; ++j)
+                y[j] += e * A[k * M + j];
+        }
+    }
+}
+
+/**@brief Along the Y axis for 2D face interpolations (compile time M)*/
+template<int M>
+inline void DENDRO_TENSOR_AIX_APPLY_ELEM_2D_T(const double*  A, const double*  X, double*  Y)
+{
+    for (int i = 0; i < M; ++i) {
+        double * y = Y + i * M;
+        const double d = A[i];
+        #pragma omp simd
+        for (int j = 0; j < M; ++j)
+            y[j] = d * X[j];
+
+        for (int k = 1; k < M; ++k) {
+            const double e = A[i + k * M];
+            #pragma omp simd
+            for (int j = 0; j < M; ++j)
+                y[j] += e * X[M * k + j];
+        }
+    }
+}
+
+
 #endif //SFCSORTBENCH_DENDROTENSOR_H
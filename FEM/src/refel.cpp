@@ -15,6 +15,7 @@
 
 RefElement::RefElement()// default constructor
 {
+    m_uiNumScratch=1;
 
 }
 
@@ -69,8 +70,10 @@ RefElement::RefElement(unsigned int dim, unsigned int order)
     Dg.resize(m_uiNrp*m_uiNrp);
     DgT.resize(m_uiNrp*m_uiNrp);
 
-    im_vec1.resize(m_uiNp); // resize intermidiate values for number of points in 1D case.
-    im_vec2.resize(m_uiNp); // resize intermidiate values for number of points in 1D case.
+    // one slot per thread, so that the interpolations can be called from concurrent tasks.
+    m_uiNumScratch = omp_get_max_threads();
+    im_vec1.resize(m_uiNp*m_uiNumScratch); // resize intermidiate values for number of points in 1D case.
+    im_vec2.resize(m_uiNp*m_uiNumScratch); // resize intermidiate values for number of points in 1D case.
 
     ipT_1D_0.resize(m_uiNrp*m_uiNrp);
     ipT_1D_1.resize(m_uiNrp*m_uiNrp);
@@ -82,7 +85,7 @@ RefElement::RefElement(unsigned int dim, unsigned int order)
      gridT[i] = IP_1D_FD_Order_5[i];
 
     const unsigned int p2c_sz=21*21*21;
-    out_p2c.resize(p2c_sz,0);
+    out_p2c.resize(p2c_sz*m_uiNumScratch,0);
 
 
     #ifdef WITH_BLAS_LAPACK
@@ -310,6 +313,35 @@ RefElement::~RefElement() {
 }
 
 
+double * RefElement::getThreadScratch(const std::vector<double>& v, unsigned int n, std::vector<double>& spill) const
+{
+    // slot of the thread in the (only) active team, threads of nested active teams use the spill buffer.
+    const int level = omp_get_level();
+    int tid = 0;
+    bool isActive = false;
+    for(int l=1; l <= level; l++)
+    {
+        if(omp_get_team_size(l) > 1)
+        {
+            if(isActive)
+            {
+                tid = -1;
+                break;
+            }
+            isActive = true;
+            tid = omp_get_ancestor_thread_num(l);
+        }
+    }
+
+    if(tid < 0 || ((size_t)tid+1)*n > v.size())
+    {
+        spill.resize(n,0);
+        return spill.data();
+    }
+
+    return (double *)v.data() + (size_t)tid*n;
+}
+
 void RefElement::generateHeaderFile(char * fName)
 {
 
@@ -17,6 +17,18 @@
  * Along the Z axis
  * */
 void DENDRO_TENSOR_AIIX_APPLY_ELEM (const int M, const double*  A, const double*  X, double*  Y) {
+    switch (M) {
+        case 2: DENDRO_TENSOR_AIIX_APPLY_ELEM_T<2>(A, X, Y); return;
+        case 3: DENDRO_TENSOR_AIIX_APPLY_ELEM_T<3>(A, X, Y); return;
+        case 4: DENDRO_TENSOR_AIIX_APPLY_ELEM_T<4>(A, X, Y); return;
+        case 5: DENDRO_TENSOR_AIIX_APPLY_ELEM_T<5>(A, X, Y); return;
+        case 6: DENDRO_TENSOR_AIIX_APPLY_ELEM_T<6>(A, X, Y); return;
+        case 7: DENDRO_TENSOR_AIIX_APPLY_ELEM_T<7>(A, X, Y); return;
+        case 8: DENDRO_TENSOR_AIIX_APPLY_ELEM_T<8>(A, X, Y); return;
+        case 9: DENDRO_TENSOR_AIIX_APPLY_ELEM_T<9>(A, X, Y); return;
+        default: break;
+    }
+
     int i, j, k;
     double d, e;
     for (i = 0; i < M; ++i) {
@@ -40,6 +52,18 @@ void DENDRO_TENSOR_AIIX_APPLY_ELEM (const int M, const double*  A, const double*
 
 void DENDRO_TENSOR_IIAX_APPLY_ELEM(const int M, const double*  A, const double*  X, double*  Y)
 {
+    switch (M) {
+        case 2: DENDRO_TENSOR_IIAX_APPLY_ELEM_T<2>(A, X, Y); return;
+        case 3: DENDRO_TENSOR_IIAX_APPLY_ELEM_T<3>(A, X, Y); return;
+        case 4: DENDRO_TENSOR_IIAX_APPLY_ELEM_T<4>(A, X, Y); return;
+        case 5: DENDRO_TENSOR_IIAX_APPLY_ELEM_T<5>(A, X, Y); return;
+        case 6: DENDRO_TENSOR_IIAX_APPLY_ELEM_T<6>(A, X, Y); return;
+        case 7: DENDRO_TENSOR_IIAX_APPLY_ELEM_T<7>(A, X, Y); return;
+        case 8: DENDRO_TENSOR_IIAX_APPLY_ELEM_T<8>(A, X, Y); return;
+        case 9: DENDRO_TENSOR_IIAX_APPLY_ELEM_T<9>(A, X, Y); return;
+        default: break;
+    }
+
 
 
     int i, j, k;
@@ -64,6 +88,18 @@ void DENDRO_TENSOR_IIAX_APPLY_ELEM(const int M, const double*  A, const double*
 
 void DENDRO_TENSOR_IAX_APPLY_ELEM_2D(const int M, const double*  A, const double*  X, double*  Y)
 {
+    switch (M) {
+        case 2: DENDRO_TENSOR_IAX_APPLY_ELEM_2D_T<2>(A, X, Y); return;
+        case 3: DENDRO_TENSOR_IAX_APPLY_ELEM_2D_T<3>(A, X, Y); return;
+        case 4: DENDRO_TENSOR_IAX_APPLY_ELEM_2D_T<4>(A, X, Y); return;
+        case 5: DENDRO_TENSOR_IAX_APPLY_ELEM_2D_T<5>(A, X, Y); return;
+        case 6: DENDRO_TENSOR_IAX_APPLY_ELEM_2D_T<6>(A, X, Y); return;
+        case 7: DENDRO_TENSOR_IAX_APPLY_ELEM_2D_T<7>(A, X, Y); return;
+        case 8: DENDRO_TENSOR_IAX_APPLY_ELEM_2D_T<8>(A, X, Y); return;
+        case 9: DENDRO_TENSOR_IAX_APPLY_ELEM_2D_T<9>(A, X, Y); return;
+        default: break;
+    }
+
     int i, j, k;
     double e;
     for (i = 0; i < M; i++) {
@@ -86,6 +122,18 @@ void DENDRO_TENSOR_IAX_APPLY_ELEM_2D(const int M, const double*  A, const double
  * */
 void DENDRO_TENSOR_IAIX_APPLY_ELEM (const int M, const double*  A, const double*  X, double*  Y)
 {
+    switch (M) {
+        case 2: DENDRO_TENSOR_IAIX_APPLY_ELEM_T<2>(A, X, Y); return;
+        case 3: DENDRO_TENSOR_IAIX_APPLY_ELEM_T<3>(A, X, Y); return;
+        case 4: DENDRO_TENSOR_IAIX_APPLY_ELEM_T<4>(A, X, Y); return;
+        case 5: DENDRO_TENSOR_IAIX_APPLY_ELEM_T<5>(A, X, Y); return;
+        case 6: DENDRO_TENSOR_IAIX_APPLY_ELEM_T<6>(A, X, Y); return;
+        case 7: DENDRO_TENSOR_IAIX_APPLY_ELEM_T<7>(A, X, Y); return;
+        case 8: DENDRO_TENSOR_IAIX_APPLY_ELEM_T<8>(A, X, Y); return;
+        case 9: DENDRO_TENSOR_IAIX_APPLY_ELEM_T<9>(A, X, Y); return;
+        default: break;
+    }
+
     int i, j, k, ib;
     double d, e;
     for (ib = 0; ib < M; ++ib) {
@@ -111,6 +159,18 @@ void DENDRO_TENSOR_IAIX_APPLY_ELEM (const int M, const double*  A, const double*
  * */
 void DENDRO_TENSOR_AIX_APPLY_ELEM_2D (const int M, const double*  A, const double*  X, double*  Y)
 {
+    switch (M) {
+        case 2: DENDRO_TENSOR_AIX_APPLY_ELEM_2D_T<2>(A, X, Y); return;
+        case 3: DENDRO_TENSOR_AIX_APPLY_ELEM_2D_T<3>(A, X, Y); return;
+        case 4: DENDRO_TENSOR_AIX_APPLY_ELEM_2D_T<4>(A, X, Y); return;
+        case 5: DENDRO_TENSOR_AIX_APPLY_ELEM_2D_T<5>(A, X, Y); return;
+        case 6: DENDRO_TENSOR_AIX_APPLY_ELEM_2D_T<6>(A, X, Y); return;
+        case 7: DENDRO_TENSOR_AIX_APPLY_ELEM_2D_T<7>(A, X, Y); return;
+        case 8: DENDRO_TENSOR_AIX_APPLY_ELEM_2D_T<8>(A, X, Y); return;
+        case 9: DENDRO_TENSOR_AIX_APPLY_ELEM_2D_T<9>(A, X, Y); return;
+        default: break;
+    }
+
     int i, j, k, ib=0;
     double d, e;
     //for (ib = 0; ib < M; ++ib) {
@@ -33,25 +33,25 @@ namespace massgrav
 
         protected:
             /**@brief: evolution var (zip)*/
-            DVec m_uiEVar;
+            DVecView m_uiEVar;
             
             /**@brief: evolution var tmp (zip)*/
-            DVec m_uiETmp;
+            DVecView m_uiETmp;
             
             /**@brief: constraint var (zip)*/    
-            DVec m_uiCVar;
+            DVecView m_uiCVar;
 
             /**@brief: primitive var (zip)*/
-            DVec m_uiPVar;
+            DVecView m_uiPVar;
 
             /**@brief: Evolution var unzip 0 - unzip in , 1 - unzip out */
-            DVec m_uiEUnzip[2];
+            DVecView m_uiEUnzip[2];
             
             /**@brief: Constraint var unzip 0 - unzip in , 1 - unzip out */
-            DVec m_uiCUnzip[2];
+            DVecView m_uiCUnzip[2];
 
             /**@brief: Primitive var unzip 0 - unzip in , 1 - unzip out */
-            DVec m_uiPUnzip[2];
+            DVecView m_uiPUnzip[2];
 
             /**@brief: extracted BH locations*/
             Point m_uiBHLoc[2];
@@ -76,7 +76,7 @@ namespace massgrav
              * @param time : current time. 
              * @return int : status. (0) on success. 
              */
-            virtual int rhs(DVec* in , DVec* out, unsigned int sz , DendroScalar time);
+            virtual int rhs(DVecView* in , DVecView* out, unsigned int sz , DendroScalar time);
 
              /**
              * @brief block wise RHS. 
@@ -88,25 +88,28 @@ namespace massgrav
              * @param blk_time : block time  corresponding to the block ids. 
              * @return int 
              */
-            virtual int rhs_blkwise(DVec in, DVec out, const unsigned int* const blkIDs, unsigned int numIds, DendroScalar*  blk_time) const;
+            virtual int rhs_blkwise(DVecView in, DVecView out, const unsigned int* const blkIDs, unsigned int numIds, DendroScalar*  blk_time) const;
 
             virtual int rhs_blk(const DendroScalar* in, DendroScalar* out, unsigned int dof ,unsigned int local_blk_id, DendroScalar  blk_time) const ;
+
+            /**@brief: the block kernel only uses local (pool) scratch, hence blocks can run concurrently. */
+            virtual bool is_rhs_blk_thread_safe() const {return true;}
             
             /**@brief: function execute before each stage
              * @param sIn: stage var in. 
             */
-            virtual int pre_stage(DVec sIn); 
+            virtual int pre_stage(DVecView sIn); 
 
             /**@brief: function execute after each stage
              * @param sIn: stage var in. 
             */
-            virtual int post_stage(DVec sIn);
+            virtual int post_stage(DVecView sIn);
 
             /**@brief: function execute before each step*/
-            virtual int pre_timestep(DVec sIn); 
+            virtual int pre_timestep(DVecView sIn); 
 
             /**@brief: function execute after each step*/
-            virtual int post_timestep(DVec sIn);
+            virtual int post_timestep(DVecView sIn);
 
             /**@brief: function execute after each step*/
             virtual bool is_remesh();
@@ -124,13 +127,13 @@ namespace massgrav
             virtual int finalize();
 
             /**@brief: pack and returns the evolution variables to one DVector*/
-            virtual DVec get_evolution_vars();
+            virtual DVecView get_evolution_vars();
 
             /**@brief: pack and returns the constraint variables to one DVector*/
-            virtual DVec get_constraint_vars();
+            virtual DVecView get_constraint_vars();
 
             /**@brief: pack and returns the primitive variables to one DVector*/
-            virtual DVec get_primitive_vars();
+            virtual DVecView get_primitive_vars();
 
             /**@brief: updates the application variables from the variable list. */
             virtual int update_app_vars();
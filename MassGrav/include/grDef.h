@@ -21,8 +21,11 @@
 #define Y_TO_GRIDY(yc) (((RgY/Ry)*(yc-massgrav::MASSGRAV_COMPD_MIN[1]))+massgrav::MASSGRAV_OCTREE_MIN[1])
 #define Z_TO_GRIDZ(zc) (((RgZ/Rz)*(zc-massgrav::MASSGRAV_COMPD_MIN[2]))+massgrav::MASSGRAV_OCTREE_MIN[2])
 
-// type of the rk method.
-enum RKType{RK3,RK4,RK45};
+// type of the rk method. (LSRK3, LSRK4 : low storage methods, BS32, DP54 : adaptive embedded pairs, only with the ETS time stepper)
+enum RKType{RK3,RK4,RK45,LSRK3,LSRK4,BS32,DP54};
+
+// smallest step size of the adaptive (BS32, DP54) methods as a fraction of the CFL step size, a step rejected at this size aborts the run. 
+#define MASSGRAV_RK_ADAP_DT_MIN_FAC 1e-4
 
 
 namespace massgrav
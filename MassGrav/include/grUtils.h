@@ -168,8 +168,35 @@ double interpolation4 ( double xp[], double yp[], int np, double xb,
    void artificial_dissipation(ot::Mesh * pMesh , T** zipVars, unsigned int numVars, unsigned int nc, unsigned int s,bool isGhostEx=false);
 
 
+   /**
+    * @brief partition weight of an octant. If measured costs are available (see setupOctantWeights) returns the measured 
+    * cost per element of the octant level and cell, scaled by the mean, otherwise the octant level. The weight only depends on 
+    * the octant (not on the rank holding it). 
+    * @param[in] pNode: octant
+    */
    unsigned int getOctantWeight(const ot::TreeNode* pNode);
 
+   /**
+    * @brief records the measured rhs wall time of a block, accumulated per element level and coarse cell until the next 
+    * remesh. Thread safe. 
+    * @param[in] blk: block the rhs was evaluated on
+    * @param[in] t: measured wall time (s)
+    */
+   void recordBlockCost(const ot::Block& blk, double t);
+
+   /**
+    * @brief clears the costs recorded since the last setupOctantWeights, should be called after remesh. 
+    */
+   void clearBlockCost();
+
+   /**
+    * @brief reduces the recorded costs over the ranks and updates the (replicated) cost table used by getOctantWeight, 
+    * exponentially smoothed (MASSGRAV_LOAD_COST_SMOOTHING) over the remesh intervals. Collective on the global communicator 
+    * of pMesh. 
+    * @param[in] pMesh: current mesh
+    */
+   void setupOctantWeights(const ot::Mesh* pMesh);
+
 
 
 
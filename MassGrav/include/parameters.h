@@ -119,6 +119,12 @@ namespace massgrav
     extern  double MASSGRAV_WAVELET_TOL;
     /**@brief load-imbalance tolerance value. */
     extern  double MASSGRAV_LOAD_IMB_TOL;
+    /**@brief if true, partition weights are computed from the measured (smoothed) rhs cost per element (off by default, measured weights make the partition non-deterministic). */
+    extern bool MASSGRAV_USE_MEASURED_LOAD;
+    /**@brief exponential smoothing factor for the measured cost over the remesh intervals (weight of the most recent interval). */
+    extern double MASSGRAV_LOAD_COST_SMOOTHING;
+    /**@brief partition used by the NUTS remesh. 0: measured / level weights, 1: rhs evaluations per coarse step, 2: balance each time level separately. */
+    extern unsigned int MASSGRAV_NUTS_PARTITION;
     /**@brief: Splitter fix value*/
     extern unsigned int MASSGRAV_SPLIT_FIX;
 
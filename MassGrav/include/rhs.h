@@ -10,6 +10,7 @@
 #include "grDef.h"
 #include "mathUtils.h"
 #include "block.h"
+#include "memory_pool.h"
 
 #ifdef MASSGRAV_ENABLE_CUDA
 #include "rhs_cuda.cuh"
@@ -17,6 +17,7 @@
 #include "oct2vtk.h"
 #include "checkPoint.h"
 #include "mesh.h"
+#include "fieldSet.h"
 #include <string>
 #include <iostream>
 #include "grUtils.h"
@@ -108,6 +109,22 @@ namespace ode
             /** @brief unzip physical constrint vars*/
             DendroScalar ** m_uiUnzipConstraintVars;
 
+            /**@brief storage of m_uiVar, m_uiPrevVar and m_uiVarIm (single aligned allocation for each)*/
+            ot::FieldSet<DendroScalar> m_uiVarFS;
+            ot::FieldSet<DendroScalar> m_uiPrevVarFS;
+            ot::FieldSet<DendroScalar> m_uiVarImFS;
+
+            /**@brief storage of all the rk stages, m_uiStage[s] points to the variables of stage s*/
+            ot::FieldSet<DendroScalar> m_uiStageFS;
+
+            /**@brief storage of the unzip variables and the unzip rhs*/
+            ot::FieldSet<DendroScalar> m_uiUnzipVarFS;
+            ot::FieldSet<DendroScalar> m_uiUnzipVarRHSFS;
+
+            /**@brief storage of the constraint variables*/
+            ot::FieldSet<DendroScalar> m_uiConstraintVarsFS;
+            ot::FieldSet<DendroScalar> m_uiUnzipConstraintVarsFS;
+
             /**Send node bufferes for async communication*/
             DendroScalar ** m_uiSendNodeBuf;
 
@@ -170,8 +187,13 @@ namespace ode
             /** @brief: perform ghost exchange for all vars*/
             void performGhostExchangeVars(DendroScalar** zipIn);
 
-            /**@brief: performs the intergrid transfer*/
-            void intergridTransferVars(DendroScalar **& zipIn, const ot::Mesh* pnewMesh, bool useUnzip);
+            /**@brief: (re)allocates the variables for pMesh, the storage is reallocated only if pMesh is larger than the capacity. 
+             * The content of a field set is preserved if its size does not change (i.e. transfered m_uiPrevVar)*/
+            void allocateVars(const ot::Mesh* pMesh);
+
+            /**@brief: performs the intergrid transfer of zipIn, zipOut is resized for the new mesh, holds the transfered vars 
+             * and then swapped with zipIn (the content of zipOut is destroyed)*/
+            void intergridTransferVars(ot::FieldSet<DendroScalar>& zipIn, ot::FieldSet<DendroScalar>& zipOut, const ot::Mesh* pnewMesh, bool useUnzip);
 
             /**@brief unzip all the vars specified in VARS*/
             void unzipVars(DendroScalar ** zipIn , DendroScalar **uzipOut);
@@ -1,138 +1,138 @@
-  free(grad_0_alpha);
-  free(grad_1_alpha);
-  free(grad_2_alpha);
-  free(grad_0_beta0);
-  free(grad_1_beta0);
-  free(grad_2_beta0);
-  free(grad_0_beta1);
-  free(grad_1_beta1);
-  free(grad_2_beta1);
-  free(grad_0_beta2);
-  free(grad_1_beta2);
-  free(grad_2_beta2);
-  free(grad_0_B0);
-  free(grad_1_B0);
-  free(grad_2_B0);
-  free(grad_0_B1);
-  free(grad_1_B1);
-  free(grad_2_B1);
-  free(grad_0_B2);
-  free(grad_1_B2);
-  free(grad_2_B2);
-  free(grad_0_chi);
-  free(grad_1_chi);
-  free(grad_2_chi);
-  free(grad_0_Gt0);
-  free(grad_1_Gt0);
-  free(grad_2_Gt0);
-  free(grad_0_Gt1);
-  free(grad_1_Gt1);
-  free(grad_2_Gt1);
-  free(grad_0_Gt2);
-  free(grad_1_Gt2);
-  free(grad_2_Gt2);
-  free(grad_0_K);
-  free(grad_1_K);
-  free(grad_2_K);
-  free(grad_0_gt0);
-  free(grad_1_gt0);
-  free(grad_2_gt0);
-  free(grad_0_gt1);
-  free(grad_1_gt1);
-  free(grad_2_gt1);
-  free(grad_0_gt2);
-  free(grad_1_gt2);
-  free(grad_2_gt2);
-  free(grad_0_gt3);
-  free(grad_1_gt3);
-  free(grad_2_gt3);
-  free(grad_0_gt4);
-  free(grad_1_gt4);
-  free(grad_2_gt4);
-  free(grad_0_gt5);
-  free(grad_1_gt5);
-  free(grad_2_gt5);
-  free(grad_0_At0);
-  free(grad_1_At0);
-  free(grad_2_At0);
-  free(grad_0_At1);
-  free(grad_1_At1);
-  free(grad_2_At1);
-  free(grad_0_At2);
-  free(grad_1_At2);
-  free(grad_2_At2);
-  free(grad_0_At3);
-  free(grad_1_At3);
-  free(grad_2_At3);
-  free(grad_0_At4);
-  free(grad_1_At4);
-  free(grad_2_At4);
-  free(grad_0_At5);
-  free(grad_1_At5);
-  free(grad_2_At5);
-  free(grad2_0_0_gt0);
-  free(grad2_0_1_gt0);
-  free(grad2_0_2_gt0);
-  free(grad2_1_1_gt0);
-  free(grad2_1_2_gt0);
-  free(grad2_2_2_gt0);
-  free(grad2_0_0_gt1);
-  free(grad2_0_1_gt1);
-  free(grad2_0_2_gt1);
-  free(grad2_1_1_gt1);
-  free(grad2_1_2_gt1);
-  free(grad2_2_2_gt1);
-  free(grad2_0_0_gt2);
-  free(grad2_0_1_gt2);
-  free(grad2_0_2_gt2);
-  free(grad2_1_1_gt2);
-  free(grad2_1_2_gt2);
-  free(grad2_2_2_gt2);
-  free(grad2_0_0_gt3);
-  free(grad2_0_1_gt3);
-  free(grad2_0_2_gt3);
-  free(grad2_1_1_gt3);
-  free(grad2_1_2_gt3);
-  free(grad2_2_2_gt3);
-  free(grad2_0_0_gt4);
-  free(grad2_0_1_gt4);
-  free(grad2_0_2_gt4);
-  free(grad2_1_1_gt4);
-  free(grad2_1_2_gt4);
-  free(grad2_2_2_gt4);
-  free(grad2_0_0_gt5);
-  free(grad2_0_1_gt5);
-  free(grad2_0_2_gt5);
-  free(grad2_1_1_gt5);
-  free(grad2_1_2_gt5);
-  free(grad2_2_2_gt5);
-  free(grad2_0_0_chi);
-  free(grad2_0_1_chi);
-  free(grad2_0_2_chi);
-  free(grad2_1_1_chi);
-  free(grad2_1_2_chi);
-  free(grad2_2_2_chi);
-  free(grad2_0_0_alpha);
-  free(grad2_0_1_alpha);
-  free(grad2_0_2_alpha);
-  free(grad2_1_1_alpha);
-  free(grad2_1_2_alpha);
-  free(grad2_2_2_alpha);
-  free(grad2_0_0_beta0);
-  free(grad2_0_1_beta0);
-  free(grad2_0_2_beta0);
-  free(grad2_1_1_beta0);
-  free(grad2_1_2_beta0);
-  free(grad2_2_2_beta0);
-  free(grad2_0_0_beta1);
-  free(grad2_0_1_beta1);
-  free(grad2_0_2_beta1);
-  free(grad2_1_1_beta1);
-  free(grad2_1_2_beta1);
-  free(grad2_2_2_beta1);
-  free(grad2_0_0_beta2);
-  free(grad2_0_1_beta2);
-  free(grad2_0_2_beta2);
-  free(grad2_1_1_beta2);
-  free(grad2_1_2_beta2);
-  free(grad2_2_2_beta2);
+  mem::get_pool()->free(grad_0_alpha);
+  mem::get_pool()->free(grad_1_alpha);
+  mem::get_pool()->free(grad_2_alpha);
+  mem::get_pool()->free(grad_0_beta0);
+  mem::get_pool()->free(grad_1_beta0);
+  mem::get_pool()->free(grad_2_beta0);
+  mem::get_pool()->free(grad_0_beta1);
+  mem::get_pool()->free(grad_1_beta1);
+  mem::get_pool()->free(grad_2_beta1);
+  mem::get_pool()->free(grad_0_beta2);
+  mem::get_pool()->free(grad_1_beta2);
+  mem::get_pool()->free(grad_2_beta2);
+  mem::get_pool()->free(grad_0_B0);
+  mem::get_pool()->free(grad_1_B0);
+  mem::get_pool()->free(grad_2_B0);
+  mem::get_pool()->free(grad_0_B1);
+  mem::get_pool()->free(grad_1_B1);
+  mem::get_pool()->free(grad_2_B1);
+  mem::get_pool()->free(grad_0_B2);
+  mem::get_pool()->free(grad_1_B2);
+  mem::get_pool()->free(grad_2_B2);
+  mem::get_pool()->free(grad_0_chi);
+  mem::get_pool()->free(grad_1_chi);
+  mem::get_pool()->free(grad_2_chi);
+  mem::get_pool()->free(grad_0_Gt0);
+  mem::get_pool()->free(grad_1_Gt0);
+  mem::get_pool()->free(grad_2_Gt0);
+  mem::get_pool()->free(grad_0_Gt1);
+  mem::get_pool()->free(grad_1_Gt1);
+  mem::get_pool()->free(grad_2_Gt1);
+  mem::get_pool()->free(grad_0_Gt2);
+  mem::get_pool()->free(grad_1_Gt2);
+  mem::get_pool()->free(grad_2_Gt2);
+  mem::get_pool()->free(grad_0_K);
+  mem::get_pool()->free(grad_1_K);
+  mem::get_pool()->free(grad_2_K);
+  mem::get_pool()->free(grad_0_gt0);
+  mem::get_pool()->free(grad_1_gt0);
+  mem::get_pool()->free(grad_2_gt0);
+  mem::get_pool()->free(grad_0_gt1);
+  mem::get_pool()->free(grad_1_gt1);
+  mem::get_pool()->free(grad_2_gt1);
+  mem::get_pool()->free(grad_0_gt2);
+  mem::get_pool()->free(grad_1_gt2);
+  mem::get_pool()->free(grad_2_gt2);
+  mem::get_pool()->free(grad_0_gt3);
+  mem::get_pool()->free(grad_1_gt3);
+  mem::get_pool()->free(grad_2_gt3);
+  mem::get_pool()->free(grad_0_gt4);
+  mem::get_pool()->free(grad_1_gt4);
+  mem::get_pool()->free(grad_2_gt4);
+  mem::get_pool()->free(grad_0_gt5);
+  mem::get_pool()->free(grad_1_gt5);
+  mem::get_pool()->free(grad_2_gt5);
+  mem::get_pool()->free(grad_0_At0);
+  mem::get_pool()->free(grad_1_At0);
+  mem::get_pool()->free(grad_2_At0);
+  mem::get_pool()->free(grad_0_At1);
+  mem::get_pool()->free(grad_1_At1);
+  mem::get_pool()->free(grad_2_At1);
+  mem::get_pool()->free(grad_0_At2);
+  mem::get_pool()->free(grad_1_At2);
+  mem::get_pool()->free(grad_2_At2);
+  mem::get_pool()->free(grad_0_At3);
+  mem::get_pool()->free(grad_1_At3);
+  mem::get_pool()->free(grad_2_At3);
+  mem::get_pool()->free(grad_0_At4);
+  mem::get_pool()->free(grad_1_At4);
+  mem::get_pool()->free(grad_2_At4);
+  mem::get_pool()->free(grad_0_At5);
+  mem::get_pool()->free(grad_1_At5);
+  mem::get_pool()->free(grad_2_At5);
+  mem::get_pool()->free(grad2_0_0_gt0);
+  mem::get_pool()->free(grad2_0_1_gt0);
+  mem::get_pool()->free(grad2_0_2_gt0);
+  mem::get_pool()->free(grad2_1_1_gt0);
+  mem::get_pool()->free(grad2_1_2_gt0);
+  mem::get_pool()->free(grad2_2_2_gt0);
+  mem::get_pool()->free(grad2_0_0_gt1);
+  mem::get_pool()->free(grad2_0_1_gt1);
+  mem::get_pool()->free(grad2_0_2_gt1);
+  mem::get_pool()->free(grad2_1_1_gt1);
+  mem::get_pool()->free(grad2_1_2_gt1);
+  mem::get_pool()->free(grad2_2_2_gt1);
+  mem::get_pool()->free(grad2_0_0_gt2);
+  mem::get_pool()->free(grad2_0_1_gt2);
+  mem::get_pool()->free(grad2_0_2_gt2);
+  mem::get_pool()->free(grad2_1_1_gt2);
+  mem::get_pool()->free(grad2_1_2_gt2);
+  mem::get_pool()->free(grad2_2_2_gt2);
+  mem::get_pool()->free(grad2_0_0_gt3);
+  mem::get_pool()->free(grad2_0_1_gt3);
+  mem::get_pool()->free(grad2_0_2_gt3);
+  mem::get_pool()->free(grad2_1_1_gt3);
+  mem::get_pool()->free(grad2_1_2_gt3);
+  mem::get_pool()->free(grad2_2_2_gt3);
+  mem::get_pool()->free(grad2_0_0_gt4);
+  mem::get_pool()->free(grad2_0_1_gt4);
+  mem::get_pool()->free(grad2_0_2_gt4);
+  mem::get_pool()->free(grad2_1_1_gt4);
+  mem::get_pool()->free(grad2_1_2_gt4);
+  mem::get_pool()->free(grad2_2_2_gt4);
+  mem::get_pool()->free(grad2_0_0_gt5);
+  mem::get_pool()->free(grad2_0_1_gt5);
+  mem::get_pool()->free(grad2_0_2_gt5);
+  mem::get_pool()->free(grad2_1_1_gt5);
+  mem::get_pool()->free(grad2_1_2_gt5);
+  mem::get_pool()->free(grad2_2_2_gt5);
+  mem::get_pool()->free(grad2_0_0_chi);
+  mem::get_pool()->free(grad2_0_1_chi);
+  mem::get_pool()->free(grad2_0_2_chi);
+  mem::get_pool()->free(grad2_1_1_chi);
+  mem::get_pool()->free(grad2_1_2_chi);
+  mem::get_pool()->free(grad2_2_2_chi);
+  mem::get_pool()->free(grad2_0_0_alpha);
+  mem::get_pool()->free(grad2_0_1_alpha);
+  mem::get_pool()->free(grad2_0_2_alpha);
+  mem::get_pool()->free(grad2_1_1_alpha);
+  mem::get_pool()->free(grad2_1_2_alpha);
+  mem::get_pool()->free(grad2_2_2_alpha);
+  mem::get_pool()->free(grad2_0_0_beta0);
+  mem::get_pool()->free(grad2_0_1_beta0);
+  mem::get_pool()->free(grad2_0_2_beta0);
+  mem::get_pool()->free(grad2_1_1_beta0);
+  mem::get_pool()->free(grad2_1_2_beta0);
+  mem::get_pool()->free(grad2_2_2_beta0);
+  mem::get_pool()->free(grad2_0_0_beta1);
+  mem::get_pool()->free(grad2_0_1_beta1);
+  mem::get_pool()->free(grad2_0_2_beta1);
+  mem::get_pool()->free(grad2_1_1_beta1);
+  mem::get_pool()->free(grad2_1_2_beta1);
+  mem::get_pool()->free(grad2_2_2_beta1);
+  mem::get_pool()->free(grad2_0_0_beta2);
+  mem::get_pool()->free(grad2_0_1_beta2);
+  mem::get_pool()->free(grad2_0_2_beta2);
+  mem::get_pool()->free(grad2_1_1_beta2);
+  mem::get_pool()->free(grad2_1_2_beta2);
+  mem::get_pool()->free(grad2_2_2_beta2);
@@ -1,72 +1,72 @@
-  free(agrad_0_gt0);
-  free(agrad_1_gt0);
-  free(agrad_2_gt0);
-  free(agrad_0_gt1);
-  free(agrad_1_gt1);
-  free(agrad_2_gt1);
-  free(agrad_0_gt2);
-  free(agrad_1_gt2);
-  free(agrad_2_gt2);
-  free(agrad_0_gt3);
-  free(agrad_1_gt3);
-  free(agrad_2_gt3);
-  free(agrad_0_gt4);
-  free(agrad_1_gt4);
-  free(agrad_2_gt4);
-  free(agrad_0_gt5);
-  free(agrad_1_gt5);
-  free(agrad_2_gt5);
-  free(agrad_0_At0);
-  free(agrad_1_At0);
-  free(agrad_2_At0);
-  free(agrad_0_At1);
-  free(agrad_1_At1);
-  free(agrad_2_At1);
-  free(agrad_0_At2);
-  free(agrad_1_At2);
-  free(agrad_2_At2);
-  free(agrad_0_At3);
-  free(agrad_1_At3);
-  free(agrad_2_At3);
-  free(agrad_0_At4);
-  free(agrad_1_At4);
-  free(agrad_2_At4);
-  free(agrad_0_At5);
-  free(agrad_1_At5);
-  free(agrad_2_At5);
-  free(agrad_0_alpha);
-  free(agrad_1_alpha);
-  free(agrad_2_alpha);
-  free(agrad_0_beta0);
-  free(agrad_1_beta0);
-  free(agrad_2_beta0);
-  free(agrad_0_beta1);
-  free(agrad_1_beta1);
-  free(agrad_2_beta1);
-  free(agrad_0_beta2);
-  free(agrad_1_beta2);
-  free(agrad_2_beta2);
-  free(agrad_0_chi);
-  free(agrad_1_chi);
-  free(agrad_2_chi);
-  free(agrad_0_Gt0);
-  free(agrad_1_Gt0);
-  free(agrad_2_Gt0);
-  free(agrad_0_Gt1);
-  free(agrad_1_Gt1);
-  free(agrad_2_Gt1);
-  free(agrad_0_Gt2);
-  free(agrad_1_Gt2);
-  free(agrad_2_Gt2);
-  free(agrad_0_K);
-  free(agrad_1_K);
-  free(agrad_2_K);
-  free(agrad_0_B0);
-  free(agrad_1_B0);
-  free(agrad_2_B0);
-  free(agrad_0_B1);
-  free(agrad_1_B1);
-  free(agrad_2_B1);
-  free(agrad_0_B2);
-  free(agrad_1_B2);
-  free(agrad_2_B2);
+  mem::get_pool()->free(agrad_0_gt0);
+  mem::get_pool()->free(agrad_1_gt0);
+  mem::get_pool()->free(agrad_2_gt0);
+  mem::get_pool()->free(agrad_0_gt1);
+  mem::get_pool()->free(agrad_1_gt1);
+  mem::get_pool()->free(agrad_2_gt1);
+  mem::get_pool()->free(agrad_0_gt2);
+  mem::get_pool()->free(agrad_1_gt2);
+  mem::get_pool()->free(agrad_2_gt2);
+  mem::get_pool()->free(agrad_0_gt3);
+  mem::get_pool()->free(agrad_1_gt3);
+  mem::get_pool()->free(agrad_2_gt3);
+  mem::get_pool()->free(agrad_0_gt4);
+  mem::get_pool()->free(agrad_1_gt4);
+  mem::get_pool()->free(agrad_2_gt4);
+  mem::get_pool()->free(agrad_0_gt5);
+  mem::get_pool()->free(agrad_1_gt5);
+  mem::get_pool()->free(agrad_2_gt5);
+  mem::get_pool()->free(agrad_0_At0);
+  mem::get_pool()->free(agrad_1_At0);
+  mem::get_pool()->free(agrad_2_At0);
+  mem::get_pool()->free(agrad_0_At1);
+  mem::get_pool()->free(agrad_1_At1);
+  mem::get_pool()->free(agrad_2_At1);
+  mem::get_pool()->free(agrad_0_At2);
+  mem::get_pool()->free(agrad_1_At2);
+  mem::get_pool()->free(agrad_2_At2);
+  mem::get_pool()->free(agrad_0_At3);
+  mem::get_pool()->free(agrad_1_At3);
+  mem::get_pool()->free(agrad_2_At3);
+  mem::get_pool()->free(agrad_0_At4);
+  mem::get_pool()->free(agrad_1_At4);
+  mem::get_pool()->free(agrad_2_At4);
+  mem::get_pool()->free(agrad_0_At5);
+  mem::get_pool()->free(agrad_1_At5);
+  mem::get_pool()->free(agrad_2_At5);
+  mem::get_pool()->free(agrad_0_alpha);
+  mem::get_pool()->free(agrad_1_alpha);
+  mem::get_pool()->free(agrad_2_alpha);
+  mem::get_pool()->free(agrad_0_beta0);
+  mem::get_pool()->free(agrad_1_beta0);
+  mem::get_pool()->free(agrad_2_beta0);
+  mem::get_pool()->free(agrad_0_beta1);
+  mem::get_pool()->free(agrad_1_beta1);
+  mem::get_pool()->free(agrad_2_beta1);
+  mem::get_pool()->free(agrad_0_beta2);
+  mem::get_pool()->free(agrad_1_beta2);
+  mem::get_pool()->free(agrad_2_beta2);
+  mem::get_pool()->free(agrad_0_chi);
+  mem::get_pool()->free(agrad_1_chi);
+  mem::get_pool()->free(agrad_2_chi);
+  mem::get_pool()->free(agrad_0_Gt0);
+  mem::get_pool()->free(agrad_1_Gt0);
+  mem::get_pool()->free(agrad_2_Gt0);
+  mem::get_pool()->free(agrad_0_Gt1);
+  mem::get_pool()->free(agrad_1_Gt1);
+  mem::get_pool()->free(agrad_2_Gt1);
+  mem::get_pool()->free(agrad_0_Gt2);
+  mem::get_pool()->free(agrad_1_Gt2);
+  mem::get_pool()->free(agrad_2_Gt2);
+  mem::get_pool()->free(agrad_0_K);
+  mem::get_pool()->free(agrad_1_K);
+  mem::get_pool()->free(agrad_2_K);
+  mem::get_pool()->free(agrad_0_B0);
+  mem::get_pool()->free(agrad_1_B0);
+  mem::get_pool()->free(agrad_2_B0);
+  mem::get_pool()->free(agrad_0_B1);
+  mem::get_pool()->free(agrad_1_B1);
+  mem::get_pool()->free(agrad_2_B1);
+  mem::get_pool()->free(agrad_0_B2);
+  mem::get_pool()->free(agrad_1_B2);
+  mem::get_pool()->free(agrad_2_B2);
@@ -1,94 +1,94 @@
   const unsigned int bytes = n * sizeof(double);
-  double *grad_0_chi = (double *) malloc(bytes);
-  double *grad_1_chi = (double *) malloc(bytes);
-  double *grad_2_chi = (double *) malloc(bytes);
-  double *grad_0_Gt0 = (double *) malloc(bytes);
-  double *grad_1_Gt0 = (double *) malloc(bytes);
-  double *grad_2_Gt0 = (double *) malloc(bytes);
-  double *grad_0_Gt1 = (double *) malloc(bytes);
-  double *grad_1_Gt1 = (double *) malloc(bytes);
-  double *grad_2_Gt1 = (double *) malloc(bytes);
-  double *grad_0_Gt2 = (double *) malloc(bytes);
-  double *grad_1_Gt2 = (double *) malloc(bytes);
-  double *grad_2_Gt2 = (double *) malloc(bytes);
-  double *grad_0_K = (double *) malloc(bytes);
-  double *grad_1_K = (double *) malloc(bytes);
-  double *grad_2_K = (double *) malloc(bytes);
-  double *grad_0_gt0 = (double *) malloc(bytes);
-  double *grad_1_gt0 = (double *) malloc(bytes);
-  double *grad_2_gt0 = (double *) malloc(bytes);
-  double *grad_0_gt1 = (double *) malloc(bytes);
-  double *grad_1_gt1 = (double *) malloc(bytes);
-  double *grad_2_gt1 = (double *) malloc(bytes);
-  double *grad_0_gt2 = (double *) malloc(bytes);
-  double *grad_1_gt2 = (double *) malloc(bytes);
-  double *grad_2_gt2 = (double *) malloc(bytes);
-  double *grad_0_gt3 = (double *) malloc(bytes);
-  double *grad_1_gt3 = (double *) malloc(bytes);
-  double *grad_2_gt3 = (double *) malloc(bytes);
-  double *grad_0_gt4 = (double *) malloc(bytes);
-  double *grad_1_gt4 = (double *) malloc(bytes);
-  double *grad_2_gt4 = (double *) malloc(bytes);
-  double *grad_0_gt5 = (double *) malloc(bytes);
-  double *grad_1_gt5 = (double *) malloc(bytes);
-  double *grad_2_gt5 = (double *) malloc(bytes);
-  double *grad_0_At0 = (double *) malloc(bytes);
-  double *grad_1_At0 = (double *) malloc(bytes);
-  double *grad_2_At0 = (double *) malloc(bytes);
-  double *grad_0_At1 = (double *) malloc(bytes);
-  double *grad_1_At1 = (double *) malloc(bytes);
-  double *grad_2_At1 = (double *) malloc(bytes);
-  double *grad_0_At2 = (double *) malloc(bytes);
-  double *grad_1_At2 = (double *) malloc(bytes);
-  double *grad_2_At2 = (double *) malloc(bytes);
-  double *grad_0_At3 = (double *) malloc(bytes);
-  double *grad_1_At3 = (double *) malloc(bytes);
-  double *grad_2_At3 = (double *) malloc(bytes);
-  double *grad_0_At4 = (double *) malloc(bytes);
-  double *grad_1_At4 = (double *) malloc(bytes);
-  double *grad_2_At4 = (double *) malloc(bytes);
-  double *grad_0_At5 = (double *) malloc(bytes);
-  double *grad_1_At5 = (double *) malloc(bytes);
-  double *grad_2_At5 = (double *) malloc(bytes);
-  double *grad2_0_0_gt0 = (double *) malloc(bytes);
-  double *grad2_0_1_gt0 = (double *) malloc(bytes);
-  double *grad2_0_2_gt0 = (double *) malloc(bytes);
-  double *grad2_1_1_gt0 = (double *) malloc(bytes);
-  double *grad2_1_2_gt0 = (double *) malloc(bytes);
-  double *grad2_2_2_gt0 = (double *) malloc(bytes);
-  double *grad2_0_0_gt1 = (double *) malloc(bytes);
-  double *grad2_0_1_gt1 = (double *) malloc(bytes);
-  double *grad2_0_2_gt1 = (double *) malloc(bytes);
-  double *grad2_1_1_gt1 = (double *) malloc(bytes);
-  double *grad2_1_2_gt1 = (double *) malloc(bytes);
-  double *grad2_2_2_gt1 = (double *) malloc(bytes);
-  double *grad2_0_0_gt2 = (double *) malloc(bytes);
-  double *grad2_0_1_gt2 = (double *) malloc(bytes);
-  double *grad2_0_2_gt2 = (double *) malloc(bytes);
-  double *grad2_1_1_gt2 = (double *) malloc(bytes);
-  double *grad2_1_2_gt2 = (double *) malloc(bytes);
-  double *grad2_2_2_gt2 = (double *) malloc(bytes);
-  double *grad2_0_0_gt3 = (double *) malloc(bytes);
-  double *grad2_0_1_gt3 = (double *) malloc(bytes);
-  double *grad2_0_2_gt3 = (double *) malloc(bytes);
-  double *grad2_1_1_gt3 = (double *) malloc(bytes);
-  double *grad2_1_2_gt3 = (double *) malloc(bytes);
-  double *grad2_2_2_gt3 = (double *) malloc(bytes);
-  double *grad2_0_0_gt4 = (double *) malloc(bytes);
-  double *grad2_0_1_gt4 = (double *) malloc(bytes);
-  double *grad2_0_2_gt4 = (double *) malloc(bytes);
-  double *grad2_1_1_gt4 = (double *) malloc(bytes);
-  double *grad2_1_2_gt4 = (double *) malloc(bytes);
-  double *grad2_2_2_gt4 = (double *) malloc(bytes);
-  double *grad2_0_0_gt5 = (double *) malloc(bytes);
-  double *grad2_0_1_gt5 = (double *) malloc(bytes);
-  double *grad2_0_2_gt5 = (double *) malloc(bytes);
-  double *grad2_1_1_gt5 = (double *) malloc(bytes);
-  double *grad2_1_2_gt5 = (double *) malloc(bytes);
-  double *grad2_2_2_gt5 = (double *) malloc(bytes);
-  double *grad2_0_0_chi = (double *) malloc(bytes);
-  double *grad2_0_1_chi = (double *) malloc(bytes);
-  double *grad2_0_2_chi = (double *) malloc(bytes);
-  double *grad2_1_1_chi = (double *) malloc(bytes);
-  double *grad2_1_2_chi = (double *) malloc(bytes);
-  double *grad2_2_2_chi = (double *) malloc(bytes);
+  double *grad_0_chi = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_chi = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_chi = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_Gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_Gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_Gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_Gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_Gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_Gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_Gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_Gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_Gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_K = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_K = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_K = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_At0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_At0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_At0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_At1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_At1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_At1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_At2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_At2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_At2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_At3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_At3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_At3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_At4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_At4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_At4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_0_At5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_1_At5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad_2_At5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_0_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_1_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_2_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_1_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_2_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_2_2_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_0_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_1_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_2_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_1_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_2_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_2_2_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_0_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_1_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_2_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_1_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_2_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_2_2_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_0_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_1_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_2_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_1_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_2_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_2_2_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_0_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_1_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_2_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_1_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_2_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_2_2_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_0_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_1_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_2_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_1_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_2_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_2_2_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_0_chi = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_1_chi = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_0_2_chi = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_1_chi = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_1_2_chi = (double *) mem::get_pool()->allocate(bytes);
+  double *grad2_2_2_chi = (double *) mem::get_pool()->allocate(bytes);
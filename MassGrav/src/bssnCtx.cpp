@@ -151,7 +151,7 @@ namespace massgrav
         return 0;    
     }
 
-    int BSSNCtx::rhs(DVec* in , DVec* out, unsigned int sz , DendroScalar time)
+    int BSSNCtx::rhs(DVecView* in , DVecView* out, unsigned int sz , DendroScalar time)
     {
         // all the variables should be packed together. 
         assert(sz==1);
@@ -186,7 +186,7 @@ namespace massgrav
     }
 
 
-    int BSSNCtx::rhs_blkwise(DVec in, DVec out, const unsigned int* const blkIDs, unsigned int numIds, DendroScalar*  blk_time) const
+    int BSSNCtx::rhs_blkwise(DVecView in, DVecView out, const unsigned int* const blkIDs, unsigned int numIds, DendroScalar*  blk_time) const
     {
 
         DendroScalar ** unzipIn;
@@ -233,18 +233,21 @@ namespace massgrav
             ptmax[1]=GRIDY_TO_Y(blkList[blk].getBlockNode().maxY())+3*dy;
             ptmax[2]=GRIDZ_TO_Z(blkList[blk].getBlockNode().maxZ())+3*dz;
 
+            const double t_blk = MPI_Wtime();
             #ifdef BSSN_RHS_STAGED_COMP
                 massgravrhs_sep(unzipOut, (const double **)unzipIn, offset, ptmin, ptmax, sz, bflag);
             #else
                 massgravrhs(unzipOut, (const double **)unzipIn, offset, ptmin, ptmax, sz, bflag);
             #endif
+            if(massgrav::MASSGRAV_USE_MEASURED_LOAD)
+                massgrav::recordBlockCost(blkList[blk],MPI_Wtime()-t_blk);
 
         }
 
         delete [] unzipIn;
         delete [] unzipOut;
 
-        
+        return 0;
     }
 
     int BSSNCtx::rhs_blk(const DendroScalar* in, DendroScalar* out, unsigned int dof, unsigned int local_blk_id, DendroScalar  blk_time) const 
@@ -292,15 +295,19 @@ namespace massgrav
         ptmax[1]=GRIDY_TO_Y(blkList[blk].getBlockNode().maxY())+3*dy;
         ptmax[2]=GRIDZ_TO_Z(blkList[blk].getBlockNode().maxZ())+3*dz;
 
+        const double t_blk = MPI_Wtime();
         #ifdef BSSN_RHS_STAGED_COMP
             massgravrhs_sep(unzipOut, (const DendroScalar **)unzipIn, 0, ptmin, ptmax, sz, bflag);
         #else
             massgravrhs(unzipOut, (const DendroScalar **)unzipIn, 0, ptmin, ptmax, sz, bflag);
         #endif
+        if(massgrav::MASSGRAV_USE_MEASURED_LOAD)
+            massgrav::recordBlockCost(blkList[blk],MPI_Wtime()-t_blk);
 
         delete [] unzipIn;
         delete [] unzipOut;
 
+        return 0;
 
     }
 
@@ -668,6 +675,8 @@ namespace massgrav
             newMesh=new ot::Mesh(octree,1,m_uiElementOrder,activeCommSz,comm);
             // no need to transfer data only to resize the contex variables. 
             this->grid_transfer( newMesh , false, false, false);
+            // the old vectors are released by the grid transfer. 
+            this->update_app_vars();
             
             // only reads the evolution variables. 
             if(isActive) {
@@ -710,7 +719,7 @@ namespace massgrav
 
     }
 
-    int BSSNCtx::pre_timestep(DVec sIn)
+    int BSSNCtx::pre_timestep(DVecView sIn)
     {
 
         #ifdef BSSN_EXTRACT_BH_LOCATIONS
@@ -728,18 +737,18 @@ namespace massgrav
         return 0;
     }
 
-    int BSSNCtx::pre_stage(DVec  sIn)
+    int BSSNCtx::pre_stage(DVecView  sIn)
     {
         
         return 0;
     }
 
-    int BSSNCtx::post_stage(DVec sIn)
+    int BSSNCtx::post_stage(DVecView sIn)
     { 
         return 0;
     }
 
-    int BSSNCtx::post_timestep(DVec sIn)
+    int BSSNCtx::post_timestep(DVecView sIn)
     {
         return 0;
     }
@@ -801,17 +810,17 @@ namespace massgrav
         
     }
 
-    DVec BSSNCtx::get_evolution_vars()
+    DVecView BSSNCtx::get_evolution_vars()
     {
         return m_uiEVar;
     }
     
-    DVec BSSNCtx::get_constraint_vars()
+    DVecView BSSNCtx::get_constraint_vars()
     {
         return m_uiCVar;
     }
 
-    DVec BSSNCtx::get_primitive_vars()
+    DVecView BSSNCtx::get_primitive_vars()
     {
         return m_uiPVar;
     }
@@ -176,19 +176,20 @@ namespace massgrav
                 pNodes[ele].setFlag(((OCT_NO_CHANGE<<NUM_LEVEL_BITS)|pNodes[ele].getLevel()));
 
             // refine pass. 
+            const double b1x = bhLoc[0].x(), b1y = bhLoc[0].y(), b1z = bhLoc[0].z();
+            const double b2x = bhLoc[1].x(), b2y = bhLoc[1].y(), b2z = bhLoc[1].z();
+
             for(unsigned int ele = eleLocalBegin; ele< eleLocalEnd; ele++)
             {
-                temp = Point( GRIDX_TO_X(pNodes[ele].minX()), GRIDY_TO_Y(pNodes[ele].minY()), GRIDZ_TO_Z(pNodes[ele].minZ()) ); 
-                d1 = temp -bhLoc[0]; 
-                d2 = temp -bhLoc[1];
+                const double x = GRIDX_TO_X(pNodes[ele].minX());
+                const double y = GRIDY_TO_Y(pNodes[ele].minY());
+                const double z = GRIDZ_TO_Z(pNodes[ele].minZ());
+                const bool in1 = (fabs(x-b1x) <=rx) && (fabs(y-b1y)<=ry) && (fabs(z-b1z)<=rz);
+                const bool in2 = (fabs(x-b2x) <=rx) && (fabs(y-b2y)<=ry) && (fabs(z-b2z)<=rz);
 
-                if( (fabs(d1.x()) <=rx && fabs(d1.y())<=ry && fabs(d1.z())<=rz ) || (fabs(d2.x()) <=rx && fabs(d2.y())<=ry && fabs(d2.z())<=rz) )
-                {   
-                    if((pNodes[ele].getLevel()+MAXDEAPTH_LEVEL_DIFF+1)<m_uiMaxDepth)
-                        pNodes[ele].setFlag(((OCT_SPLIT<<NUM_LEVEL_BITS)|pNodes[ele].getLevel()));
+                if( (in1 || in2) && (pNodes[ele].getLevel()+MAXDEAPTH_LEVEL_DIFF+1)<m_uiMaxDepth )
+                    pNodes[ele].setFlag(((OCT_SPLIT<<NUM_LEVEL_BITS)|pNodes[ele].getLevel()));
 
-                }
-            
             }
 
             // coarsen pass. 
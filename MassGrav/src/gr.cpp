@@ -132,6 +132,7 @@ int main (int argc, char** argv)
         std::cout<<YLW<<"\t:MASSGRAV_WAVELET_TOL_FUNCTION_R0: "<<massgrav::MASSGRAV_WAVELET_TOL_FUNCTION_R0<<NRM<<std::endl;
         std::cout<<YLW<<"\t:MASSGRAV_WAVELET_TOL_FUNCTION_R1: "<<massgrav::MASSGRAV_WAVELET_TOL_FUNCTION_R1<<NRM<<std::endl;
         std::cout<<YLW<<"\tMASSGRAV_LOAD_IMB_TOL :"<<massgrav::MASSGRAV_LOAD_IMB_TOL<<NRM<<std::endl;
+        std::cout<<YLW<<"\tMASSGRAV_USE_MEASURED_LOAD :"<<massgrav::MASSGRAV_USE_MEASURED_LOAD<<NRM<<std::endl;
         std::cout<<YLW<<"\tMASSGRAV_RK_TIME_BEGIN :"<<massgrav::MASSGRAV_RK_TIME_BEGIN<<NRM<<std::endl;
         std::cout<<YLW<<"\tMASSGRAV_RK_TIME_END :"<<massgrav::MASSGRAV_RK_TIME_END<<NRM<<std::endl;
         std::cout<<YLW<<"\tMASSGRAV_RK_TYPE :"<<massgrav::MASSGRAV_RK_TYPE<<NRM<<std::endl;
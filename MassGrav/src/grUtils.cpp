@@ -198,6 +198,21 @@ namespace massgrav
                 massgrav::MASSGRAV_USE_FD_GRID_TRANSFER=parFile["MASSGRAV_USE_FD_GRID_TRANSFER"];
             }
 
+            if(parFile.find("MASSGRAV_USE_MEASURED_LOAD")!=parFile.end())
+            {
+                massgrav::MASSGRAV_USE_MEASURED_LOAD=parFile["MASSGRAV_USE_MEASURED_LOAD"];
+            }
+
+            if(parFile.find("MASSGRAV_LOAD_COST_SMOOTHING")!=parFile.end())
+            {
+                massgrav::MASSGRAV_LOAD_COST_SMOOTHING=parFile["MASSGRAV_LOAD_COST_SMOOTHING"];
+            }
+
+            if(parFile.find("MASSGRAV_NUTS_PARTITION")!=parFile.end())
+            {
+                massgrav::MASSGRAV_NUTS_PARTITION=parFile["MASSGRAV_NUTS_PARTITION"];
+            }
+
             if(parFile.find("MASSGRAV_EH_COARSEN_VAL")!= parFile.end())
             {
                 massgrav::MASSGRAV_EH_COARSEN_VAL = parFile["MASSGRAV_EH_COARSEN_VAL"];
@@ -385,6 +400,9 @@ namespace massgrav
         par::Mpi_Bcast(GW::MASSGRAV_GW_L_MODES,GW::MASSGRAV_GW_MAX_LMODES,0,comm);
         par::Mpi_Bcast(GW::MASSGRAV_GW_RADAII,GW::MASSGRAV_GW_MAX_RADAII,0,comm);
         par::Mpi_Bcast(&massgrav::MASSGRAV_USE_FD_GRID_TRANSFER,1,0,comm);
+        par::Mpi_Bcast(&massgrav::MASSGRAV_USE_MEASURED_LOAD,1,0,comm);
+        par::Mpi_Bcast(&massgrav::MASSGRAV_LOAD_COST_SMOOTHING,1,0,comm);
+        par::Mpi_Bcast(&massgrav::MASSGRAV_NUTS_PARTITION,1,0,comm);
         par::Mpi_Bcast(&massgrav::MASSGRAV_VTU_Z_SLICE_ONLY,1,0,comm);
         par::Mpi_Bcast(&massgrav::MASSGRAV_EH_REFINE_VAL,1,0,comm);
         par::Mpi_Bcast(&massgrav::MASSGRAV_EH_COARSEN_VAL,1,0,comm);
@@ -1928,9 +1946,147 @@ double interpolation4( double xx[], double yy[], int np, double xb,
     }
 
 
+    /**@brief weight assigned to an element with the mean measured cost*/
+    static const unsigned int MEASURED_LOAD_WEIGHT_SCALE=100;
+    /**@brief the measured costs are binned by the element level and the cell (at this level) containing the element*/
+    static const unsigned int MEASURED_LOAD_CELL_LEV=3;
+    static const unsigned int MEASURED_LOAD_NUM_CELLS=1u<<(3*MEASURED_LOAD_CELL_LEV);
+    static const unsigned int MEASURED_LOAD_NUM_LEV=1u<<NUM_LEVEL_BITS;
+    /**@brief rhs wall time and number of evaluated elements since the last remesh, indexed by lev*MEASURED_LOAD_NUM_CELLS + cell*/
+    static double cost_time[MEASURED_LOAD_NUM_LEV*MEASURED_LOAD_NUM_CELLS];
+    static double cost_count[MEASURED_LOAD_NUM_LEV*MEASURED_LOAD_NUM_CELLS];
+    /**@brief smoothed cost per element (same on all the ranks, negative if not measured), the mean of each level and the overall mean*/
+    static std::vector<double> cost_table;
+    static std::vector<double> cost_lev;
+    static double cost_mean=0.0;
+
+    /**@brief cell index (at MEASURED_LOAD_CELL_LEV) of the anchor of an octant*/
+    static inline unsigned int measuredLoadCell(unsigned int x, unsigned int y, unsigned int z)
+    {
+        const unsigned int sh = m_uiMaxDepth - MEASURED_LOAD_CELL_LEV;
+        const unsigned int n = 1u<<MEASURED_LOAD_CELL_LEV;
+        return ((z>>sh)*n + (y>>sh))*n + (x>>sh);
+    }
+
+    void recordBlockCost(const ot::Block& blk, double t)
+    {
+        const DendroIntL numEle = blk.getLocalElementEnd() - blk.getLocalElementBegin();
+        const unsigned int lev = blk.getRegularGridLev();
+
+        if(numEle<=0 || lev>=MEASURED_LOAD_NUM_LEV)
+            return;
+
+        // the block (a regular grid) covers n^3 cells if it is coarser than the cells, the time is shared evenly.
+        const ot::TreeNode blkNode = blk.getBlockNode();
+        const unsigned int n = (blkNode.getLevel() >= MEASURED_LOAD_CELL_LEV) ? 1u : (1u<<(MEASURED_LOAD_CELL_LEV - blkNode.getLevel()));
+        const unsigned int cSz = 1u<<(m_uiMaxDepth - MEASURED_LOAD_CELL_LEV);
+        const double tc = t/(double)(n*n*n);
+        const double ec = (double)numEle/(double)(n*n*n);
+
+        for(unsigned int k=0; k<n; k++)
+        for(unsigned int j=0; j<n; j++)
+        for(unsigned int i=0; i<n; i++)
+        {
+            const unsigned int id = lev*MEASURED_LOAD_NUM_CELLS + measuredLoadCell(blkNode.minX() + i*cSz, blkNode.minY() + j*cSz, blkNode.minZ() + k*cSz);
+
+            // blocks are evaluated concurrently (block tasks).
+            #pragma omp atomic
+            cost_time[id]+=tc;
+
+            #pragma omp atomic
+            cost_count[id]+=ec;
+        }
+
+    }
+
+    void clearBlockCost()
+    {
+        for(unsigned int i=0; i<MEASURED_LOAD_NUM_LEV*MEASURED_LOAD_NUM_CELLS; i++)
+        {
+            cost_time[i]=0.0;
+            cost_count[i]=0.0;
+        }
+    }
+
+    void setupOctantWeights(const ot::Mesh* pMesh)
+    {
+        if(!massgrav::MASSGRAV_USE_MEASURED_LOAD)
+            return;
+
+        const unsigned int sz = std::min(m_uiMaxDepth+1,MEASURED_LOAD_NUM_LEV)*MEASURED_LOAD_NUM_CELLS;
+        std::vector<double> time_g(sz);
+        std::vector<double> count_g(sz);
+
+        par::Mpi_Allreduce(cost_time,time_g.data(),sz,MPI_SUM,pMesh->getMPIGlobalCommunicator());
+        par::Mpi_Allreduce(cost_count,count_g.data(),sz,MPI_SUM,pMesh->getMPIGlobalCommunicator());
+
+        // the table is a function of the octant only, (the same on all the ranks) so the weights stay valid when the
+        // octants are redistributed in ReMesh.
+        if(cost_table.empty())
+            cost_table.resize(MEASURED_LOAD_NUM_LEV*MEASURED_LOAD_NUM_CELLS,-1.0);
+
+        const double alpha = massgrav::MASSGRAV_LOAD_COST_SMOOTHING;
+        for(unsigned int i=0; i<sz; i++)
+        {
+            if(count_g[i]<=0 || time_g[i]<=0)
+                continue;
+
+            const double c = time_g[i]/count_g[i];
+            cost_table[i] = (cost_table[i]<0) ? c : (alpha*c + (1.0-alpha)*cost_table[i]);
+        }
+
+        cost_lev.assign(MEASURED_LOAD_NUM_LEV,-1.0);
+        double sum=0.0;
+        unsigned int cnt=0;
+        for(unsigned int l=0; l<MEASURED_LOAD_NUM_LEV; l++)
+        {
+            double lsum=0.0;
+            unsigned int lcnt=0;
+            for(unsigned int c=0; c<MEASURED_LOAD_NUM_CELLS; c++)
+            {
+                if(cost_table[l*MEASURED_LOAD_NUM_CELLS + c]<0)
+                    continue;
+                lsum+=cost_table[l*MEASURED_LOAD_NUM_CELLS + c];
+                lcnt++;
+            }
+
+            if(lcnt)
+                cost_lev[l] = lsum/lcnt;
+
+            sum+=lsum;
+            cnt+=lcnt;
+        }
+
+        // nothing measured yet, getOctantWeight falls back to the level.
+        if(cnt==0)
+        {
+            cost_table.clear();
+            cost_lev.clear();
+            return;
+        }
+
+        cost_mean = sum/cnt;
+
+    }
+
     unsigned int getOctantWeight(const ot::TreeNode* pNode)
     {
-        return pNode->getLevel();
+        if(cost_table.empty())
+            return pNode->getLevel();
+
+        const unsigned int lev = pNode->getLevel();
+        double c = -1.0;
+        if(lev<MEASURED_LOAD_NUM_LEV)
+        {
+            c = cost_table[lev*MEASURED_LOAD_NUM_CELLS + measuredLoadCell(pNode->minX(),pNode->minY(),pNode->minZ())];
+            if(c<0)
+                c = cost_lev[lev];
+        }
+
+        if(c<0)
+            c = cost_mean;
+
+        return std::max(1u,(unsigned int)std::round(MEASURED_LOAD_WEIGHT_SCALE*(c/cost_mean)));
     }
 
 }// end of namespace massgrav
@@ -2407,6 +2563,7 @@ namespace massgrav
 
 
             if(!rank)outfile<<"========================= RUNTIME =================================================================== "<<std::endl;
+            if(!rank)outfile<<"(rhs kernel timers add up the time of all the threads if the blocks run concurrently)"<<std::endl;
             if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator) << "step";
             if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator) << "min(s)";
             if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator) << "mean(s)";
@@ -2727,6 +2884,24 @@ namespace massgrav
             if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[1];
             if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[2]<<std::endl;
 
+            // scratch pool since the last output, the rhs scratch is served by the thread caches if the shared calls stay low.
+            const mem_pool_stats poolStats = mem::get_pool()->get_stats();
+            mem::get_pool()->reset_stats();
+
+            t_stat=poolStats.hit_rate();
+            computeOverallStats(&t_stat, t_stat_g, comm);
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator) <<"  ++mem_pool_hit_rate ";
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[0];
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[1];
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[2]<<std::endl;
+
+            t_stat=poolStats.shared;
+            computeOverallStats(&t_stat, t_stat_g, comm);
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator) <<"  ++mem_pool_shared(#) ";
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[0];
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[1];
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[2]<<std::endl;
+
 
 
             t_stat=t_bdyc.snap;
@@ -142,6 +142,8 @@ int main (int argc, char** argv)
         std::cout<<YLW<<"\t:MASSGRAV_WAVELET_TOL_FUNCTION_R0: "<<massgrav::MASSGRAV_WAVELET_TOL_FUNCTION_R0<<NRM<<std::endl;
         std::cout<<YLW<<"\t:MASSGRAV_WAVELET_TOL_FUNCTION_R1: "<<massgrav::MASSGRAV_WAVELET_TOL_FUNCTION_R1<<NRM<<std::endl;
         std::cout<<YLW<<"\tMASSGRAV_LOAD_IMB_TOL :"<<massgrav::MASSGRAV_LOAD_IMB_TOL<<NRM<<std::endl;
+        std::cout<<YLW<<"\tMASSGRAV_USE_MEASURED_LOAD :"<<massgrav::MASSGRAV_USE_MEASURED_LOAD<<NRM<<std::endl;
+        std::cout<<YLW<<"\tMASSGRAV_NUTS_PARTITION :"<<massgrav::MASSGRAV_NUTS_PARTITION<<NRM<<std::endl;
         std::cout<<YLW<<"\tMASSGRAV_RK_TIME_BEGIN :"<<massgrav::MASSGRAV_RK_TIME_BEGIN<<NRM<<std::endl;
         std::cout<<YLW<<"\tMASSGRAV_RK_TIME_END :"<<massgrav::MASSGRAV_RK_TIME_END<<NRM<<std::endl;
         std::cout<<YLW<<"\tMASSGRAV_RK_TYPE :"<<massgrav::MASSGRAV_RK_TYPE<<NRM<<std::endl;
@@ -365,7 +367,18 @@ int main (int argc, char** argv)
                 if(!rank_global)
                     std::cout<<"[Explicit NUTS]: Remesh triggered "<<std::endl;;
 
-                massgravCtx->remesh(massgrav::MASSGRAV_DENDRO_GRAIN_SZ, massgrav::MASSGRAV_LOAD_IMB_TOL,massgrav::MASSGRAV_SPLIT_FIX,true,false,false);
+                if(massgrav::MASSGRAV_NUTS_PARTITION==1)
+                    massgravCtx->remesh(massgrav::MASSGRAV_DENDRO_GRAIN_SZ, massgrav::MASSGRAV_LOAD_IMB_TOL,massgrav::MASSGRAV_SPLIT_FIX,true,false,false,enuts->get_octant_weight);
+                else if(massgrav::MASSGRAV_NUTS_PARTITION==2)
+                    massgravCtx->remesh(massgrav::MASSGRAV_DENDRO_GRAIN_SZ, massgrav::MASSGRAV_LOAD_IMB_TOL,massgrav::MASSGRAV_SPLIT_FIX,true,false,false,NULL,enuts->get_octant_level_constraint);
+                else if(massgrav::MASSGRAV_USE_MEASURED_LOAD)
+                {
+                    massgrav::setupOctantWeights(massgravCtx->get_mesh());
+                    massgravCtx->remesh(massgrav::MASSGRAV_DENDRO_GRAIN_SZ, massgrav::MASSGRAV_LOAD_IMB_TOL,massgrav::MASSGRAV_SPLIT_FIX,true,false,false,massgrav::getOctantWeight);
+                    massgrav::clearBlockCost();
+                }
+                else
+                    massgravCtx->remesh(massgrav::MASSGRAV_DENDRO_GRAIN_SZ, massgrav::MASSGRAV_LOAD_IMB_TOL,massgrav::MASSGRAV_SPLIT_FIX,true,false,false);
                 massgravCtx->terminal_output();
 
             }
@@ -399,6 +412,21 @@ int main (int argc, char** argv)
             ets->set_ets_coefficients(ts::ETSType::RK4);
         else if((RKType)massgrav::MASSGRAV_RK_TYPE == RKType::RK45)
             ets->set_ets_coefficients(ts::ETSType::RK5);
+        else if((RKType)massgrav::MASSGRAV_RK_TYPE == RKType::LSRK3)
+            ets->set_ets_coefficients(ts::ETSType::LSRK3);
+        else if((RKType)massgrav::MASSGRAV_RK_TYPE == RKType::LSRK4)
+            ets->set_ets_coefficients(ts::ETSType::LSRK4);
+        else if((RKType)massgrav::MASSGRAV_RK_TYPE == RKType::BS32)
+            ets->set_ets_coefficients(ts::ETSType::BS32);
+        else if((RKType)massgrav::MASSGRAV_RK_TYPE == RKType::DP54)
+            ets->set_ets_coefficients(ts::ETSType::DP54);
+
+        // CFL step size is the upper bound for the adaptive methods. 
+        if(ets->is_adaptive())
+        {
+            const DendroScalar dt_cfl = massgravCtx->get_ts_info()._m_uiTh;
+            ets->set_adaptive_params(massgrav::MASSGRAV_RK45_DESIRED_TOL, massgrav::MASSGRAV_RK45_DESIRED_TOL, MASSGRAV_RK_ADAP_DT_MIN_FAC*dt_cfl, dt_cfl);
+        }
 
 
         for(ets->init(); ets->curr_time() < massgrav::MASSGRAV_RK_TIME_END ; ets->evolve())
@@ -423,7 +451,14 @@ int main (int argc, char** argv)
                 if(!rank_global)
                     std::cout<<"[ETS] : Remesh is triggered.  \n";
 
-                massgravCtx->remesh(massgrav::MASSGRAV_DENDRO_GRAIN_SZ, massgrav::MASSGRAV_LOAD_IMB_TOL,massgrav::MASSGRAV_SPLIT_FIX,true,false,false);
+                if(massgrav::MASSGRAV_USE_MEASURED_LOAD)
+                {
+                    massgrav::setupOctantWeights(massgravCtx->get_mesh());
+                    massgravCtx->remesh(massgrav::MASSGRAV_DENDRO_GRAIN_SZ, massgrav::MASSGRAV_LOAD_IMB_TOL,massgrav::MASSGRAV_SPLIT_FIX,true,false,false,massgrav::getOctantWeight);
+                    massgrav::clearBlockCost();
+                }
+                else
+                    massgravCtx->remesh(massgrav::MASSGRAV_DENDRO_GRAIN_SZ, massgrav::MASSGRAV_LOAD_IMB_TOL,massgrav::MASSGRAV_SPLIT_FIX,true,false,false);
                 massgravCtx->terminal_output();
 
             }
@@ -506,7 +541,7 @@ int main (int argc, char** argv)
           printf("[ETS] time (s): (min, mean, max): (%f, %f , %f)\n", t_stat_g[0], t_stat_g[1], t_stat_g[2]);
 
         
-        DVec evar_ets = massgravCtx_ets->get_evolution_vars();
+        DVecView evar_ets = massgravCtx_ets->get_evolution_vars();
 
         t_rt.snapreset();
 
@@ -524,7 +559,7 @@ int main (int argc, char** argv)
           printf("[ENUTS] time (s): (min, mean, max): (%f, %f , %f)\n", t_stat_g[0], t_stat_g[1], t_stat_g[2]);
 
 
-        DVec evar_enuts = massgravCtx_enuts->get_evolution_vars();
+        DVecView evar_enuts = massgravCtx_enuts->get_evolution_vars();
 
         DVec evar_diff;
         evar_diff.VecCopy(evar_ets,false);
@@ -30,6 +30,9 @@ namespace massgrav
     double MASSGRAV_CFL_FACTOR=0.1;
 
     double MASSGRAV_LOAD_IMB_TOL=0.1;
+    bool MASSGRAV_USE_MEASURED_LOAD=false;
+    double MASSGRAV_LOAD_COST_SMOOTHING=0.5;
+    unsigned int MASSGRAV_NUTS_PARTITION=0;
     unsigned int MASSGRAV_SPLIT_FIX=2;
     unsigned int MASSGRAV_ASYNC_COMM_K=4;
     double MASSGRAV_RK_TIME_BEGIN=0;
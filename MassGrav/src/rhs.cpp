@@ -66,12 +66,18 @@ void massgravRHS(double **uzipVarsRHS, const double **uZipVars, const ot::Block*
         ptmax[1]=GRIDY_TO_Y(blkList[blk].getBlockNode().maxY())+3*dy;
         ptmax[2]=GRIDZ_TO_Z(blkList[blk].getBlockNode().maxZ())+3*dz;
 
+        // measured block cost (includes the boundary and padding work) used for the partition weights.
+        const double t_blk = MPI_Wtime();
+
 #ifdef MASSGRAV_RHS_STAGED_COMP
         massgravrhs_sep(uzipVarsRHS, (const double **)uZipVars, offset, ptmin, ptmax, sz, bflag);
 #else
         massgravrhs(uzipVarsRHS, (const double **)uZipVars, offset, ptmin, ptmax, sz, bflag);
 #endif
 
+        if(massgrav::MASSGRAV_USE_MEASURED_LOAD)
+            massgrav::recordBlockCost(blkList[blk],MPI_Wtime()-t_blk);
+
 
     }
 #endif
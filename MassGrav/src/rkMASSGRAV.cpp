@@ -27,19 +27,6 @@ RK_MASSGRAV::RK_MASSGRAV(ot::Mesh *pMesh, DendroScalar pTBegin, DendroScalar pTE
     m_uiBHLoc[1]=Point(massgrav::BH2.getBHCoordX(),massgrav::BH2.getBHCoordY(),massgrav::BH2.getBHCoordZ());
 
 
-    // allocate memory for the variables.
-    m_uiVar=new DendroScalar*[massgrav::MASSGRAV_NUM_VARS];
-    for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-        m_uiVar[index]=m_uiMesh->createVector<DendroScalar>();
-
-    m_uiPrevVar=new DendroScalar*[massgrav::MASSGRAV_NUM_VARS];
-    for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-        m_uiPrevVar[index]=m_uiMesh->createVector<DendroScalar>();
-
-    m_uiVarIm=new DendroScalar*[massgrav::MASSGRAV_NUM_VARS];
-    for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-        m_uiVarIm[index]=m_uiMesh->createVector<DendroScalar>();
-
     if(m_uiRKType==RKType::RK3)
         m_uiNumRKStages=massgrav::MASSGRAV_RK3_STAGES;
     else if(m_uiRKType==RKType::RK4)
@@ -57,34 +44,9 @@ RK_MASSGRAV::RK_MASSGRAV(ot::Mesh *pMesh, DendroScalar pTBegin, DendroScalar pTE
 
 
 
+    // allocate memory for the variables, the stages and the constraint variables.
     m_uiStage=new DendroScalar**[m_uiNumRKStages];
-    for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-    {
-        m_uiStage[stage]=new DendroScalar*[massgrav::MASSGRAV_NUM_VARS];
-        for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-            m_uiStage[stage][index]=m_uiMesh->createVector<DendroScalar>();
-    }
-
-    m_uiUnzipVar=new DendroScalar*[massgrav::MASSGRAV_NUM_VARS];
-    for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-        m_uiUnzipVar[index]=m_uiMesh->createUnZippedVector<DendroScalar>();
-
-
-    m_uiUnzipVarRHS=new DendroScalar*[massgrav::MASSGRAV_NUM_VARS];
-    for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-        m_uiUnzipVarRHS[index]=m_uiMesh->createUnZippedVector<DendroScalar>();
-
-
-
-    // allocate memory for the constraint variables.
-    m_uiConstraintVars=new DendroScalar*[massgrav::MASSGRAV_CONSTRAINT_NUM_VARS];
-    for(unsigned int index=0; index<massgrav::MASSGRAV_CONSTRAINT_NUM_VARS; index++)
-        m_uiConstraintVars[index]=m_uiMesh->createVector<DendroScalar>();
-
-
-    m_uiUnzipConstraintVars=new DendroScalar*[massgrav::MASSGRAV_CONSTRAINT_NUM_VARS];
-    for(unsigned int index=0; index<massgrav::MASSGRAV_CONSTRAINT_NUM_VARS; index++)
-        m_uiUnzipConstraintVars[index]=m_uiMesh->createUnZippedVector<DendroScalar>();
+    allocateVars(m_uiMesh);
 
 
     // mpi communication
@@ -137,46 +99,10 @@ RK_MASSGRAV::RK_MASSGRAV(ot::Mesh *pMesh, DendroScalar pTBegin, DendroScalar pTE
 
 RK_MASSGRAV::~RK_MASSGRAV()
 {
-    for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-    {
-        delete [] m_uiVar[index];
-        delete [] m_uiPrevVar[index];
-        delete [] m_uiVarIm[index];
-        delete [] m_uiUnzipVar[index];
-        delete [] m_uiUnzipVarRHS[index];
-
-
-    }
-
-
-    delete [] m_uiVar;
-    delete [] m_uiPrevVar;
-    delete [] m_uiVarIm;
-    delete [] m_uiUnzipVar;
-    delete [] m_uiUnzipVarRHS;
-
-    for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-        for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-            delete [] m_uiStage[stage][index];
-
-    for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-        delete [] m_uiStage[stage];
-
+    // variable storage is freed by the field sets.
     delete [] m_uiStage;
 
 
-    // deallocate memory for the constraint variables.
-    for(unsigned int index=0; index<massgrav::MASSGRAV_CONSTRAINT_NUM_VARS; index++)
-    {
-        delete [] m_uiConstraintVars[index];
-        delete [] m_uiUnzipConstraintVars[index];
-    }
-
-
-    delete [] m_uiConstraintVars;
-    delete [] m_uiUnzipConstraintVars;
-
-
     // mpi communication
     for(unsigned int index=0; index<massgrav::MASSGRAV_ASYNC_COMM_K; index++)
     {
@@ -335,50 +261,16 @@ void RK_MASSGRAV::initialGridConverge()
 
 
             // performs the inter-grid transfer
-            intergridTransferVars(m_uiPrevVar,newMesh,massgrav::MASSGRAV_USE_FD_GRID_TRANSFER);
-
-            for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-            {
-                delete [] m_uiVar[index];
-                delete [] m_uiVarIm[index];
-                delete [] m_uiUnzipVar[index];
-                delete [] m_uiUnzipVarRHS[index];
-
-                m_uiVar[index]=NULL;
-                m_uiVarIm[index]=NULL;
-                m_uiUnzipVar[index]=NULL;
-                m_uiUnzipVarRHS[index]=NULL;
-
-                m_uiVar[index]=newMesh->createVector<DendroScalar>();
-                m_uiVarIm[index]=newMesh->createVector<DendroScalar>();
-                m_uiUnzipVar[index]=newMesh->createUnZippedVector<DendroScalar>();
-                m_uiUnzipVarRHS[index]=newMesh->createUnZippedVector<DendroScalar>();
-
-
-            }
-
-            for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-                for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-                {
-                    delete [] m_uiStage[stage][index];
-                    m_uiStage[stage][index]=NULL;
-                    m_uiStage[stage][index]=newMesh->createVector<DendroScalar>();
-                }
-
-            // deallocate constraint vars allocate them for the new mesh.
-            for(unsigned int index=0; index<massgrav::MASSGRAV_CONSTRAINT_NUM_VARS; index++)
-            {
-                delete [] m_uiConstraintVars[index];
-                delete [] m_uiUnzipConstraintVars[index];
-
-                m_uiConstraintVars[index]=newMesh->createVector<DendroScalar>();
-                m_uiUnzipConstraintVars[index]=newMesh->createUnZippedVector<DendroScalar>();
+            intergridTransferVars(m_uiPrevVarFS,m_uiVarFS,newMesh,massgrav::MASSGRAV_USE_FD_GRID_TRANSFER);
 
-            }
+            // reallocates the vars for the new mesh (only if the new mesh is larger than the current storage).
+            allocateVars(newMesh);
 
 
             std::swap(newMesh,m_uiMesh);
             delete newMesh;
+            // the cached pool blocks are sized for the old mesh blocks.
+            mem::get_pool()->purge();
 
             #ifdef RK_SOLVER_OVERLAP_COMM_AND_COMP
             // reallocates mpi resources for the the new mesh. (this will deallocate the old resources)
@@ -519,27 +411,58 @@ void RK_MASSGRAV::performGhostExchangeVars(DendroScalar** zipIn)
 
 }
 
-void RK_MASSGRAV::intergridTransferVars(DendroScalar**& zipIn, const ot::Mesh* pnewMesh,bool useUnzip)
+void RK_MASSGRAV::allocateVars(const ot::Mesh* pMesh)
+{
+    const unsigned int dof   = (pMesh->isActive()) ? pMesh->getDegOfFreedom() : 0;
+    const unsigned int dofUz = (pMesh->isActive()) ? pMesh->getDegOfFreedomUnZip() : 0;
+
+    m_uiVarFS.allocate(massgrav::MASSGRAV_NUM_VARS,dof);
+    m_uiPrevVarFS.allocate(massgrav::MASSGRAV_NUM_VARS,dof);
+    m_uiVarImFS.allocate(massgrav::MASSGRAV_NUM_VARS,dof);
+    m_uiStageFS.allocate(massgrav::MASSGRAV_NUM_VARS*m_uiNumRKStages,dof);
+
+    m_uiUnzipVarFS.allocate(massgrav::MASSGRAV_NUM_VARS,dofUz);
+    m_uiUnzipVarRHSFS.allocate(massgrav::MASSGRAV_NUM_VARS,dofUz);
+
+    m_uiConstraintVarsFS.allocate(massgrav::MASSGRAV_CONSTRAINT_NUM_VARS,dof);
+    m_uiUnzipConstraintVarsFS.allocate(massgrav::MASSGRAV_CONSTRAINT_NUM_VARS,dofUz);
+
+    m_uiVar=m_uiVarFS.ptrs();
+    m_uiPrevVar=m_uiPrevVarFS.ptrs();
+    m_uiVarIm=m_uiVarImFS.ptrs();
+
+    for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
+        m_uiStage[stage]=m_uiStageFS.ptrs() + stage*massgrav::MASSGRAV_NUM_VARS;
+
+    m_uiUnzipVar=m_uiUnzipVarFS.ptrs();
+    m_uiUnzipVarRHS=m_uiUnzipVarRHSFS.ptrs();
+
+    m_uiConstraintVars=m_uiConstraintVarsFS.ptrs();
+    m_uiUnzipConstraintVars=m_uiUnzipConstraintVarsFS.ptrs();
+
+}
+
+void RK_MASSGRAV::intergridTransferVars(ot::FieldSet<DendroScalar>& zipIn, ot::FieldSet<DendroScalar>& zipOut, const ot::Mesh* pnewMesh,bool useUnzip)
 {
     massgrav::timer::t_gridTransfer.start();
 
+    zipOut.allocate(massgrav::MASSGRAV_NUM_VARS,(pnewMesh->isActive()) ? pnewMesh->getDegOfFreedom() : 0);
+
+    DendroScalar ** in  = zipIn.ptrs();
+    DendroScalar ** out = zipOut.ptrs();
+
     if(!useUnzip)
     {
         for(unsigned int v=0; v<massgrav::MASSGRAV_NUM_VARS; v++)
-            m_uiMesh->interGridTransfer(zipIn[v],pnewMesh);
+            m_uiMesh->interGridTransfer(in[v],out[v],pnewMesh,true);
     }else
     {
-        unzipVars_async(zipIn,m_uiUnzipVar);
+        unzipVars_async(in,m_uiUnzipVar);
         for(unsigned int v=0; v<massgrav::MASSGRAV_NUM_VARS; v++)
-        {
-            m_uiMesh->interGridTransferUnzip(m_uiUnzipVar[v],zipIn[v],pnewMesh);
-        }
-        
+            m_uiMesh->interGridTransferUnzip(m_uiUnzipVar[v],in[v],out[v],pnewMesh);
     }
 
-
-
-    
+    zipIn.swap(zipOut);
 
     massgrav::timer::t_gridTransfer.stop();
 
@@ -858,12 +781,15 @@ void RK_MASSGRAV::performSingleIteration()
                     ptmax[2]=GRIDZ_TO_Z(blkList[blk].getBlockNode().maxZ())+3*dz;
 
 
+                    const double t_blk = MPI_Wtime();
             #ifdef MASSGRAV_RHS_STAGED_COMP
 
                     massgravrhs_sep(m_uiUnzipVarRHS, (const double **)m_uiUnzipVar, offset, ptmin, ptmax, sz, bflag);
             #else
                     massgravrhs(m_uiUnzipVarRHS, (const double **)m_uiUnzipVar, offset, ptmin, ptmax, sz, bflag);
             #endif
+                    if(massgrav::MASSGRAV_USE_MEASURED_LOAD)
+                        massgrav::recordBlockCost(blkList[blk],MPI_Wtime()-t_blk);
 
 
                 }
@@ -973,12 +899,15 @@ void RK_MASSGRAV::performSingleIteration()
                 ptmax[2]=GRIDZ_TO_Z(blkList[blk].getBlockNode().maxZ())+3*dz;
 
 
+                const double t_blk = MPI_Wtime();
             #ifdef MASSGRAV_RHS_STAGED_COMP
 
                 massgravrhs_sep(m_uiUnzipVarRHS, (const double **)m_uiUnzipVar, offset, ptmin, ptmax, sz, bflag);
             #else
                 massgravrhs(m_uiUnzipVarRHS, (const double **)m_uiUnzipVar, offset, ptmin, ptmax, sz, bflag);
             #endif
+                if(massgrav::MASSGRAV_USE_MEASURED_LOAD)
+                    massgrav::recordBlockCost(blkList[blk],MPI_Wtime()-t_blk);
 
 
             }
@@ -1114,12 +1043,15 @@ void RK_MASSGRAV::performSingleIteration()
                             ptmax[2]=GRIDZ_TO_Z(blkList[blk].getBlockNode().maxZ())+3*dz;
 
 
+                            const double t_blk = MPI_Wtime();
                             #ifdef MASSGRAV_RHS_STAGED_COMP
 
                             massgravrhs_sep(m_uiUnzipVarRHS, (const double **)m_uiUnzipVar, offset, ptmin, ptmax, sz, bflag);
                             #else
                             massgravrhs(m_uiUnzipVarRHS, (const double **)m_uiUnzipVar, offset, ptmin, ptmax, sz, bflag);
                             #endif
+                            if(massgrav::MASSGRAV_USE_MEASURED_LOAD)
+                                massgrav::recordBlockCost(blkList[blk],MPI_Wtime()-t_blk);
 
 
                         }
@@ -1231,12 +1163,15 @@ void RK_MASSGRAV::performSingleIteration()
                         ptmax[2]=GRIDZ_TO_Z(blkList[blk].getBlockNode().maxZ())+3*dz;
 
 
+                        const double t_blk = MPI_Wtime();
                         #ifdef MASSGRAV_RHS_STAGED_COMP
 
                         massgravrhs_sep(m_uiUnzipVarRHS, (const double **)m_uiUnzipVar, offset, ptmin, ptmax, sz, bflag);
                         #else
                         massgravrhs(m_uiUnzipVarRHS, (const double **)m_uiUnzipVar, offset, ptmin, ptmax, sz, bflag);
                         #endif
+                        if(massgrav::MASSGRAV_USE_MEASURED_LOAD)
+                            massgrav::recordBlockCost(blkList[blk],MPI_Wtime()-t_blk);
 
 
                     }
@@ -1519,7 +1454,15 @@ void RK_MASSGRAV::rkSolve()
 
             #endif
                 massgrav::timer::t_mesh.start();
-                ot::Mesh* newMesh=m_uiMesh->ReMesh(massgrav::MASSGRAV_DENDRO_GRAIN_SZ,massgrav::MASSGRAV_LOAD_IMB_TOL,massgrav::MASSGRAV_SPLIT_FIX);
+                unsigned int (*getWeight)(const ot::TreeNode*) = NULL;
+                if(massgrav::MASSGRAV_USE_MEASURED_LOAD)
+                {
+                    massgrav::setupOctantWeights(m_uiMesh);
+                    getWeight = massgrav::getOctantWeight;
+                }
+                ot::Mesh* newMesh=m_uiMesh->ReMesh(massgrav::MASSGRAV_DENDRO_GRAIN_SZ,massgrav::MASSGRAV_LOAD_IMB_TOL,massgrav::MASSGRAV_SPLIT_FIX,getWeight);
+                if(massgrav::MASSGRAV_USE_MEASURED_LOAD)
+                    massgrav::clearBlockCost();
                 massgrav::timer::t_mesh.stop();
 
                 oldElements=m_uiMesh->getNumLocalMeshElements();
@@ -1532,52 +1475,16 @@ void RK_MASSGRAV::rkSolve()
 
 
                 // performs the inter-grid transfer
-                intergridTransferVars(m_uiPrevVar,newMesh,massgrav::MASSGRAV_USE_FD_GRID_TRANSFER);
-
-                for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-                {
-                    delete [] m_uiVar[index];
-                    delete [] m_uiVarIm[index];
-                    delete [] m_uiUnzipVar[index];
-                    delete [] m_uiUnzipVarRHS[index];
-
-                    m_uiVar[index]=NULL;
-                    m_uiVarIm[index]=NULL;
-                    m_uiUnzipVar[index]=NULL;
-                    m_uiUnzipVarRHS[index]=NULL;
-
-                    m_uiVar[index]=newMesh->createVector<DendroScalar>();
-                    m_uiVarIm[index]=newMesh->createVector<DendroScalar>();
-                    m_uiUnzipVar[index]=newMesh->createUnZippedVector<DendroScalar>();
-                    m_uiUnzipVarRHS[index]=newMesh->createUnZippedVector<DendroScalar>();
-
-
-                }
-
-                for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-                    for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-                    {
-                        delete [] m_uiStage[stage][index];
-                        m_uiStage[stage][index]=NULL;
-                        m_uiStage[stage][index]=newMesh->createVector<DendroScalar>();
-                    }
-
-                // deallocate constraint vars allocate them for the new mesh.
-                for(unsigned int index=0; index<massgrav::MASSGRAV_CONSTRAINT_NUM_VARS; index++)
-                {
-                    delete [] m_uiConstraintVars[index];
-                    delete [] m_uiUnzipConstraintVars[index];
-
-                    m_uiConstraintVars[index]=newMesh->createVector<DendroScalar>();
-                    m_uiUnzipConstraintVars[index]=newMesh->createUnZippedVector<DendroScalar>();
-
-                }
-
+                intergridTransferVars(m_uiPrevVarFS,m_uiVarFS,newMesh,massgrav::MASSGRAV_USE_FD_GRID_TRANSFER);
 
+                // reallocates the vars for the new mesh (only if the new mesh is larger than the current storage).
+                allocateVars(newMesh);
 
 
                 std::swap(newMesh,m_uiMesh);
                 delete newMesh;
+                // the cached pool blocks are sized for the old mesh blocks.
+                mem::get_pool()->purge();
 
                 if(m_uiCurrentStep == 0)
                     applyInitialConditions(m_uiPrevVar);
@@ -1707,6 +1614,7 @@ void RK_MASSGRAV::rkSolve()
         #endif
 
 
+        m_uiVarFS.swap(m_uiPrevVarFS);
         std::swap(m_uiVar,m_uiPrevVar);
         //massgrav::artificial_dissipation(m_uiMesh,m_uiPrevVar,massgrav::MASSGRAV_NUM_VARS,massgrav::MASSGRAV_DISSIPATION_NC,massgrav::MASSGRAV_DISSIPATION_S,false);
         //if(m_uiCurrentStep==1) break;
@@ -1970,39 +1878,7 @@ void RK_MASSGRAV::restoreCheckPoint(const char * fNamePrefix,MPI_Comm comm)
 
         newMesh=new ot::Mesh(octree,1,m_uiOrder,activeCommSz,m_uiComm);
 
-        for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-        {
-            delete [] m_uiPrevVar[index];
-            delete [] m_uiVar[index];
-            delete [] m_uiVarIm[index];
-            delete [] m_uiUnzipVar[index];
-            delete [] m_uiUnzipVarRHS[index];
-
-            m_uiPrevVar[index]=newMesh->createVector<DendroScalar>();
-            m_uiVar[index]=newMesh->createVector<DendroScalar>();
-            m_uiVarIm[index]=newMesh->createVector<DendroScalar>();
-            m_uiUnzipVar[index]=newMesh->createUnZippedVector<DendroScalar>();
-            m_uiUnzipVarRHS[index]=newMesh->createUnZippedVector<DendroScalar>();
-
-        }
-
-        for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-            for(unsigned int index=0; index<massgrav::MASSGRAV_NUM_VARS; index++)
-            {
-                delete [] m_uiStage[stage][index];
-                m_uiStage[stage][index]=newMesh->createVector<DendroScalar>();
-            }
-
-        // deallocate constraint vars allocate them for the new mesh.
-        for(unsigned int index=0; index<massgrav::MASSGRAV_CONSTRAINT_NUM_VARS; index++)
-        {
-            delete [] m_uiConstraintVars[index];
-            delete [] m_uiUnzipConstraintVars[index];
-
-            m_uiConstraintVars[index]=newMesh->createVector<DendroScalar>();
-            m_uiUnzipConstraintVars[index]=newMesh->createUnZippedVector<DendroScalar>();
-
-        }
+        allocateVars(newMesh);
 
         const char ** varNames=massgrav::MASSGRAV_VAR_NAMES;
 
@@ -14,6 +14,7 @@
 #include "ts.h"
 #include "mesh.h"
 #include "enutsOp.h"
+#include "memory_pool.h"
 
 namespace ts
 {
@@ -34,6 +35,9 @@ namespace ts
 
             unsigned int m_uiSz[3];
 
+            /**@brief: allocated size of m_uiVec (number of T's)*/
+            unsigned int m_uiCapacity = 0;
+
             /**@brief: is block synced and ready to be evolved. */
             bool m_uiIsSynced = false;
 
@@ -59,10 +63,8 @@ namespace ts
             /**@brief: default destructor*/
             ~BlockAsyncVector()
             {
-                if(m_uiVec!=NULL);
-                    delete [] m_uiVec;
-
-                m_uiVec==NULL;
+                mem::get_pool()->free(m_uiVec);
+                m_uiVec=NULL;
                 
             };
             
@@ -86,10 +88,12 @@ namespace ts
                 if(NN==0)
                 {
                     m_uiVec=NULL;
+                    m_uiCapacity=0;
                     return;
                 }
 
-                m_uiVec = new T [m_uiDof * NN ];
+                m_uiVec = mem::get_pool()->allocate_n<T>(m_uiDof * NN);
+                m_uiCapacity = m_uiDof * NN;
 
                 return;
 
@@ -103,9 +107,23 @@ namespace ts
                 m_uiBlkID = LOOK_UP_TABLE_DEFAULT;
                 m_uiIsSynced = false;
         
-                delete [] m_uiVec;
+                mem::get_pool()->free(m_uiVec);
                 m_uiVec=NULL;
+                m_uiCapacity=0;
+
+            }
 
+            /**
+             * @brief reuse the allocated buffer for the block blk (no allocation). 
+             * @param blk : block id
+             * @param sz  : size of the block x,y,z, dof*sz[0]*sz[1]*sz[2] should not exceed the allocated size. 
+             */
+            void rebind(unsigned int blk, const unsigned int* sz)
+            {
+                assert(m_uiDof*sz[0]*sz[1]*sz[2] <= m_uiCapacity);
+                m_uiBlkID = blk;
+                m_uiSz[0] = sz[0]; m_uiSz[1] = sz[1]; m_uiSz[2] = sz[2]; 
+                m_uiIsSynced = false;
             }
 
             /**
@@ -189,6 +207,26 @@ namespace ts
             }
 
 
+            /**
+             * @brief swaps the buffers (and the state) of two block vectors, no data is copied. 
+             * @param other : BlockAsyncVec to swap with. 
+             */
+            void swap(BlockAsyncVector<T>& other)
+            {
+                std::swap(m_uiBlkID,other.m_uiBlkID);
+                std::swap(m_uiVec,other.m_uiVec);
+                std::swap(m_uiSz[0],other.m_uiSz[0]);
+                std::swap(m_uiSz[1],other.m_uiSz[1]);
+                std::swap(m_uiSz[2],other.m_uiSz[2]);
+                std::swap(m_uiCapacity,other.m_uiCapacity);
+                std::swap(m_uiIsSynced,other.m_uiIsSynced);
+                std::swap(m_uiMode,other.m_uiMode);
+                std::swap(m_uiDof,other.m_uiDof);
+                m_uiSendReq.swap(other.m_uiSendReq);
+                return;
+            }
+
+
             /**
              * @brief perform zip operation for the block
              * @param pMesh : octree Mesh object.
@@ -267,9 +305,10 @@ namespace ts
                 const unsigned int ly   =   blkList[m_uiBlkID].getAllocationSzY();
                 const unsigned int lz   =   blkList[m_uiBlkID].getAllocationSzZ();
 
-                const unsigned int dgSz = pMesh->getAllElements().size() * pMesh->getNumNodesPerElement();
+                const unsigned int nPe  = pMesh->getNumNodesPerElement();
+                const unsigned int dgSz = pMesh->getAllElements().size() * nPe;
         
-
+                // each block writes only to its own elements, so different blocks can be zipped concurrently. 
                 for(unsigned int v=0; v < dof; v++)
                 {
                     for(unsigned int elem = blkList[m_uiBlkID].getLocalElementBegin(); elem < blkList[m_uiBlkID].getLocalElementEnd(); elem++)
@@ -281,7 +320,7 @@ namespace ts
                         for(unsigned int k=0; k < (eOrder+1); k++)
                          for(unsigned int j=0; j < (eOrder+1); j++)
                           for(unsigned int i=0; i < (eOrder+1); i++)
-                            dgVec[ v*dgSz + k*(eOrder+1)*(eOrder+1) +  j*(eOrder+1) + i] = m_uiVec[v*lx*ly*lz  + (ek*eOrder+k+paddWidth)*(ly*lx)+(ej*eOrder+j+paddWidth)*(lx)+(ei*eOrder+i+paddWidth)];
+                            dgVec[ v*dgSz + elem*nPe + k*(eOrder+1)*(eOrder+1) +  j*(eOrder+1) + i] = m_uiVec[v*lx*ly*lz  + (ek*eOrder+k+paddWidth)*(ly*lx)+(ej*eOrder+j+paddWidth)*(lx)+(ei*eOrder+i+paddWidth)];
                     }
                 
                 }
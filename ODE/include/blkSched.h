@@ -0,0 +1,129 @@
+/**
+ * @file blkSched.h
+ * @brief Dependency driven task scheduler for the block wise time steppers.
+ * A task (e.g. the rhs of a block for a stage) is released when all of its predecessors are completed, predecessors are other
+ * tasks or external events such as the completion of a ghost exchange. Released tasks run as OpenMP tasks (work stealing
+ * runtime). The master thread acts as the progress thread, it polls the events and runs the master tasks (MPI calls, non
+ * thread safe work), hence MPI_THREAD_FUNNELED is sufficient.
+ * @version 0.1
+ *
+ * School of Computing, University of Utah.
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#include <vector>
+#include <functional>
+#include <assert.h>
+#include <omp.h>
+#include "mesh.h"
+
+namespace ts
+{
+    /**@brief: BLK_TASK_ANY : runs on any thread, BLK_TASK_MASTER : runs on the master thread, BLK_TASK_EVENT : polled by the master thread */
+    enum BLK_TASK_TYPE{BLK_TASK_ANY=0, BLK_TASK_MASTER, BLK_TASK_EVENT};
+
+    class BlkTaskGraph
+    {
+        protected:
+
+            struct BlkTask
+            {
+                /**@brief: task work (for events, executed on the master after the test returns true)*/
+                std::function<void()> work;
+
+                /**@brief: event test, returns true when the event is completed */
+                std::function<bool()> test;
+
+                /**@brief: task type */
+                BLK_TASK_TYPE type;
+
+                /**@brief: successor tasks */
+                std::vector<unsigned int> succ;
+
+                /**@brief: number of predecessors */
+                unsigned int numDep;
+            };
+
+            /**@brief: task list */
+            std::vector<BlkTask> m_uiTasks;
+
+            /**@brief: remaining predecessors of each task (during execute)*/
+            std::vector<unsigned int> m_uiDepCount;
+
+            /**@brief: released master tasks and events, waiting for the master thread */
+            std::vector<unsigned int> m_uiMasterReady;
+
+            /**@brief: number of tasks not completed (during execute)*/
+            unsigned int m_uiNumPending = 0;
+
+            /**@brief: number of threads executing the graph*/
+            unsigned int m_uiNumThreads = 1;
+
+        protected:
+            /**@brief: task i is ready, spawn it or hand it to the master. */
+            void release(unsigned int i);
+
+            /**@brief: runs the task i and completes it. */
+            void run(unsigned int i);
+
+            /**@brief: task i is done, release the successors with no remaining predecessors. */
+            void complete(unsigned int i);
+
+            /**@brief: master progress loop, runs until all the tasks are completed. */
+            void progress();
+
+        public:
+            BlkTaskGraph(){};
+
+            ~BlkTaskGraph(){};
+
+            /**
+             * @brief adds a task
+             * @param work : task work
+             * @param type : BLK_TASK_ANY or BLK_TASK_MASTER
+             * @return task id
+             */
+            unsigned int add_task(const std::function<void()>& work, BLK_TASK_TYPE type = BLK_TASK_ANY);
+
+            /**
+             * @brief adds an external event, polled by the master thread once all its predecessors are completed.
+             * @param test : returns true when the event is completed (should not block)
+             * @param work : executed on the master once the test succeeds (can be empty)
+             * @return task id
+             */
+            unsigned int add_event(const std::function<bool()>& test, const std::function<void()>& work = std::function<void()>());
+
+            /**@brief: task after cannot start before task before is completed. */
+            void add_dependency(unsigned int before, unsigned int after);
+
+            /**@brief: executes all the tasks, should be called outside of a parallel region. Returns when all the tasks are completed. */
+            void execute();
+
+            /**@brief: remove all the tasks. */
+            void clear();
+
+            /**@brief: number of tasks*/
+            inline unsigned int size() const { return m_uiTasks.size(); }
+
+    };
+
+    /**
+     * @brief computes the data dependencies of the local blocks, i.e. the blocks (and ghost elements) that intersect the padding region
+     * of a block. The neighbours of block b are nbr[nbrOffset[b] : nbrOffset[b+1]) (b not included), isGhostDep[b] is 1 if any ghost element
+     * intersects the padding region of b.
+     * @param pMesh : mesh
+     * @param nbrOffset : (out) neighbour offsets (size numBlocks + 1)
+     * @param nbr : (out) neighbour block ids
+     * @param isGhostDep : (out) ghost dependency flag of each block
+     */
+    void compute_blk_dependencies(const ot::Mesh* pMesh, std::vector<unsigned int>& nbrOffset, std::vector<unsigned int>& nbr, std::vector<unsigned int>& isGhostDep);
+
+    /**
+     * @brief true if the unzip of a block only reads the zipped vector and writes the padded block, i.e. the block unzips can run 
+     * concurrently. The unzip with the special points (order 4, padding width 3) communicates and writes the points of all the blocks. 
+     * @param pMesh : mesh
+     */
+    bool is_blk_unzip_local(const ot::Mesh* pMesh);
+
+}// end of namespace ts
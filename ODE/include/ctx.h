@@ -15,6 +15,7 @@
  #include <vector>
  #include <iostream>
  #include "dvec.h"
+ #include "memory_pool.h"
  #include "ts.h"
  #include <functional>
 
@@ -85,6 +86,9 @@ namespace ts
             
             /**@brief: returns the time stamp info, related to ets*/
             inline ts::TSInfo get_ts_info() const {return m_uiTinfo; }
+
+            /**@brief: sets the current time step size (used by the adaptive time steppers)*/
+            inline void set_ts_size(T dt) { m_uiTinfo._m_uiTh = dt; }
             
             /**@breif: returns the ETS synced status*/
             inline bool is_ets_synced() const { return m_uiIsETSSynced;} 
@@ -101,7 +105,7 @@ namespace ts
              * @param [in] sz: number of in and out vectors (dof)
              * @param [in] time : current time at the evolution. 
             */
-            virtual int rhs(ot::DVector<T,I>* in , ot::DVector<T,I>* out, unsigned int sz , T time) {return 0;};
+            virtual int rhs(ot::DVectorView<T,I>* in , ot::DVectorView<T,I>* out, unsigned int sz , T time) {return 0;};
 
             /**
              * @brief block wise RHS. 
@@ -113,7 +117,7 @@ namespace ts
              * @param blk_time : block time  corresponding to the block ids. 
              * @return int 
              */
-            virtual int rhs_blkwise(ot::DVector<T,I> in , ot::DVector<T,I> out, const unsigned int* const blkIDs, unsigned int numIds, T*  blk_time) const {return 0;}
+            virtual int rhs_blkwise(ot::DVectorView<T,I> in , ot::DVectorView<T,I> out, const unsigned int* const blkIDs, unsigned int numIds, T*  blk_time) const {return 0;}
 
             /**
              * @brief compute the block for the rhs. 
@@ -126,6 +130,9 @@ namespace ts
              */
             virtual int rhs_blk(const T* in, T* out, unsigned int dof, unsigned int local_blk_id, T  blk_time) const {return 0;};
 
+            /**@brief: returns true if rhs_blk can be called concurrently for different blocks (i.e. no shared work space). */
+            virtual bool is_rhs_blk_thread_safe() const {return false;}
+
             /**@brief: compute constraints. */
             virtual int compute_constraints() {return 0;}
 
@@ -135,18 +142,18 @@ namespace ts
             /**@brief: function execute before each stage
              * @param sIn: stage var in. 
             */
-            virtual int pre_stage(ot::DVector<T,I> sIn)  {return 0;}; 
+            virtual int pre_stage(ot::DVectorView<T,I> sIn)  {return 0;}; 
 
             /**@brief: function execute after each stage
              * @param sIn: stage var in. 
             */
-            virtual int post_stage(ot::DVector<T,I> sIn)  {return 0;};
+            virtual int post_stage(ot::DVectorView<T,I> sIn)  {return 0;};
 
             /**@brief: function execute before each step*/
-            virtual int pre_timestep(ot::DVector<T,I> sIn) {return 0;}; 
+            virtual int pre_timestep(ot::DVectorView<T,I> sIn) {return 0;}; 
 
             /**@brief: function execute after each step*/
-            virtual int post_timestep(ot::DVector<T,I> sIn) {return 0;};
+            virtual int post_timestep(ot::DVectorView<T,I> sIn) {return 0;};
 
             
             /**@brief: function execute after each step*/
@@ -161,9 +168,11 @@ namespace ts
              * @param transferEvolution : if true transform the evolution variales. 
              * @param transferConstraint : if true transform the constraint variables. 
              * @param transferPrimitive : if true transform the primitive variables. 
+             * @param getWeight : octant weight function used for the partition of the new mesh (NULL for uniform weights). 
+             * @param getConstraint : octant constraint (time level) function, if not NULL each constraint is partitioned separately. 
              * @return int : return 0 if success. 
              */
-            virtual int remesh(unsigned int grain_sz = DENDRO_DEFAULT_GRAIN_SZ, double ld_tol = DENDRO_DEFAULT_LB_TOL, unsigned int sf_k = DENDRO_DEFAULT_SF_K ,bool transferEvolution = true, bool transferConstraint = false, bool transferPrimitive = false ); 
+            virtual int remesh(unsigned int grain_sz = DENDRO_DEFAULT_GRAIN_SZ, double ld_tol = DENDRO_DEFAULT_LB_TOL, unsigned int sf_k = DENDRO_DEFAULT_SF_K ,bool transferEvolution = true, bool transferConstraint = false, bool transferPrimitive = false, unsigned int (*getWeight)(const ot::TreeNode *)=NULL, unsigned int (*getConstraint)(const ot::TreeNode *)=NULL ); 
 
             /**
              * @brief performs intergrid transfer for a given mesh variable. 
@@ -188,19 +197,19 @@ namespace ts
             /**@brief: should be called for free up the contex memory. */
             virtual int finalize() {return 0;};
 
-            /**@brief: Add variables to the time stepper*/
-            virtual ot::DVector<T,I> create_vec(CTXVType type, bool isGhosted = false, bool isUnzip =false, bool isElemental = false, unsigned int dof=1);
+            /**@brief: Add variables to the time stepper, the contex owns the vector and returns a view of it. */
+            virtual ot::DVectorView<T,I> create_vec(CTXVType type, bool isGhosted = false, bool isUnzip =false, bool isElemental = false, unsigned int dof=1);
 
             /**@brief: destroy a vector 
              * @param vec: DVector object 
              * @param type: DVector type. 
             */
-            virtual void destroy_vec(ot::DVector<T,I>& vec, CTXVType type);
+            virtual void destroy_vec(const ot::DVectorView<T,I>& vec, CTXVType type);
 
             /**@brief: destroy vector 
              * @param vec: DVector object
             */
-            virtual void destroy_vec(ot::DVector<T,I>& vec);
+            virtual void destroy_vec(const ot::DVectorView<T,I>& vec);
 
             /**
              * @brief performs unzip operation, 
@@ -209,7 +218,7 @@ namespace ts
              * @param out : output unzip vector. 
              * @param async_k : async communicator. 
              */
-            virtual void unzip(ot::DVector<T,I>& in , ot::DVector<T,I>& out, unsigned int async_k = 1);
+            virtual void unzip(ot::DVectorView<T,I> in , ot::DVectorView<T,I> out, unsigned int async_k = 1);
 
             /**
              * @brief performs zip operation
@@ -217,16 +226,16 @@ namespace ts
              * @param in : unzip vector
              * @param out : zip vector. 
              */
-            virtual void zip(ot::DVector<T,I>& in , ot::DVector<T,I>& out, unsigned int async_k = 1);
+            virtual void zip(ot::DVectorView<T,I> in , ot::DVectorView<T,I> out, unsigned int async_k = 1);
 
             /**@brief: pack and returns the evolution variables to one DVector*/
-            virtual ot::DVector<T,I> get_evolution_vars() { ot::DVector<T,I> tmp; return tmp; };
+            virtual ot::DVectorView<T,I> get_evolution_vars() { return ot::DVectorView<T,I>(); };
 
             /**@brief: pack and returns the constraint variables to one DVector*/
-            virtual ot::DVector<T,I> get_constraint_vars(){ ot::DVector<T,I> tmp; return tmp; };
+            virtual ot::DVectorView<T,I> get_constraint_vars(){ return ot::DVectorView<T,I>(); };
 
             /**@brief: pack and returns the primitive variables to one DVector*/
-            virtual ot::DVector<T,I> get_primitive_vars(){ ot::DVector<T,I> tmp; return tmp; };
+            virtual ot::DVectorView<T,I> get_primitive_vars(){ return ot::DVectorView<T,I>(); };
 
             /**@brief: updates the time step information. */
             virtual int increment_ts_info();
@@ -244,23 +253,24 @@ namespace ts
     };
 
     template<typename T, typename I>
-    ot::DVector<T,I> Ctx<T,I>::create_vec(CTXVType type, bool isGhosted, bool isUnzip, bool isElemental, unsigned int dof)
+    ot::DVectorView<T,I> Ctx<T,I>::create_vec(CTXVType type, bool isGhosted, bool isUnzip, bool isElemental, unsigned int dof)
     {
         ot::DVector<T,I> tmp;
         tmp.VecCreate(m_uiMesh,isGhosted,isUnzip,isElemental,dof);
+        const ot::DVectorView<T,I> view = tmp;
 
         if(type == CTXVType::EVOLUTION)
-            (isUnzip) ? m_uiEvolutionUnzipVar.push_back(tmp) : m_uiEvolutionVar.push_back(tmp);
+            (isUnzip) ? m_uiEvolutionUnzipVar.push_back(std::move(tmp)) : m_uiEvolutionVar.push_back(std::move(tmp));
         else if(type == CTXVType::CONSTRAINT)
-            (isUnzip) ? m_uiConstraintUnzipVar.push_back(tmp) : m_uiConstrainedVar.push_back(tmp);
+            (isUnzip) ? m_uiConstraintUnzipVar.push_back(std::move(tmp)) : m_uiConstrainedVar.push_back(std::move(tmp));
         else if(type == CTXVType::PRIMITIVE)
-            (isUnzip) ? m_uiPrimitiveUnzipVar.push_back(tmp) : m_uiPrimitiveVar.push_back(tmp);
+            (isUnzip) ? m_uiPrimitiveUnzipVar.push_back(std::move(tmp)) : m_uiPrimitiveVar.push_back(std::move(tmp));
         
-        return tmp;
+        return view;
     }
 
     template<typename T,typename I>
-    void Ctx<T,I>::destroy_vec(ot::DVector<T,I>& vec, CTXVType type)
+    void Ctx<T,I>::destroy_vec(const ot::DVectorView<T,I>& vec, CTXVType type)
     {
         int index=-1;
         if(type == CTXVType::EVOLUTION)
@@ -313,7 +323,7 @@ namespace ts
 
 
     template<typename T,typename I>
-    void Ctx<T,I>::destroy_vec(ot::DVector<T,I>& vec)
+    void Ctx<T,I>::destroy_vec(const ot::DVectorView<T,I>& vec)
     {
         int index=-1;
         
@@ -359,7 +369,7 @@ namespace ts
     }
     
     template<typename T, typename I>
-    void Ctx<T,I>::unzip(ot::DVector<T,I>& in , ot::DVector<T,I>& out, unsigned int async_k)
+    void Ctx<T,I>::unzip(ot::DVectorView<T,I> in , ot::DVectorView<T,I> out, unsigned int async_k)
     {
         
         assert( (in.IsUnzip() == false) && (in.GetDof()== out.GetDof()) && (out.IsUnzip()==true) && (in.IsGhosted()==true) && async_k <= in.GetDof());
@@ -401,7 +411,7 @@ namespace ts
 
 
     template<typename T, typename I>
-    void Ctx<T,I>::zip(ot::DVector<T,I>& in , ot::DVector<T,I>& out, unsigned int async_k)
+    void Ctx<T,I>::zip(ot::DVectorView<T,I> in , ot::DVectorView<T,I> out, unsigned int async_k)
     {
         assert( (in.IsUnzip() == true) && (in.GetDof()== out.GetDof()) && (out.IsUnzip()==false) && (out.IsGhosted()==true));
         const unsigned int dof = in.GetDof();
@@ -442,7 +452,7 @@ namespace ts
 
     
     template<typename T,typename I>
-    int Ctx<T,I>::remesh(unsigned int grain_sz, double ld_tol, unsigned int sf_k, bool transferEvolution, bool transferConstraint, bool transferPrimitive)
+    int Ctx<T,I>::remesh(unsigned int grain_sz, double ld_tol, unsigned int sf_k, bool transferEvolution, bool transferConstraint, bool transferPrimitive, unsigned int (*getWeight)(const ot::TreeNode *), unsigned int (*getConstraint)(const ot::TreeNode *))
     {
         #ifdef DEBUG_IS_REMESH
             unsigned int rank=m_uiMesh->getMPIRankGlobal();
@@ -507,7 +517,7 @@ namespace ts
 
         #endif
         
-        ot::Mesh* newMesh=m_uiMesh->ReMesh(grain_sz,ld_tol,sf_k);
+        ot::Mesh* newMesh=m_uiMesh->ReMesh(grain_sz,ld_tol,sf_k,getWeight,getConstraint);
         
         DendroIntL oldElements=m_uiMesh->getNumLocalMeshElements();
         DendroIntL newElements=newMesh->getNumLocalMeshElements();
@@ -526,6 +536,8 @@ namespace ts
 
         std::swap(newMesh,m_uiMesh);
         delete newMesh;
+        // the cached pool blocks are sized for the old mesh blocks.
+        mem::get_pool()->purge();
 
         m_uiIsETSSynced = false;
 
@@ -554,42 +566,42 @@ namespace ts
         {
             ot::DVector < T,I > v1;
             v1.VecCreate(newMesh,m_uiEvolutionVar[i].IsGhosted(),m_uiEvolutionVar[i].IsUnzip(), m_uiEvolutionVar[i].IsElemental(),m_uiEvolutionVar[i].GetDof());
-            eVars.push_back(v1);
+            eVars.push_back(std::move(v1));
         }
 
         for(unsigned int i=0; i< m_uiConstrainedVar.size(); i++)
         {
             ot::DVector < T,I > v1;
             v1.VecCreate(newMesh,m_uiConstrainedVar[i].IsGhosted(),m_uiConstrainedVar[i].IsUnzip(), m_uiConstrainedVar[i].IsElemental(),m_uiConstrainedVar[i].GetDof());
-            cVars.push_back(v1);
+            cVars.push_back(std::move(v1));
         }
 
         for(unsigned int i=0; i< m_uiPrimitiveVar.size(); i++)
         {
             ot::DVector < T,I > v1;
             v1.VecCreate(newMesh,m_uiPrimitiveVar[i].IsGhosted(),m_uiPrimitiveVar[i].IsUnzip(), m_uiPrimitiveVar[i].IsElemental(),m_uiPrimitiveVar[i].GetDof());
-            pVars.push_back(v1);
+            pVars.push_back(std::move(v1));
         }
 
         for(unsigned int i=0; i< m_uiEvolutionUnzipVar.size(); i++)
         {
             ot::DVector < T,I > v1;
             v1.VecCreate(newMesh,m_uiEvolutionUnzipVar[i].IsGhosted(),m_uiEvolutionUnzipVar[i].IsUnzip(), m_uiEvolutionUnzipVar[i].IsElemental(),m_uiEvolutionUnzipVar[i].GetDof());
-            eVarsUnzip.push_back(v1);
+            eVarsUnzip.push_back(std::move(v1));
         }
 
         for(unsigned int i=0; i< m_uiConstraintUnzipVar.size(); i++)
         {
             ot::DVector < T,I > v1;
             v1.VecCreate(newMesh,m_uiConstraintUnzipVar[i].IsGhosted(),m_uiConstraintUnzipVar[i].IsUnzip(), m_uiConstraintUnzipVar[i].IsElemental(),m_uiConstraintUnzipVar[i].GetDof());
-            cVarsUnzip.push_back(v1);
+            cVarsUnzip.push_back(std::move(v1));
         }
 
         for(unsigned int i=0; i< m_uiPrimitiveUnzipVar.size(); i++)
         {
             ot::DVector < T,I > v1;
             v1.VecCreate(newMesh,m_uiPrimitiveUnzipVar[i].IsGhosted(),m_uiPrimitiveUnzipVar[i].IsUnzip(), m_uiPrimitiveUnzipVar[i].IsElemental(),m_uiPrimitiveUnzipVar[i].GetDof());
-            pVarsUnzip.push_back(v1);
+            pVarsUnzip.push_back(std::move(v1));
         }
 
 
@@ -21,6 +21,8 @@
 #include "oct2vtk.h"
 #include <iostream>
 #include "blkAsync.h"
+#include <algorithm>
+#include <omp.h>
 
 namespace ts
 {   
@@ -36,13 +38,11 @@ namespace ts
     {
 
         public:
-            /**@brief: ets stages
-             * stage 0    : input vector
-             * stage 1    : ets stage 1
-             *            .
-             *            .
-             * stage p    : ets stage p
-             * stage p+1  : output vector
+            /**@brief: block registers (with padding)
+             * 0    : input vector (block state)
+             * 1    : output vector (stage input / new state)
+             * The stages are not stored per block, they are kept element wise in the DG stage vectors and the 
+             * stage padding is reconstructed on demand (see ExplicitNUTS::sync_blk_timestep). 
             */
             std::vector< BlockAsyncVector<T> > _vec;
 
@@ -66,6 +66,9 @@ namespace ts
                     _vec[k].createVec(blkid,sz, false, BLK_ASYNC_VEC_MODE::BLK_UNZIP, dof);
             }
 
+            /**@brief: rotate the buffers of the registers i and j (no copy). */
+            inline void swap_vec(unsigned int i, unsigned int j) { _vec[i].swap(_vec[j]); }
+
             /**
              * @brief deallocate the vectors. 
              */
@@ -102,6 +105,10 @@ namespace ts
         using ETS<T,Ctx>::m_uiBi;
         using ETS<T,Ctx>::m_uiCi;
         using ETS<T,Ctx>::m_uiType;
+        using ETS<T,Ctx>::m_uiBlkGraph;
+        using ETS<T,Ctx>::m_uiBlkNbrOffset;
+        using ETS<T,Ctx>::m_uiBlkNbr;
+        using ETS<T,Ctx>::m_uiBlkGhostDep;
         
         protected:
 
@@ -123,12 +130,21 @@ namespace ts
             /**@brief: List of block async vector. */
             std::vector<ts::BlockTimeStep<T>> m_uiBVec;
 
+            /**@brief: rhs output block vector for each thread (sized for the largest block) */
+            std::vector<ts::BlockAsyncVector<T>> m_uiBOut;
+
+            /**@brief: DG work vector (single variable) for the corrected stages */
+            DVec m_uiStageDG;
+
             /**@brief : keep track of the element time. */
             std::vector<unsigned int> m_uiEleTime;
 
             /**@brief: explicit timer interpolation operators for ENUTS */
             ENUTSOp* m_uiECOp = NULL;
 
+            /**@brief: level restricted DG ghost exchange for the stage vectors */
+            ot::SubScatterMapEleDG* m_uiEleDGSM = NULL;
+
 
         private:
 
@@ -149,9 +165,22 @@ namespace ts
             /**@brief: Deallocate internal variables. */
             virtual int deallocate_internal_vars(); 
 
-            virtual void sync_blk_timestep(unsigned int blk, unsigned int rk_s);
+            /**
+             * @brief: computes the padded block vector _vec[out] = _vec[0] + sum_{s=1}^{n} c[s-1] K_s, where the stage K_s is reconstructed
+             * (with padding) from the DG stage vectors, with the coarse/fine time corrections applied to the neighbour elements. 
+             * @param blk : local block id
+             * @param out : output register of the block
+             * @param c   : stage coefficients (size n)
+             * @param n   : number of stages
+             */
+            virtual void sync_blk_timestep(unsigned int blk, unsigned int out, const DendroScalar* c, unsigned int n);
 
-            virtual void update_ele_timestep();
+            /**
+             * @brief: computes the element times (in finest dt units) at the start of the sub step pt. 
+             * An element of level l advances by 2^(lmax-l) at the sub steps divisible by it, so the time follows from the level 
+             * and pt. Ghost element times are computed from the ghost levels, hence no communication. 
+             */
+            virtual void update_ele_timestep(unsigned int pt);
 
 
             
@@ -185,11 +214,31 @@ namespace ts
             /**@brief returns the dt max value */
             T get_dt_max() const { return m_uiTimeInfo._m_uiTh*(1u<<(m_uiLevMax-m_uiLevMin)); }
 
-            /**@brief: prints the load balance statistis*/
+            /**@brief: prints the load balance statistis (min, mean, max over the active procs. of the rhs evaluations per coarse step and the element counts of each time level). Collective on the active comm. */
             void  dump_load_statistics(std::ostream & sout) const ;
+
+            /**
+             * @brief: partition weight of an octant, the number of rhs evaluations per coarse step, 2^(l-lmin) for an octant of level l. 
+             * To be passed as getWeight to Ctx::remesh / Mesh::ReMesh. lmin is the min. level of the last initialized ENUTS. 
+             */
+            static unsigned int get_octant_weight(const ot::TreeNode* pNode)
+            {
+                const unsigned int l = pNode->getLevel();
+                return 1u<<( (l > m_uiPartLevMin) ? (l - m_uiPartLevMin) : 0);
+            }
+
+            /**@brief: octant time level constraint (the octant level), pass as getConstraint to Ctx::remesh / Mesh::ReMesh to balance each time level separately.*/
+            static unsigned int get_octant_level_constraint(const ot::TreeNode* pNode) { return pNode->getLevel(); }
+
+        private:
+            /**@brief: min. level used by get_octant_weight*/
+            static unsigned int m_uiPartLevMin;
         
     };
 
+    template<typename T, typename Ctx>
+    unsigned int ExplicitNUTS<T,Ctx>::m_uiPartLevMin = 0;
+
     template<typename T, typename Ctx>
     ExplicitNUTS<T,Ctx>::ExplicitNUTS(Ctx* ctx) : ETS<T,Ctx>(ctx)
     {
@@ -217,6 +266,7 @@ namespace ts
         par::Mpi_Bcast(&m_uiLevMin,1,0,pMesh->getMPIGlobalCommunicator());
         par::Mpi_Bcast(&m_uiLevMax,1,0,pMesh->getMPIGlobalCommunicator());
         assert( (m_uiLevMin > 0 ) && (m_uiLevMax <= m_uiMaxDepth) );
+        m_uiPartLevMin = m_uiLevMin;
         
         
 
@@ -250,6 +300,7 @@ namespace ts
 
         m_uiEvarUzip.VecCreate(m_uiAppCtx->get_mesh(), false , true, false ,m_uiEVar.GetDof());
         m_uiEvarDG.VecCreateDG(m_uiAppCtx->get_mesh(), true, m_uiEVar.GetDof());
+        m_uiStageDG.VecCreateDG(m_uiAppCtx->get_mesh(), true, 1);
 
         const ot::Mesh* pMesh = m_uiAppCtx->get_mesh();
         if(pMesh->isActive())
@@ -258,15 +309,28 @@ namespace ts
             std::vector<ot::Block> blkList = pMesh->getLocalBlockList();
             m_uiBVec.resize(blkList.size());
 
+            unsigned int maxBlk = 0;
+            unsigned int szMax[3] = {0, 1, 1};
             for(unsigned int blk =0; blk < blkList.size(); blk++)
             {
                 const unsigned int sz[3] = { blkList[blk].getAllocationSzX(), blkList[blk].getAllocationSzY(), blkList[blk].getAllocationSzZ()};
-                m_uiBVec[blk].alloc_vec(m_uiNumStages+2, blk, sz, DOF);
+                m_uiBVec[blk].alloc_vec(2, blk, sz, DOF);
+                if(sz[0]*sz[1]*sz[2] > szMax[0])
+                {
+                    maxBlk = blk;
+                    szMax[0] = sz[0]*sz[1]*sz[2];
+                }
             }
 
+            m_uiBOut.resize(omp_get_max_threads());
+            for(unsigned int t=0; t < m_uiBOut.size(); t++)
+                m_uiBOut[t].createVec(maxBlk, szMax, false, BLK_ASYNC_VEC_MODE::BLK_UNZIP, DOF);
+
         }
 
         m_uiECOp = new ENUTSOp(m_uiType);
+        m_uiEleDGSM = new ot::SubScatterMapEleDG(pMesh);
+        this->allocate_blk_sched(false);
         return 0;
 
         
@@ -286,6 +350,7 @@ namespace ts
 
         m_uiEvarUzip.VecDestroy();
         m_uiEvarDG.VecDestroy();
+        m_uiStageDG.VecDestroy();
 
 
         for(unsigned int k=0; k < m_uiBVec.size(); k++)
@@ -298,7 +363,18 @@ namespace ts
         
         m_uiBVec.clear();
 
+        for(unsigned int t=0; t < m_uiBOut.size(); t++)
+            m_uiBOut[t].destroyVec();
+
+        m_uiBOut.clear();
+
         delete m_uiECOp;
+        m_uiECOp = NULL;
+
+        delete m_uiEleDGSM;
+        m_uiEleDGSM = NULL;
+
+        this->deallocate_blk_sched();
         return 0;
 
     }
@@ -335,14 +411,15 @@ namespace ts
 
 
     template<typename T, typename Ctx>
-    void ExplicitNUTS<T,Ctx>::sync_blk_timestep(unsigned int blk, unsigned int rk_s)
+    void ExplicitNUTS<T,Ctx>::sync_blk_timestep(unsigned int blk, unsigned int out, const DendroScalar* c, unsigned int n)
     {
 
        
         ot::Mesh* pMesh = (ot::Mesh*)m_uiAppCtx->get_mesh();
-        assert(rk_s>=1 && rk_s <= m_uiNumStages);
+        assert(n>=1 && n <= m_uiNumStages);
+        assert(out > 0 && out < m_uiBVec[blk]._vec.size());
         
-        if((!(pMesh->isActive())) || m_uiBVec[blk]._vec[rk_s].isSynced() )
+        if(!(pMesh->isActive()))
             return;
 
         const unsigned int * etVec = m_uiEleTime.data();
@@ -357,7 +434,6 @@ namespace ts
         const unsigned int paddWidth =   blkList[blk].get1DPadWidth();
 
         assert(paddWidth>0);
-        assert(rk_s>=1);
         
         const unsigned int lx     =  blkList[blk].getAllocationSzX();
         const unsigned int ly     =  blkList[blk].getAllocationSzY();
@@ -389,13 +465,14 @@ namespace ts
         const unsigned int dof = m_uiEVar.GetDof();
 
         std::vector<T> cVec;
-        cVec.resize(nPe*rk_s);
+        cVec.resize(nPe*n);
 
-        T* sV[rk_s];    // stage pointer for each variable v. 
-        T* cVin[rk_s];  // correction vec. pointer in,
-        T* cVout[rk_s]; // correction vec. pointer out,
+        T* sV[n];    // stage pointer for each variable v. 
+        T* cVin[n];  // correction vec. pointer in,
+        T* cVout[n]; // correction vec. pointer out,
 
         T * dgWVec = m_uiEvarDG.GetVecArray();
+        T * dgStageWVec = m_uiStageDG.GetVecArray();
         T * cgWVec = m_uiEVecTmp[0].GetVecArray();
         T * uzWVec = m_uiEvarUzip.GetVecArray();
         T * dgStages[m_uiNumStages];
@@ -409,498 +486,707 @@ namespace ts
         for(unsigned int i=0; i < m_uiNumStages; i++)
             dgStages[i] = m_uiStVec[i].GetVecArray();
 
-        T * m_uiVec = ( T *) m_uiBVec[blk]._vec[rk_s].data();
-        
+        T * m_uiVec = ( T *) m_uiBVec[blk]._vec[out].data();
+        const T * uVec = m_uiBVec[blk]._vec[0].data();
+
+        std::vector<unsigned int> unzipEids;    
+        std::vector<unsigned int> accEids;    
+        unzipEids.reserve(4*blkList[blk].getElemSz1D() * blkList[blk].getElemSz1D()* blkList[blk].getElemSz1D());
+        accEids.reserve(unzipEids.capacity());
         
         for(unsigned int v = 0; v < dof; v++)
         {
             T * vVec = m_uiVec + v*lx*ly*lz;
-            T * dgV  = dgWVec  + v*dgSz;  
+            const T * uV = uVec + v*lx*ly*lz;
+            T * dgA  = dgWVec  + v*dgSz;  
+            T * dgV  = dgStageWVec; // corrected stage rk_s of the variable v. 
 
             const unsigned int m_uiDof   = 1; //m_uiEVar.GetDof();
             
-            for(unsigned int s=1; s <=rk_s; s++)
+            for(unsigned int s=1; s <=n; s++)
                 sV[s-1] = dgStages[s-1] + v * dgSz;
 
-
-            std::vector<unsigned int> unzipEids;    
-            unzipEids.reserve(4*blkList[blk].getElemSz1D() * blkList[blk].getElemSz1D()* blkList[blk].getElemSz1D());
-
-            for(unsigned int elem = blkList[m_uiBlkID].getLocalElementBegin(); elem < blkList[m_uiBlkID].getLocalElementEnd(); elem++)
+            for(unsigned int rk_s=1; rk_s <=n; rk_s++)
             {
-                const unsigned int ei=(pNodes[elem].getX()-blkNode.getX())>>(m_uiMaxDepth-regLevel);
-                const unsigned int ej=(pNodes[elem].getY()-blkNode.getY())>>(m_uiMaxDepth-regLevel);
-                const unsigned int ek=(pNodes[elem].getZ()-blkNode.getZ())>>(m_uiMaxDepth-regLevel);
-
-                const unsigned int emin = 0;
-                const unsigned int emax = (1u<<(regLevel-blkNode.getLevel()))-1;
-
-                assert(etVec[elem] == bTime );
+                unzipEids.clear();
+                for(unsigned int elem = blkList[m_uiBlkID].getLocalElementBegin(); elem < blkList[m_uiBlkID].getLocalElementEnd(); elem++)
+                {
+                    const unsigned int ei=(pNodes[elem].getX()-blkNode.getX())>>(m_uiMaxDepth-regLevel);
+                    const unsigned int ej=(pNodes[elem].getY()-blkNode.getY())>>(m_uiMaxDepth-regLevel);
+                    const unsigned int ek=(pNodes[elem].getZ()-blkNode.getZ())>>(m_uiMaxDepth-regLevel);
 
-                for(unsigned int node =0; node < nPe; node++)
-                    dgV[elem*nPe + node] = sV[rk_s-1][elem*nPe +  node];
+                    const unsigned int emin = 0;
+                    const unsigned int emax = (1u<<(regLevel-blkNode.getLevel()))-1;
 
+                    assert(etVec[elem] == bTime );
 
-                //std::cout<<"ele  internal coppied "<<std::endl;
-                unzipEids.push_back(elem);
+                    for(unsigned int node =0; node < nPe; node++)
+                        dgV[elem*nPe + node] = sV[rk_s-1][elem*nPe +  node];
 
 
-                // OCT_DIR_LEFT
-                if(ei==emin)
-                { 
-                    const unsigned int dir = OCT_DIR_LEFT;
-                    lookUp = e2e[elem*NUM_FACES + dir];
-                    if(lookUp!=LOOK_UP_TABLE_DEFAULT)
-                    {
-                        
-                        if(pNodes[lookUp].getLevel() == bLev )
-                        {
-                            tl = etVec[lookUp];
-                            unzipEids.push_back(lookUp);
+                    //std::cout<<"ele  internal coppied "<<std::endl;
+                    unzipEids.push_back(elem);
 
-                            assert(bTime == tl);
-                            // no corrections needs to be applied. 
-                            for(unsigned int node =0; node < nPe; node++)
-                                dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
 
-                        }else if(pNodes[lookUp].getLevel() < bLev)
+                    // OCT_DIR_LEFT
+                    if(ei==emin)
+                    { 
+                        const unsigned int dir = OCT_DIR_LEFT;
+                        lookUp = e2e[elem*NUM_FACES + dir];
+                        if(lookUp!=LOOK_UP_TABLE_DEFAULT)
                         {
-
-                            tl = etVec[lookUp];
-                            unzipEids.push_back(lookUp);
-                             // need to do coarser to finer correction. 
-                            for(unsigned int s=1; s <= rk_s; s++ )
-                            {
-                                cVin[s-1]  = &sV[s-1][lookUp*nPe];
-                                cVout[s-1] = cVec.data() + (s-1)*nPe; 
-                            }
-                            
-                            if(tl==bTime)
-                                dt = 0;
-                            else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
-                                dt = dt_c/2.0;
-                            else
+                        
+                            if(pNodes[lookUp].getLevel() == bLev )
                             {
-                                std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                                assert(false); // finer block cannot exceed time of the coarset block. 
-                                MPI_Abort(comm,0);
-                            }
-                                
-                            Op->Ccf(cVout, (const T**)cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
-                            for(unsigned int node =0; node < nPe; node++)
-                                dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
 
-                        }else
-                        {
-                            assert(pNodes[lookUp].getLevel() == bLev +1);
-                            // finner to coaser correction. 
+                                assert(bTime == tl);
+                                // no corrections needs to be applied. 
+                                for(unsigned int node =0; node < nPe; node++)
+                                    dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
 
-                            pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
-                            assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
-                            unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
-                            tl = etVec[fchild[0]];
-                            if(tl==bTime)
-                                dt = 0;
-                            else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
-                                dt = dt_c/2.0;
-                            else
+                            }else if(pNodes[lookUp].getLevel() < bLev)
                             {
-                                std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                                assert(false); // finer block cannot exceed time of the coarset block. 
-                                MPI_Abort(comm,0);
-                            }
 
-                            for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
-                            {
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
+                                 // need to do coarser to finer correction. 
                                 for(unsigned int s=1; s <= rk_s; s++ )
                                 {
-                                    cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
+                                    cVin[s-1]  = &sV[s-1][lookUp*nPe];
                                     cVout[s-1] = cVec.data() + (s-1)*nPe; 
                                 }
-
-                                Op->Cfc(cVout, (const T**)cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                            
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
+                                }
+                                
+                                Op->Ccf(cVout, (const T**)cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
                                 for(unsigned int node =0; node < nPe; node++)
-                                    dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
+                                    dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
+
+                            }else
+                            {
+                                assert(pNodes[lookUp].getLevel() == bLev +1);
+                                // finner to coaser correction. 
+
+                                pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
+                                assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
+                                unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
+                                tl = etVec[fchild[0]];
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
+                                }
+
+                                for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
+                                {
+                                    for(unsigned int s=1; s <= rk_s; s++ )
+                                    {
+                                        cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
+                                        cVout[s-1] = cVec.data() + (s-1)*nPe; 
+                                    }
+
+                                    Op->Cfc(cVout, (const T**)cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                    for(unsigned int node =0; node < nPe; node++)
+                                        dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
                         
-                            }
+                                }
 
+                            }
+                        
                         }
                         
                     }
-                        
-                }
 
-                //std::cout<<"ele  left "<<std::endl;
+                    //std::cout<<"ele  left "<<std::endl;
 
-                // OCT_DIR_RIGHT
-                if(ei==emax)
-                {
-                    const unsigned int dir = OCT_DIR_RIGHT;
-                    lookUp = e2e[elem*NUM_FACES + dir];
-                    if(lookUp!=LOOK_UP_TABLE_DEFAULT)
+                    // OCT_DIR_RIGHT
+                    if(ei==emax)
                     {
-                        
-                        if(pNodes[lookUp].getLevel() == bLev )
+                        const unsigned int dir = OCT_DIR_RIGHT;
+                        lookUp = e2e[elem*NUM_FACES + dir];
+                        if(lookUp!=LOOK_UP_TABLE_DEFAULT)
                         {
-                            tl = etVec[lookUp];
-                            unzipEids.push_back(lookUp);
+                        
+                            if(pNodes[lookUp].getLevel() == bLev )
+                            {
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
 
-                            assert(bTime == tl);
+                                assert(bTime == tl);
 
-                            for(unsigned int node =0; node < nPe; node++)
-                                dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
+                                for(unsigned int node =0; node < nPe; node++)
+                                    dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
 
-                        }else if(pNodes[lookUp].getLevel() < bLev)
-                        {
+                            }else if(pNodes[lookUp].getLevel() < bLev)
+                            {
 
-                            tl = etVec[lookUp];
-                            unzipEids.push_back(lookUp);
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
                             
-                            // need to do coarser to finer correction. 
-                            for(unsigned int s=1; s <= rk_s; s++ )
-                            {
-                                cVin[s-1]  = &sV[s-1][lookUp*nPe];
-                                cVout[s-1] = cVec.data() + (s-1)*nPe; 
-                            }
+                                // need to do coarser to finer correction. 
+                                for(unsigned int s=1; s <= rk_s; s++ )
+                                {
+                                    cVin[s-1]  = &sV[s-1][lookUp*nPe];
+                                    cVout[s-1] = cVec.data() + (s-1)*nPe; 
+                                }
                             
-                            if(tl==bTime)
-                                dt = 0;
-                            else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
-                                dt = dt_c/2.0;
-                            else
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
+                                }
+
+                                Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                for(unsigned int node =0; node < nPe; node++)
+                                    dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
+
+
+                            }else
                             {
-                                std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                                assert(false); // finer block cannot exceed time of the coarset block. 
-                                MPI_Abort(comm,0);
+                                assert(pNodes[lookUp].getLevel() == bLev +1);
+                                // finner to coaser correction. 
+
+                                pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
+                                assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
+                                unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
+
+                                tl = etVec[fchild[0]];
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
+                                }
+
+                                for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
+                                {
+                                    for(unsigned int s=1; s <= rk_s; s++ )
+                                    {
+                                        cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
+                                        cVout[s-1] = cVec.data() + (s-1)*nPe; 
+                                    }
+
+                                    Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                    for(unsigned int node =0; node < nPe; node++)
+                                        dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
+                        
+                                }
+
                             }
+                        
+                        }
 
-                            Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
-                            for(unsigned int node =0; node < nPe; node++)
-                                dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
+                    }
 
+                    //std::cout<<"ele  right "<<std::endl;
 
-                        }else
+                    if(ej==emin)
+                    {
+                        const unsigned int dir = OCT_DIR_DOWN;
+                        lookUp = e2e[elem*NUM_FACES + dir];
+                        if(lookUp!=LOOK_UP_TABLE_DEFAULT)
                         {
-                            assert(pNodes[lookUp].getLevel() == bLev +1);
-                            // finner to coaser correction. 
+                        
+                            if(pNodes[lookUp].getLevel() == bLev )
+                            {
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
+                                assert(bTime == tl);
 
-                            pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
-                            assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
-                            unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
+                                for(unsigned int node =0; node < nPe; node++)
+                                    dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
 
-                            tl = etVec[fchild[0]];
-                            if(tl==bTime)
-                                dt = 0;
-                            else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
-                                dt = dt_c/2.0;
-                            else
+                            }else if(pNodes[lookUp].getLevel() < bLev)
                             {
-                                std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                                assert(false); // finer block cannot exceed time of the coarset block. 
-                                MPI_Abort(comm,0);
-                            }
 
-                            for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
-                            {
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
+                            
+                                // need to do coarser to finer correction. 
                                 for(unsigned int s=1; s <= rk_s; s++ )
                                 {
-                                    cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
+                                    cVin[s-1]  = &sV[s-1][lookUp*nPe];
                                     cVout[s-1] = cVec.data() + (s-1)*nPe; 
                                 }
+                            
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
+                                }
 
-                                Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
                                 for(unsigned int node =0; node < nPe; node++)
-                                    dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
+                                    dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
+
+
+                            }else
+                            {
+                                assert(pNodes[lookUp].getLevel() == bLev +1);
+                                // finner to coaser correction. 
+
+                                pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
+                                assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
+                                unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
+
+                                tl = etVec[fchild[0]];
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
+                                }
+
+                                for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
+                                {
+                                    for(unsigned int s=1; s <= rk_s; s++ )
+                                    {
+                                        cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
+                                        cVout[s-1] = cVec.data() + (s-1)*nPe; 
+                                    }
+
+                                    Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                    for(unsigned int node =0; node < nPe; node++)
+                                        dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
                         
-                            }
+                                }
 
-                        }
+                            }
                         
-                    }
+                        }
 
-                }
+                    }
 
-                //std::cout<<"ele  right "<<std::endl;
+                    //std::cout<<"ele  down "<<std::endl;
 
-                if(ej==emin)
-                {
-                    const unsigned int dir = OCT_DIR_DOWN;
-                    lookUp = e2e[elem*NUM_FACES + dir];
-                    if(lookUp!=LOOK_UP_TABLE_DEFAULT)
+                    if(ej==emax)
                     {
-                        
-                        if(pNodes[lookUp].getLevel() == bLev )
+                        const unsigned int dir = OCT_DIR_UP;
+                        lookUp = e2e[elem*NUM_FACES + dir];
+                        if(lookUp!=LOOK_UP_TABLE_DEFAULT)
                         {
-                            tl = etVec[lookUp];
-                            unzipEids.push_back(lookUp);
-                            assert(bTime == tl);
+                        
+                            if(pNodes[lookUp].getLevel() == bLev )
+                            {
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
+                                assert(bTime == tl);
 
-                            for(unsigned int node =0; node < nPe; node++)
-                                dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
+                                for(unsigned int node =0; node < nPe; node++)
+                                    dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
 
-                        }else if(pNodes[lookUp].getLevel() < bLev)
-                        {
+                            }else if(pNodes[lookUp].getLevel() < bLev)
+                            {
 
-                            tl = etVec[lookUp];
-                            unzipEids.push_back(lookUp);
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
                             
-                            // need to do coarser to finer correction. 
-                            for(unsigned int s=1; s <= rk_s; s++ )
-                            {
-                                cVin[s-1]  = &sV[s-1][lookUp*nPe];
-                                cVout[s-1] = cVec.data() + (s-1)*nPe; 
-                            }
+                                // need to do coarser to finer correction. 
+                                for(unsigned int s=1; s <= rk_s; s++ )
+                                {
+                                    cVin[s-1]  = &sV[s-1][lookUp*nPe];
+                                    cVout[s-1] = cVec.data() + (s-1)*nPe; 
+                                }
                             
-                            if(tl==bTime)
-                                dt = 0;
-                            else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
-                                dt = dt_c/2.0;
-                            else
-                            {
-                                std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                                assert(false); // finer block cannot exceed time of the coarset block. 
-                                MPI_Abort(comm,0);
-                            }
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
+                                }
 
-                            Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
-                            for(unsigned int node =0; node < nPe; node++)
-                                dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
+                                Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                for(unsigned int node =0; node < nPe; node++)
+                                    dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
 
 
-                        }else
-                        {
-                            assert(pNodes[lookUp].getLevel() == bLev +1);
-                            // finner to coaser correction. 
+                            }else
+                            {
+                                assert(pNodes[lookUp].getLevel() == bLev +1);
+                                // finner to coaser correction. 
+
+                                pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
+                                assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
+                                unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
+
+                                tl = etVec[fchild[0]];
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
+                                }
 
-                            pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
-                            assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
-                            unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
+                                for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
+                                {
+                                    for(unsigned int s=1; s <= rk_s; s++ )
+                                    {
+                                        cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
+                                        cVout[s-1] = cVec.data() + (s-1)*nPe; 
+                                    }
+
+                                    Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                    for(unsigned int node =0; node < nPe; node++)
+                                        dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
+                        
+                                }
 
-                            tl = etVec[fchild[0]];
-                            if(tl==bTime)
-                                dt = 0;
-                            else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
-                                dt = dt_c/2.0;
-                            else
-                            {
-                                std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                                assert(false); // finer block cannot exceed time of the coarset block. 
-                                MPI_Abort(comm,0);
                             }
+                        
+                        }
 
-                            for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
+                    }
+
+                    //std::cout<<"ele  up "<<std::endl;
+
+                    if(ek==emin)
+                    {
+
+                        const unsigned int dir = OCT_DIR_BACK;
+                        lookUp = e2e[elem*NUM_FACES + dir];
+                        if(lookUp!=LOOK_UP_TABLE_DEFAULT)
+                        {
+                        
+                            if(pNodes[lookUp].getLevel() == bLev )
                             {
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
+                                assert(bTime == tl);
+
+                                for(unsigned int node =0; node < nPe; node++)
+                                    dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
+
+                            }else if(pNodes[lookUp].getLevel() < bLev)
+                            {
+
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
+                            
+                                // need to do coarser to finer correction. 
                                 for(unsigned int s=1; s <= rk_s; s++ )
                                 {
-                                    cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
+                                    cVin[s-1]  = &sV[s-1][lookUp*nPe];
                                     cVout[s-1] = cVec.data() + (s-1)*nPe; 
                                 }
+                            
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
+                                }
 
-                                Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
                                 for(unsigned int node =0; node < nPe; node++)
-                                    dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
-                        
-                            }
+                                    dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
 
-                        }
-                        
-                    }
 
-                }
+                            }else
+                            {
+                                assert(pNodes[lookUp].getLevel() == bLev +1);
+                                // finner to coaser correction. 
+
+                                pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
+                                assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
+                                unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
+
+                                tl = etVec[fchild[0]];
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
+                                }
 
-                //std::cout<<"ele  down "<<std::endl;
+                                for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
+                                {
+                                    for(unsigned int s=1; s <= rk_s; s++ )
+                                    {
+                                        cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
+                                        cVout[s-1] = cVec.data() + (s-1)*nPe; 
+                                    }
 
-                if(ej==emax)
-                {
-                    const unsigned int dir = OCT_DIR_UP;
-                    lookUp = e2e[elem*NUM_FACES + dir];
-                    if(lookUp!=LOOK_UP_TABLE_DEFAULT)
-                    {
+                                    Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                    for(unsigned int node =0; node < nPe; node++)
+                                        dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
                         
-                        if(pNodes[lookUp].getLevel() == bLev )
-                        {
-                            tl = etVec[lookUp];
-                            unzipEids.push_back(lookUp);
-                            assert(bTime == tl);
+                                }
 
-                            for(unsigned int node =0; node < nPe; node++)
-                                dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
+                            }
+                        
+                        }
 
-                        }else if(pNodes[lookUp].getLevel() < bLev)
-                        {
 
-                            tl = etVec[lookUp];
-                            unzipEids.push_back(lookUp);
-                            
-                            // need to do coarser to finer correction. 
-                            for(unsigned int s=1; s <= rk_s; s++ )
-                            {
-                                cVin[s-1]  = &sV[s-1][lookUp*nPe];
-                                cVout[s-1] = cVec.data() + (s-1)*nPe; 
-                            }
-                            
-                            if(tl==bTime)
-                                dt = 0;
-                            else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
-                                dt = dt_c/2.0;
-                            else
-                            {
-                                std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                                assert(false); // finer block cannot exceed time of the coarset block. 
-                                MPI_Abort(comm,0);
-                            }
+                    }
 
-                            Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
-                            for(unsigned int node =0; node < nPe; node++)
-                                dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
+                    //std::cout<<"ele back"<<std::endl;
 
+                    if(ek==emax)
+                    {
 
-                        }else
+                        const unsigned int dir = OCT_DIR_FRONT;
+                        lookUp = e2e[elem*NUM_FACES + dir];
+                        if(lookUp!=LOOK_UP_TABLE_DEFAULT)
                         {
-                            assert(pNodes[lookUp].getLevel() == bLev +1);
-                            // finner to coaser correction. 
+                        
+                            if(pNodes[lookUp].getLevel() == bLev )
+                            {   
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
+                                assert(bTime == tl);
 
-                            pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
-                            assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
-                            unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
+                                for(unsigned int node =0; node < nPe; node++)
+                                    dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
 
-                            tl = etVec[fchild[0]];
-                            if(tl==bTime)
-                                dt = 0;
-                            else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
-                                dt = dt_c/2.0;
-                            else
+                            }else if(pNodes[lookUp].getLevel() < bLev)
                             {
-                                std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                                assert(false); // finer block cannot exceed time of the coarset block. 
-                                MPI_Abort(comm,0);
-                            }
 
-                            for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
-                            {
+                                tl = etVec[lookUp];
+                                unzipEids.push_back(lookUp);
+                            
+                                // need to do coarser to finer correction. 
                                 for(unsigned int s=1; s <= rk_s; s++ )
                                 {
-                                    cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
+                                    cVin[s-1]  = &sV[s-1][lookUp*nPe];
                                     cVout[s-1] = cVec.data() + (s-1)*nPe; 
                                 }
+                            
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
+                                }
 
-                                Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
                                 for(unsigned int node =0; node < nPe; node++)
-                                    dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
+                                    dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
+
+
+                            }else
+                            {
+                                assert(pNodes[lookUp].getLevel() == bLev +1);
+                                // finner to coaser correction. 
+
+                                pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
+                                assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
+                                unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
+
+                                tl = etVec[fchild[0]];
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
+                                    dt = dt_c/2.0;
+                                else
+                                {
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                
+                                }
+
+                                for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
+                                {
+                                    for(unsigned int s=1; s <= rk_s; s++ )
+                                    {
+                                        cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
+                                        cVout[s-1] = cVec.data() + (s-1)*nPe; 
+                                    }
+
+                                    Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                    for(unsigned int node =0; node < nPe; node++)
+                                        dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
                         
-                            }
+                                }
 
-                        }
+                            }
                         
+                        }
+
+
                     }
 
+                    //std::cout<<"ele front"<<std::endl;
+
+
+
+                
                 }
 
-                //std::cout<<"ele  up "<<std::endl;
+                const std::vector<unsigned int> blkEdge = blkList[m_uiBlkID].getBlk2DiagMap_vec();
+                const std::vector<unsigned int> blkVert = blkList[m_uiBlkID].getBlk2VertexMap_vec();
 
-                if(ek==emin)
-                {
+                const unsigned int ele_1d = blkList[m_uiBlkID].getElemSz1D();
 
-                    const unsigned int dir = OCT_DIR_BACK;
-                    lookUp = e2e[elem*NUM_FACES + dir];
-                    if(lookUp!=LOOK_UP_TABLE_DEFAULT)
+                // do for the edge corrections. 
+                for(unsigned int dir =0; dir < NUM_EDGES; dir++)
+                {
+                    for(unsigned int i=0; i < ele_1d; i++)
                     {
-                        
-                        if(pNodes[lookUp].getLevel() == bLev )
+                        if(blkEdge[dir*2*ele_1d + 2*i]!=LOOK_UP_TABLE_DEFAULT)
                         {
-                            tl = etVec[lookUp];
-                            unzipEids.push_back(lookUp);
-                            assert(bTime == tl);
+                            if(blkEdge[dir*2*ele_1d + 2*i] == blkEdge[dir*2*ele_1d + 2*i+1])
+                            {
 
-                            for(unsigned int node =0; node < nPe; node++)
-                                dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
+                                lookUp = blkEdge[dir*2*ele_1d + 2*i];
+                                if(lookUp!=LOOK_UP_TABLE_DEFAULT)
+                                {
+                                
+                                    if(pNodes[lookUp].getLevel() == bLev )
+                                    {
+                                        tl = etVec[lookUp];
+                                        unzipEids.push_back(lookUp);
+                                        assert(bTime == tl);
 
-                        }else if(pNodes[lookUp].getLevel() < bLev)
-                        {
+                                        for(unsigned int node =0; node < nPe; node++)
+                                            dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
 
-                            tl = etVec[lookUp];
-                            unzipEids.push_back(lookUp);
-                            
-                            // need to do coarser to finer correction. 
-                            for(unsigned int s=1; s <= rk_s; s++ )
-                            {
-                                cVin[s-1]  = &sV[s-1][lookUp*nPe];
-                                cVout[s-1] = cVec.data() + (s-1)*nPe; 
-                            }
-                            
-                            if(tl==bTime)
-                                dt = 0;
-                            else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
-                                dt = dt_c/2.0;
-                            else
-                            {
-                                std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                                assert(false); // finer block cannot exceed time of the coarset block. 
-                                MPI_Abort(comm,0);
-                            }
+                                    }else if(pNodes[lookUp].getLevel() < bLev)
+                                    {
 
-                            Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
-                            for(unsigned int node =0; node < nPe; node++)
-                                dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
+                                        tl = etVec[lookUp];
+                                        unzipEids.push_back(lookUp);
+                                    
+                                        // need to do coarser to finer correction. 
+                                        for(unsigned int s=1; s <= rk_s; s++ )
+                                        {
+                                            cVin[s-1]  = &sV[s-1][lookUp*nPe];
+                                            cVout[s-1] = cVec.data() + (s-1)*nPe; 
+                                        }
+                                    
+                                        if(tl==bTime)
+                                            dt = 0;
+                                        else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
+                                            dt = dt_c/2.0;
+                                        else
+                                            assert(false); // finer block cannot exceed time of the coarset block. 
 
+                                        Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                        for(unsigned int node =0; node < nPe; node++)
+                                            dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
 
-                        }else
-                        {
-                            assert(pNodes[lookUp].getLevel() == bLev +1);
-                            // finner to coaser correction. 
 
-                            pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
-                            assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
-                            unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
+                                    }else
+                                        assert(false);
+                                
+                                
+                                }
 
-                            tl = etVec[fchild[0]];
-                            if(tl==bTime)
-                                dt = 0;
-                            else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
-                                dt = dt_c/2.0;
-                            else
-                            {
-                                std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                                assert(false); // finer block cannot exceed time of the coarset block. 
-                                MPI_Abort(comm,0);
-                            }
 
-                            for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
+                            }else
                             {
-                                for(unsigned int s=1; s <= rk_s; s++ )
+                                lookUp = blkEdge[dir*2*ele_1d + 2*i];
+                                echild[0] = blkEdge[dir*2*ele_1d + 2*i];
+                                echild[1] = blkEdge[dir*2*ele_1d + 2*i+1];
+                                assert(pNodes[lookUp].getLevel() == bLev +1);
+                                assert(etVec[echild[0]] == etVec[echild[1]]);
+
+                                unzipEids.push_back(echild[0]);
+                                unzipEids.push_back(echild[1]);
+
+                                tl = etVec[echild[0]];
+                                if(tl==bTime)
+                                    dt = 0;
+                                else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
+                                    dt = dt_c/2.0;
+                                else
                                 {
-                                    cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
-                                    cVout[s-1] = cVec.data() + (s-1)*nPe; 
+                                    std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
+                                    assert(false); // finer block cannot exceed time of the coarset block. 
+                                    MPI_Abort(comm,0);
                                 }
 
-                                Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
-                                for(unsigned int node =0; node < nPe; node++)
-                                    dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
+                                for(unsigned int m=0; m < (NUM_CHILDREN>>2u); m++)
+                                {
+                                    for(unsigned int s=1; s <= rk_s; s++ )
+                                    {
+                                        cVin[s-1]  = &sV[s-1][echild[m]*nPe];
+                                        cVout[s-1] = cVec.data() + (s-1)*nPe; 
+                                    }
+
+                                    Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                                    for(unsigned int node =0; node < nPe; node++)
+                                        dgV[echild[m] *nPe + node] = cVout[rk_s-1][node];
                         
-                            }
+                                }
 
+                            }
+                    
                         }
-                        
+                
                     }
 
-
+                    //std::cout<<"ele diag"<<dir<<std::endl;
+                
                 }
 
-                //std::cout<<"ele back"<<std::endl;
 
-                if(ek==emax)
+                // do the vertex element corrections. 
+                for(unsigned int dir =0; dir < NUM_CHILDREN; dir++)
                 {
+                    lookUp = blkVert[dir];
 
-                    const unsigned int dir = OCT_DIR_FRONT;
-                    lookUp = e2e[elem*NUM_FACES + dir];
                     if(lookUp!=LOOK_UP_TABLE_DEFAULT)
                     {
-                        
                         if(pNodes[lookUp].getLevel() == bLev )
-                        {   
+                        {
                             tl = etVec[lookUp];
                             unzipEids.push_back(lookUp);
                             assert(bTime == tl);
+                        
 
                             for(unsigned int node =0; node < nPe; node++)
                                 dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
@@ -910,14 +1196,14 @@ namespace ts
 
                             tl = etVec[lookUp];
                             unzipEids.push_back(lookUp);
-                            
+                        
                             // need to do coarser to finer correction. 
                             for(unsigned int s=1; s <= rk_s; s++ )
                             {
                                 cVin[s-1]  = &sV[s-1][lookUp*nPe];
                                 cVout[s-1] = cVec.data() + (s-1)*nPe; 
                             }
-                            
+                        
                             if(tl==bTime)
                                 dt = 0;
                             else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
@@ -939,122 +1225,16 @@ namespace ts
                             assert(pNodes[lookUp].getLevel() == bLev +1);
                             // finner to coaser correction. 
 
-                            pMesh->getFinerFaceNeighbors(elem, dir, (unsigned int *)fchild);
-                            assert(etVec[fchild[0]] == etVec[fchild[1]] && etVec[fchild[1]] == etVec[fchild[2]] && etVec[fchild[2]] == etVec[fchild[3]] );
-                            unzipEids.push_back(fchild[0]); unzipEids.push_back(fchild[1]); unzipEids.push_back(fchild[2]); unzipEids.push_back(fchild[3]); 
-
-                            tl = etVec[fchild[0]];
-                            if(tl==bTime)
-                                dt = 0;
-                            else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
-                                dt = dt_c/2.0;
-                            else
-                            {
-                                std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                                assert(false); // finer block cannot exceed time of the coarset block. 
-                                
-                            }
-
-                            for(unsigned int m=0; m < (NUM_CHILDREN>>1u); m++)
-                            {
-                                for(unsigned int s=1; s <= rk_s; s++ )
-                                {
-                                    cVin[s-1]  = &sV[s-1][fchild[m]*nPe];
-                                    cVout[s-1] = cVec.data() + (s-1)*nPe; 
-                                }
-
-                                Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
-                                for(unsigned int node =0; node < nPe; node++)
-                                    dgV[fchild[m] *nPe + node] = cVout[rk_s-1][node];
-                        
-                            }
-
-                        }
-                        
-                    }
-
-
-                }
-
-                //std::cout<<"ele front"<<std::endl;
-
-
-
-                
-            }
-
-            const std::vector<unsigned int> blkEdge = blkList[m_uiBlkID].getBlk2DiagMap_vec();
-            const std::vector<unsigned int> blkVert = blkList[m_uiBlkID].getBlk2VertexMap_vec();
-
-            const unsigned int ele_1d = blkList[m_uiBlkID].getElemSz1D();
-
-            // do for the edge corrections. 
-            for(unsigned int dir =0; dir < NUM_EDGES; dir++)
-            {
-                for(unsigned int i=0; i < ele_1d; i++)
-                {
-                    if(blkEdge[dir*2*ele_1d + 2*i]!=LOOK_UP_TABLE_DEFAULT)
-                    {
-                        if(blkEdge[dir*2*ele_1d + 2*i] == blkEdge[dir*2*ele_1d + 2*i+1])
-                        {
+                            tl = etVec[lookUp];
+                            unzipEids.push_back(lookUp);
 
-                            lookUp = blkEdge[dir*2*ele_1d + 2*i];
-                            if(lookUp!=LOOK_UP_TABLE_DEFAULT)
+                            // need to do coarser to finer correction. 
+                            for(unsigned int s=1; s <= rk_s; s++ )
                             {
-                                
-                                if(pNodes[lookUp].getLevel() == bLev )
-                                {
-                                    tl = etVec[lookUp];
-                                    unzipEids.push_back(lookUp);
-                                    assert(bTime == tl);
-
-                                    for(unsigned int node =0; node < nPe; node++)
-                                        dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
-
-                                }else if(pNodes[lookUp].getLevel() < bLev)
-                                {
-
-                                    tl = etVec[lookUp];
-                                    unzipEids.push_back(lookUp);
-                                    
-                                    // need to do coarser to finer correction. 
-                                    for(unsigned int s=1; s <= rk_s; s++ )
-                                    {
-                                        cVin[s-1]  = &sV[s-1][lookUp*nPe];
-                                        cVout[s-1] = cVec.data() + (s-1)*nPe; 
-                                    }
-                                    
-                                    if(tl==bTime)
-                                        dt = 0;
-                                    else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
-                                        dt = dt_c/2.0;
-                                    else
-                                        assert(false); // finer block cannot exceed time of the coarset block. 
-
-                                    Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
-                                    for(unsigned int node =0; node < nPe; node++)
-                                        dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
-
-
-                                }else
-                                    assert(false);
-                                
-                                
+                                cVin[s-1]  = &sV[s-1][lookUp*nPe];
+                                cVout[s-1] = cVec.data() + (s-1)*nPe; 
                             }
 
-
-                        }else
-                        {
-                            lookUp = blkEdge[dir*2*ele_1d + 2*i];
-                            echild[0] = blkEdge[dir*2*ele_1d + 2*i];
-                            echild[1] = blkEdge[dir*2*ele_1d + 2*i+1];
-                            assert(pNodes[lookUp].getLevel() == bLev +1);
-                            assert(etVec[echild[0]] == etVec[echild[1]]);
-
-                            unzipEids.push_back(echild[0]);
-                            unzipEids.push_back(echild[1]);
-
-                            tl = etVec[echild[0]];
                             if(tl==bTime)
                                 dt = 0;
                             else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
@@ -1065,157 +1245,130 @@ namespace ts
                                 assert(false); // finer block cannot exceed time of the coarset block. 
                                 MPI_Abort(comm,0);
                             }
+                            
 
-                            for(unsigned int m=0; m < (NUM_CHILDREN>>2u); m++)
-                            {
-                                for(unsigned int s=1; s <= rk_s; s++ )
-                                {
-                                    cVin[s-1]  = &sV[s-1][echild[m]*nPe];
-                                    cVout[s-1] = cVec.data() + (s-1)*nPe; 
-                                }
+                            Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
+                            for(unsigned int node =0; node < nPe; node++)
+                                dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
 
-                                Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
-                                for(unsigned int node =0; node < nPe; node++)
-                                    dgV[echild[m] *nPe + node] = cVout[rk_s-1][node];
                         
-                            }
-
                         }
                     
                     }
-                
-                }
 
-                //std::cout<<"ele diag"<<dir<<std::endl;
-                
-            }
-
-
-            // do the vertex element corrections. 
-            for(unsigned int dir =0; dir < NUM_CHILDREN; dir++)
-            {
-                lookUp = blkVert[dir];
-
-                if(lookUp!=LOOK_UP_TABLE_DEFAULT)
-                {
-                    if(pNodes[lookUp].getLevel() == bLev )
-                    {
-                        tl = etVec[lookUp];
-                        unzipEids.push_back(lookUp);
-                        assert(bTime == tl);
-                        
-
-                        for(unsigned int node =0; node < nPe; node++)
-                            dgV[lookUp *nPe + node] = sV[rk_s-1][lookUp*nPe +  node];
-
-                    }else if(pNodes[lookUp].getLevel() < bLev)
-                    {
-
-                        tl = etVec[lookUp];
-                        unzipEids.push_back(lookUp);
-                        
-                        // need to do coarser to finer correction. 
-                        for(unsigned int s=1; s <= rk_s; s++ )
-                        {
-                            cVin[s-1]  = &sV[s-1][lookUp*nPe];
-                            cVout[s-1] = cVec.data() + (s-1)*nPe; 
-                        }
-                        
-                        if(tl==bTime)
-                            dt = 0;
-                        else if(tl == bTime + (1u<<(m_uiLevMax - bLev)))
-                            dt = dt_c/2.0;
-                        else
-                        {
-                            std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                            assert(false); // finer block cannot exceed time of the coarset block. 
-                            MPI_Abort(comm,0);
-                        }
-
-                        Op->Ccf(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
-                        for(unsigned int node =0; node < nPe; node++)
-                            dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
+                    //std::cout<<"ele vert "<<dir<<std::endl;
 
 
-                    }else
-                    {
-                        assert(pNodes[lookUp].getLevel() == bLev +1);
-                        // finner to coaser correction. 
-
-                        tl = etVec[lookUp];
-                        unzipEids.push_back(lookUp);
-
-                        // need to do coarser to finer correction. 
-                        for(unsigned int s=1; s <= rk_s; s++ )
-                        {
-                            cVin[s-1]  = &sV[s-1][lookUp*nPe];
-                            cVout[s-1] = cVec.data() + (s-1)*nPe; 
-                        }
-
-                        if(tl==bTime)
-                            dt = 0;
-                        else if(tl + (1u<<(m_uiLevMax-bLev-1)) == bTime)
-                            dt = dt_c/2.0;
-                        else
-                        {
-                            std::cout<<"ENUTS sync error at  "<<__func__<<" line : "<<__LINE__<<" finer and coarse time gap violated "<<std::endl;
-                            assert(false); // finer block cannot exceed time of the coarset block. 
-                            MPI_Abort(comm,0);
-                        }
-                            
-
-                        Op->Cfc(cVout, (const T**) cVin, cSz, rk_s, dt_c, dt_f, dt, m_uiDof );
-                        for(unsigned int node =0; node < nPe; node++)
-                            dgV[lookUp *nPe + node] = cVout[rk_s-1][node];
-
-                        
-                    }
-                    
                 }
 
-                //std::cout<<"ele vert "<<dir<<std::endl;
+                // accumulate c[rk_s-1] times the corrected stage (an element can be listed more than once in unzipEids) 
+                accEids.assign(unzipEids.begin(),unzipEids.end());
+                std::sort(accEids.begin(),accEids.end());
+                accEids.erase(std::unique(accEids.begin(),accEids.end()),accEids.end());
 
+                const T a_s = c[rk_s-1];
+                if(rk_s==1)
+                {
+                    for(unsigned int e=0; e < accEids.size(); e++)
+                     for(unsigned int node =0; node < nPe; node++)
+                        dgA[accEids[e]*nPe + node] = a_s * dgV[accEids[e]*nPe + node];
+                }else
+                {
+                    for(unsigned int e=0; e < accEids.size(); e++)
+                     for(unsigned int node =0; node < nPe; node++)
+                        dgA[accEids[e]*nPe + node] += a_s * dgV[accEids[e]*nPe + node];
+                }
 
             }
 
-            // do unzip using the DG vector (Now the mesh class supports it. )
-            pMesh->DG2CGVec(dgWVec,cgWVec,true,unzipEids.data(),unzipEids.size(),1);
+            // do unzip using the DG vector (Now the mesh class supports it. ), DG2CG and unzip are linear, hence a single unzip for the combination of the stages. 
+            pMesh->DG2CGVec(dgA,cgWVec,true,unzipEids.data(),unzipEids.size(),1);
             pMesh->unzip(cgWVec,uzWVec,&m_uiBlkID,1);
             
-            // copy from uzWvec to m_uiVec. 
-            std::memcpy(vVec,&uzWVec[offset],sizeof(T)*(lx*ly*lz));
+            // out = u + unzip(sum c_s K_s), padding included. 
+            const T* uzV = uzWVec + offset;
+            for(unsigned int i=0; i < lx*ly*lz; i++)
+                vVec[i] = uV[i] + uzV[i];
 
         }
 
-        m_uiBVec[blk]._vec[rk_s].mark_synced();
+        m_uiBVec[blk]._vec[out].mark_synced();
         return;
 
 
     }
     
     template<typename T, typename Ctx>
-    void ExplicitNUTS<T,Ctx>::update_ele_timestep()
+    void ExplicitNUTS<T,Ctx>::update_ele_timestep(unsigned int pt)
     {
         ot::Mesh* pMesh = m_uiAppCtx->get_mesh();
 
         if(!(pMesh->isActive()))
             return;
 
-        std::vector<ot::Block> blkList = pMesh->getLocalBlockList();
-
-        for(unsigned int ele = pMesh->getElementPreGhostBegin(); ele < pMesh->getElementPostGhostEnd(); ele ++)
-            m_uiEleTime[ele]=0;
+        const ot::TreeNode* const pNodes = pMesh->getAllElements().data();
+        const unsigned int eleBegin = pMesh->getElementPreGhostBegin();
+        const unsigned int eleEnd   = pMesh->getElementPostGhostEnd();
 
-        for(unsigned int blk =0; blk < blkList.size(); blk++)
+        for(unsigned int ele = eleBegin; ele < eleEnd; ele ++)
         {
-            for(unsigned int ele = blkList[blk].getLocalElementBegin(); ele < blkList[blk].getLocalElementEnd(); ele ++)
-                m_uiEleTime[ele] = m_uiBVec[blk]._time;
-            
+            const unsigned int lDt = m_uiLevMax - pNodes[ele].getLevel(); // log2 of the element dt 
+            m_uiEleTime[ele] = ((pt + (1u<<lDt) - 1) >> lDt) << lDt;
         }
 
+        #ifdef DEBUG_ENUTS_ELE_TIME
+            const std::vector<ot::Block>& blkList = pMesh->getLocalBlockList();
+            for(unsigned int blk =0; blk < blkList.size(); blk++)
+                for(unsigned int ele = blkList[blk].getLocalElementBegin(); ele < blkList[blk].getLocalElementEnd(); ele ++)
+                    assert(m_uiEleTime[ele] == m_uiBVec[blk]._time);
+        #endif
+
     }
    
    
+    template<typename T, typename Ctx>
+    void ExplicitNUTS<T,Ctx>::dump_load_statistics(std::ostream & sout) const
+    {
+        const ot::Mesh* pMesh = m_uiAppCtx->get_mesh();
+        if(!(pMesh->isActive()))
+            return;
+
+        const unsigned int rank = pMesh->getMPIRank();
+        const unsigned int npes = pMesh->getMPICommSize();
+        MPI_Comm comm = pMesh->getMPICommunicator();
+        const ot::TreeNode* const pNodes = pMesh->getAllElements().data();
+
+        // [0] : rhs evaluations (elements) per coarse step, [1 + l - lmin] : elements of level l
+        const unsigned int nL = m_uiLevMax - m_uiLevMin + 1;
+        std::vector<DendroIntL> stat_l(nL+1,0);
+        std::vector<DendroIntL> stat_min(nL+1,0);
+        std::vector<DendroIntL> stat_max(nL+1,0);
+        std::vector<DendroIntL> stat_sum(nL+1,0);
+
+        for(unsigned int ele = pMesh->getElementLocalBegin(); ele < pMesh->getElementLocalEnd(); ele++)
+        {
+            const unsigned int l = pNodes[ele].getLevel();
+            stat_l[0] += (1u<<(l - m_uiLevMin));
+            stat_l[1 + l - m_uiLevMin]++;
+        }
+
+        par::Mpi_Reduce(stat_l.data(),stat_min.data(),nL+1,MPI_MIN,0,comm);
+        par::Mpi_Reduce(stat_l.data(),stat_max.data(),nL+1,MPI_MAX,0,comm);
+        par::Mpi_Reduce(stat_l.data(),stat_sum.data(),nL+1,MPI_SUM,0,comm);
+
+        if(!rank)
+        {
+            sout<<"[ENUTS] load statistics (min, mean, max over "<<npes<<" procs) "<<std::endl;
+            sout<<"\t rhs evals per coarse step : "<<stat_min[0]<<" , "<<(stat_sum[0]/(double)npes)<<" , "<<stat_max[0]<<std::endl;
+            for(unsigned int l = m_uiLevMin; l <= m_uiLevMax; l++)
+            {
+                const unsigned int k = 1 + l - m_uiLevMin;
+                sout<<"\t level "<<l<<" (dt x "<<(1u<<(m_uiLevMax-l))<<") elements : "<<stat_min[k]<<" , "<<(stat_sum[k]/(double)npes)<<" , "<<stat_max[k]<<std::endl;
+            }
+        }
+
+    }
+
     template<typename T, typename Ctx>
     void ExplicitNUTS<T,Ctx>::evolve()
     {
@@ -1247,117 +1400,164 @@ namespace ts
             const unsigned int coarset_t = 1u<<(m_uiLevMax - m_uiLevMin); // coarset time level. 
 
             m_uiAppCtx->unzip(m_uiEVar,m_uiEvarUzip ,m_uiAppCtx->get_async_batch_sz());  // unzip m_uiEVec to m_uiEVarUnzip
-            std::vector<ot::Block> blkList = pMesh->getLocalBlockList();
+            const std::vector<ot::Block>& blkList = pMesh->getLocalBlockList();
+            const BLK_TASK_TYPE rhsType = (m_uiAppCtx->is_rhs_blk_thread_safe()) ? BLK_TASK_TYPE::BLK_TASK_ANY : BLK_TASK_TYPE::BLK_TASK_MASTER;
 
             // initialize the block async vectors
+            #pragma omp parallel for schedule(dynamic)
             for(unsigned int blk =0; blk < blkList.size(); blk++)
             {
                 m_uiBVec[blk]._time = 0;
                 m_uiBVec[blk]._rks  = 0;
                 m_uiBVec[blk]._vec[0].copyFromUnzip(pMesh,m_uiEvarUzip.GetVecArray(), true, DOF);
                 m_uiBVec[blk]._vec[0].mark_synced();
-
-                for(unsigned int s=1;  s <= m_uiNumStages; s++)
-                    m_uiBVec[blk]._vec[s].mark_unsynced();
+                m_uiBVec[blk]._vec[1].mark_unsynced();
             }
 
-            this->update_ele_timestep();
-            
-            pMesh->readFromGhostBeginElementVec(m_uiEleTime.data(),1);
-            pMesh->readFromGhostEndElementVec(m_uiEleTime.data(),1);
+            this->update_ele_timestep(0);
+
+            // blocks that advance at the sub step pt
+            std::vector<unsigned int> activeBlk;
+            activeBlk.reserve(blkList.size());
+
+            // index in activeBlk, LOOK_UP_TABLE_DEFAULT if the block is not active. 
+            std::vector<unsigned int> activeIdx;
+            activeIdx.resize(blkList.size());
+
+            // rhs task of (stage, active block) and the ghost sync event of each stage. 
+            std::vector<unsigned int> tRhs;
+            std::vector<unsigned int> tGhost(m_uiNumStages);
 
             for(unsigned int pt=0; pt<coarset_t; pt ++)
             {
                 std::cout<<"[ENUTS] : pt: "<<pt<<" \n";
-                for(unsigned int rk=1; rk <= m_uiNumStages; rk++ )
+
+                activeBlk.clear();
+                for(unsigned int blk =0; blk < blkList.size(); blk++)
                 {
-                    const unsigned int BLK_S = rk;
-                    for(unsigned int blk =0; blk < blkList.size(); blk++)
+                    const unsigned int bLev =  pNodes[blkList[blk].getLocalElementBegin()].getLevel();
+                    const unsigned int BLK_DT = 1u<<(m_uiLevMax - bLev);
+                    if( pt% BLK_DT ==0 )
+                        activeBlk.push_back(blk);
+                }
+
+                const unsigned int numActive = activeBlk.size();
+
+                // levels [lActive, m_uiLevMax] advance at pt, only those are ghost synced. 
+                unsigned int lActive = m_uiLevMax;
+                while( lActive > m_uiLevMin && (pt % (1u<<(m_uiLevMax - lActive + 1))) == 0 )
+                    lActive--;
+
+                std::fill(activeIdx.begin(),activeIdx.end(),LOOK_UP_TABLE_DEFAULT);
+                for(unsigned int b =0; b < numActive; b++)
+                    activeIdx[activeBlk[b]] = b;
+
+                // task graph of the sub step, a block task is released as soon as the block and its neighbours (and the ghost elements 
+                // if the block reads them) have completed the previous stage, no barrier between the stages. 
+                // S(b,rk) : stage input assembly (sync_blk_timestep), uses the shared DG/CG work vectors and the mesh unzip, hence master tasks. 
+                // R(b,rk) : rhs of the block, zipped to the DG stage vector. 
+                // G(rk), E(rk) : level restricted DG ghost exchange of the stage rk (begin, completion event), in order. 
+                // F(b) : final update of the block. 
+                BlkTaskGraph& g = m_uiBlkGraph;
+                g.clear();
+                tRhs.resize(m_uiNumStages*numActive);
+
+                // task t needs the stage s of the block blk (and the blocks/ghosts in its padding region). 
+                auto add_stage_deps = [&](unsigned int t, unsigned int blk, unsigned int s)
+                {
+                    g.add_dependency(tRhs[(s-1)*numActive + activeIdx[blk]], t);
+                    for(unsigned int k = m_uiBlkNbrOffset[blk]; k < m_uiBlkNbrOffset[blk+1]; k++)
                     {
-                        const unsigned int BLK_T = m_uiBVec[blk]._time;
-                        const unsigned int NN   =  m_uiBVec[blk]._vec[0].getSz();
-                        const unsigned int bLev =  pNodes[blkList[blk].getLocalElementBegin()].getLevel();
-                        const unsigned int BLK_DT = 1u<<(m_uiLevMax - bLev);
-                        if( pt% BLK_DT !=0 )
-                            continue;
+                        const unsigned int nb = m_uiBlkNbr[k];
+                        if(activeIdx[nb] != LOOK_UP_TABLE_DEFAULT)
+                            g.add_dependency(tRhs[(s-1)*numActive + activeIdx[nb]], t);
+                    }
 
-                        
-                        //std::cout<<"[NUTS]: pt: "<<pt<<" blk: "<<blk<<" rk : "<<rk<<" step size: "<<BLK_DT<<std::endl;
+                    if(m_uiBlkGhostDep[blk])
+                        g.add_dependency(tGhost[s-1], t);
+                };
 
-                        assert(m_uiBVec[blk]._vec[rk-1].isSynced());
+                for(unsigned int rk=1; rk <= m_uiNumStages; rk++ )
+                {
+                    const unsigned int BLK_S = rk;
+                    T* const dgStage = m_uiStVec[BLK_S-1].GetVecArray();
 
-                        m_uiBVec[blk]._vec[m_uiNumStages+1].vecCopy(m_uiBVec[blk]._vec[0]); // copy the in vector. 
-                        T* out_ptr = (T*)m_uiBVec[blk]._vec[m_uiNumStages+1].data();
-                        
-                        for(unsigned int s=1;  s < BLK_S; s++)
-                        {
-                            const T* stage_ptr = m_uiBVec[blk]._vec[s].data();
-                            for(unsigned int n =0; n < DOF*NN; n++)
-                                out_ptr[n] += m_uiAij[ (BLK_S-1) * m_uiNumStages + (s-1)]* stage_ptr[n];
-                        }
+                    // stage input (with padding) in the output register, the first stage reads the block state directly. 
+                    const unsigned int in = (BLK_S > 1) ? 1 : 0;
 
-                        m_uiBVec[blk]._vec[BLK_S].computeVec(m_uiAppCtx, m_uiBVec[blk]._vec[m_uiNumStages+1], current_t + dt_finest*BLK_T);
-                        m_uiBVec[blk]._vec[BLK_S].mark_unsynced();
-                        m_uiBVec[blk]._vec[BLK_S].zipDG(pMesh,m_uiStVec[BLK_S-1].GetVecArray(),DOF);
-                        m_uiBVec[blk]._rks = rk;
+                    const unsigned int gBegin = g.add_task([=](){
+                        m_uiEleDGSM->readFromGhostBegin(dgStage,lActive,DOF);
+                    }, BLK_TASK_TYPE::BLK_TASK_MASTER);
 
+                    tGhost[BLK_S-1] = g.add_event([=](){
+                        return m_uiEleDGSM->isGhostReadComplete(dgStage,lActive);
+                    }, [=](){
+                        m_uiEleDGSM->readFromGhostEnd(dgStage,lActive,DOF);
+                    });
+                    
+                    g.add_dependency(gBegin, tGhost[BLK_S-1]);
+                    if(BLK_S > 1)
+                    {
+                        g.add_dependency(tGhost[BLK_S-2], gBegin);
+                        g.add_dependency(tGhost[BLK_S-2], tGhost[BLK_S-1]);
                     }
 
-                    // do the DG vec ghost sync. 
-                    pMesh->readFromGhostBeginEleDGVec(m_uiStVec[BLK_S-1].GetVecArray(),DOF);
-                    pMesh->readFromGhostEndEleDGVec(m_uiStVec[BLK_S-1].GetVecArray(),DOF);
-
-                    for(unsigned int blk =0; blk < blkList.size(); blk++)
+                    for(unsigned int b =0; b < numActive; b++)
                     {
-                        const unsigned int BLK_T = m_uiBVec[blk]._time;
-                        const unsigned int NN   =  m_uiBVec[blk]._vec[0].getSz();
-                        const unsigned int bLev =  pNodes[blkList[blk].getLocalElementBegin()].getLevel();
-                        const unsigned int BLK_DT = 1u<<(m_uiLevMax - bLev);
-                        if( pt% BLK_DT !=0 )
-                            continue;
+                        const unsigned int blk  = activeBlk[b];
+
+                        const unsigned int tR = g.add_task([=](){
+                            const unsigned int BLK_T = m_uiBVec[blk]._time;
+                            const unsigned int sz[3] = { blkList[blk].getAllocationSzX(), blkList[blk].getAllocationSzY(), blkList[blk].getAllocationSzZ()};
+
+                            assert(m_uiBVec[blk]._vec[in].isSynced());
 
-                        sync_blk_timestep(blk,BLK_S);
-                        m_uiBVec[blk]._vec[BLK_S].mark_synced();
-                        //std::cout<<"[NUTS]: pt :  "<<pt<<" blk : "<<blk<<" rk : "<<rk<<" step size: "<<BLK_DT<<" is synced: "<<m_uiBVec[blk]._vec[BLK_S].isSynced()<<std::endl;
+                            // the stage is only kept in the DG stage vector, the padded rhs output is a per thread buffer. 
+                            ts::BlockAsyncVector<T>& kOut = m_uiBOut[omp_get_thread_num()];
+                            kOut.rebind(blk,sz);
+                            kOut.computeVec(m_uiAppCtx, m_uiBVec[blk]._vec[in], current_t + dt_finest*BLK_T);
+                            kOut.zipDG(pMesh,dgStage,DOF);
+                            m_uiBVec[blk]._rks = BLK_S;
+                        }, rhsType);
 
+                        tRhs[(BLK_S-1)*numActive + b] = tR;
+                        g.add_dependency(tR, gBegin);
+
+                        if(BLK_S > 1)
+                        {
+                            const unsigned int tS = g.add_task([=](){
+                                sync_blk_timestep(blk, 1, m_uiAij + (BLK_S-1) * m_uiNumStages, BLK_S-1);
+                            }, BLK_TASK_TYPE::BLK_TASK_MASTER);
+
+                            add_stage_deps(tS, blk, BLK_S-1);
+                            g.add_dependency(tS, tR);
+                        }
                     }
-                        
-                    
                 }
 
                 // compute the time step vector and increment time. 
-                for(unsigned int blk =0; blk < blkList.size(); blk++)
+                for(unsigned int b =0; b < numActive; b++)
                 {
-
-                    const unsigned int BLK_T = m_uiBVec[blk]._time;
-                    const unsigned int NN   =  m_uiBVec[blk]._vec[0].getSz();
+                    const unsigned int blk  = activeBlk[b];
                     const unsigned int bLev =  pNodes[blkList[blk].getLocalElementBegin()].getLevel();
-                    const unsigned int BLK_DT = 1u<<(m_uiLevMax - bLev);
-                    if( pt% BLK_DT !=0 )
-                        continue;
-
-                    T* out_ptr = (T*)m_uiBVec[blk]._vec[0].data();
-                    for(unsigned int s=1;  s <= m_uiNumStages; s++)
-                    {
-                        assert(m_uiBVec[blk]._vec[s].isSynced());
-                        const T* stage_ptr = m_uiBVec[blk]._vec[s].data();
-                        for(unsigned int n =0; n < DOF*NN; n++)
-                            out_ptr[n] += m_uiBi[(s-1)]*stage_ptr[n];
-                    }
 
-                    m_uiBVec[blk]._time += 1u<<(m_uiLevMax -bLev); 
-                    m_uiBVec[blk]._rks=0;
-                    m_uiBVec[blk]._vec[0].mark_synced();
+                    const unsigned int tF = g.add_task([=](){
+                        // new state in the output register, then rotate it into the state register.  
+                        sync_blk_timestep(blk, 1, m_uiBi, m_uiNumStages);
+                        m_uiBVec[blk].swap_vec(0, 1);
 
-                    for(unsigned int s=1;  s <= m_uiNumStages; s++)
-                        m_uiBVec[blk]._vec[s].mark_unsynced();
+                        m_uiBVec[blk]._time += 1u<<(m_uiLevMax -bLev); 
+                        m_uiBVec[blk]._rks=0;
+                        m_uiBVec[blk]._vec[0].mark_synced();
+                        m_uiBVec[blk]._vec[1].mark_unsynced();
+                    }, BLK_TASK_TYPE::BLK_TASK_MASTER);
 
+                    add_stage_deps(tF, blk, m_uiNumStages);
                 }
 
+                g.execute();
 
-                update_ele_timestep();
-                pMesh->readFromGhostBeginElementVec(m_uiEleTime.data(),1);
-                pMesh->readFromGhostEndElementVec(m_uiEleTime.data(),1);
+                this->update_ele_timestep(pt+1);
 
             
             }
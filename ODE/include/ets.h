@@ -16,6 +16,7 @@
 #include "ctx.h"
 #include "dvec.h"
 #include "ts.h"
+#include "blkSched.h"
 
 namespace ts
 {
@@ -66,14 +67,59 @@ namespace ts
             /**@brief: time step info*/
             TSInfo m_uiTimeInfo;
 
-            /**@brief: evolution variables*/
-            DVec m_uiEVar;
+            /**@brief: evolution variables (view of the application ctx variables)*/
+            DVecView m_uiEVar;
             
             /**@brief: stage vector*/
             std::vector<DVec> m_uiStVec;
 
             /**@brief: evolution temp vector*/
             DVec m_uiEVecTmp[2];
+
+            /**@brief: true if the time integrator is a low storage (2N) RK method. (m_uiEVecTmp are the two registers, no stage vectors) */
+            bool m_uiIsLowStorage = false;
+
+            /**@brief: embedded (lower order) weights for the adaptive methods, NULL otherwise. */
+            DendroScalar* m_uiBiHat = NULL;
+
+            /**@brief: lower order of the embedded pair*/
+            unsigned int m_uiErrOrder = 0;
+
+            /**@brief: absolute and relative tolerance for the adaptive methods*/
+            DendroScalar m_uiATol = 1e-6;
+            DendroScalar m_uiRTol = 1e-6;
+
+            /**@brief: min and max time step size for the adaptive methods*/
+            DendroScalar m_uiDtMin = 0.0;
+            DendroScalar m_uiDtMax = 1e10;
+
+            /**@brief: weighted error norm of the last accepted and the previous accepted steps. */
+            DendroScalar m_uiErr = 0.0;
+            DendroScalar m_uiErrPrev = 1.0;
+
+            /**@brief: number of rejected steps*/
+            unsigned int m_uiNumRejected = 0;
+
+            /**@brief: true if the last stage of the embedded pair is evaluated at u^{n+1} (first same as last, FSAL). */
+            bool m_uiIsFSAL = false;
+
+            /**@brief: true if m_uiStVec[0] holds f(u^{n}, t^{n}) from the last stage of the previous accepted step (FSAL). */
+            bool m_uiIsFSALValid = false;
+
+            /**@brief: if true the rhs is computed block wise with Ctx::rhs_blkwise, scheduled with the block task graph. */
+            bool m_uiIsBlkSched = false;
+
+            /**@brief: block task graph*/
+            BlkTaskGraph m_uiBlkGraph;
+
+            /**@brief: local block dependencies (see ts::compute_blk_dependencies), ETS only uses the ghost dependencies (the stage input
+             * is complete before the rhs), the block neighbours are used by the block wise stages in ENUTS. */
+            std::vector<unsigned int> m_uiBlkNbrOffset;
+            std::vector<unsigned int> m_uiBlkNbr;
+            std::vector<unsigned int> m_uiBlkGhostDep;
+
+            /**@brief: unzip in/out vectors of the block wise rhs*/
+            DVec m_uiBlkUnzip[2];
             
 
         private:
@@ -85,6 +131,32 @@ namespace ts
 
             /**@brief: Deallocate internal variables. */
             virtual int deallocate_internal_vars();
+
+            /**@brief: advance to next time step with an embedded pair, retries with smaller step sizes until the error is within the tolerance. */
+            void evolve_adaptive();
+
+            /**
+             * @brief block wise rhs, out = f(in). Each block is unzipped and evaluated (Ctx::rhs_blkwise) as a task, the blocks that do not read 
+             * ghost values run while the ghost exchange of in is in flight. The block unzips run on any thread, except for the special points 
+             * unzip (see ts::is_blk_unzip_local) which unzips all the blocks on the master after the ghost exchange. 
+             */
+            void rhs_blk_sched(DVecView* in, DVecView* out, T time);
+
+        protected:
+            /**@brief: computes the rhs with the application ctx (Ctx::rhs) or the block scheduler.*/
+            inline void compute_rhs(DVecView* in, DVecView* out, T time)
+            {
+                if(m_uiIsBlkSched)
+                    rhs_blk_sched(in, out, time);
+                else
+                    m_uiAppCtx -> rhs(in, out, 1, time);
+            }
+
+            /**@brief: allocates the block scheduler data (block dependencies, and the unzip vectors if withUnzip is true). */
+            void allocate_blk_sched(bool withUnzip);
+
+            /**@brief: deallocates the block scheduler data. */
+            void deallocate_blk_sched();
             
 
         public: 
@@ -117,13 +189,40 @@ namespace ts
              */
             int set_ets_coefficients(ETSType type);
 
+            /**@brief: returns true if the time integrator is a low storage (2N) RK method. */
+            inline bool is_low_storage() const { return m_uiIsLowStorage; }
+
+            /**@brief: returns true if the time integrator is an embedded pair with adaptive step size. */
+            inline bool is_adaptive() const { return (m_uiBiHat!=NULL); }
+
+            /**
+             * @brief sets the parameters for the adaptive step size control. 
+             * @param atol : absolute tolerance
+             * @param rtol : relative tolerance
+             * @param dt_min : minimum step size, the run is aborted if a step with dt = dt_min is rejected (should be > 0). 
+             * @param dt_max : maximum step size (e.g. the CFL limit). 
+             */
+            void set_adaptive_params(DendroScalar atol, DendroScalar rtol, DendroScalar dt_min, DendroScalar dt_max);
+
+            /**@brief: returns the weighted error norm of the last accepted step (adaptive methods). */
+            inline DendroScalar get_step_error() const { return m_uiErr; }
+
+            /**@brief: returns the number of rejected steps so far (adaptive methods). */
+            inline unsigned int get_num_rejected() const { return m_uiNumRejected; }
+
+            /**
+             * @brief: discards the rhs carried over from the last accepted step (FSAL). Should be called if the evolution variables 
+             * are modified outside of evolve(), the FSAL rhs assumes that Ctx::post_timestep does not change them. 
+             */
+            inline void reset_fsal() { m_uiIsFSALValid = false; }
+
             /**
              * @brief Set the evolve vars for the ETS time stepper. 
              * 
              * @param eVar : evolution variables, multiple evolution variables should be added as one vector with multiple dof. 
              * @return int 
              */
-            int set_evolve_vars(DVec eVar);
+            int set_evolve_vars(DVecView eVar);
             
             /**@brief: initialize the ETS solver*/
             void init();
@@ -162,7 +261,7 @@ namespace ts
             const ot::Mesh* get_mesh() const  { return m_uiAppCtx->get_mesh();} 
 
             /**@brief: returns the evolution variables. */ 
-            inline DVec get_evolve_vars() const { return m_uiEVar; }
+            inline DVecView get_evolve_vars() const { return m_uiEVar; }
 
             /**@brief: returns the time step info*/
             inline TSInfo get_timestep_info() const {return m_uiTimeInfo;} 
@@ -172,6 +271,15 @@ namespace ts
             
             /**@brief: advance to next time step*/
             void evolve();
+
+            /**
+             * @brief: enable (disable) the block wise scheduled rhs evaluation. Requires the application rhs to be equivalent to 
+             * unzip, Ctx::rhs_blkwise on all the local blocks and zip. Blocks run concurrently if Ctx::is_rhs_blk_thread_safe(). 
+             */
+            void set_blk_sched(bool flag);
+
+            /**@brief: returns true if the block wise scheduled rhs is enabled. */
+            inline bool is_blk_sched() const { return m_uiIsBlkSched; }
             
     };
 
@@ -185,6 +293,7 @@ namespace ts
         m_uiBi = NULL;
         m_uiCi = NULL;
         m_uiNumStages  = 0;
+        m_uiIsLowStorage = false;
         m_uiTimeInfo = appCtx->get_ts_info();
 
         m_uiEVar = m_uiAppCtx->get_evolution_vars();
@@ -205,6 +314,10 @@ namespace ts
         m_uiCi  = ci;
 
         m_uiNumStages = num_stages;
+        m_uiIsLowStorage = false;
+        m_uiBiHat = NULL;
+        m_uiIsFSAL = false;
+        m_uiIsFSALValid = false;
         return 0;
 
     }
@@ -212,35 +325,182 @@ namespace ts
     template<typename T, typename Ctx>
     int ETS<T,Ctx> :: allocate_internal_vars()
     {
-        m_uiStVec.resize(m_uiNumStages);
-        for(unsigned int i=0; i < m_uiNumStages; i++)
+        // low storage methods only use the two temp. vectors as registers. 
+        m_uiStVec.resize((m_uiIsLowStorage) ? 0 : m_uiNumStages);
+        for(unsigned int i=0; i < m_uiStVec.size(); i++)
             m_uiStVec[i].VecCreate(m_uiAppCtx->get_mesh(), m_uiEVar.IsGhosted() , m_uiEVar.IsUnzip(), m_uiEVar.IsElemental() , m_uiEVar.GetDof());
         
         m_uiEVecTmp[0].VecCreate(m_uiAppCtx->get_mesh(), m_uiEVar.IsGhosted() , m_uiEVar.IsUnzip(), m_uiEVar.IsElemental() , m_uiEVar.GetDof());
 
         m_uiEVecTmp[1].VecCreate(m_uiAppCtx->get_mesh(), m_uiEVar.IsGhosted() , m_uiEVar.IsUnzip(), m_uiEVar.IsElemental() , m_uiEVar.GetDof());
+
+        if(m_uiIsBlkSched)
+            allocate_blk_sched(true);
+
+        // new (or remeshed) stage vectors, the FSAL rhs is gone. 
+        m_uiIsFSALValid = false;
+
         return 0;
     }
     
     template<typename T, typename Ctx>
     int ETS<T,Ctx> :: deallocate_internal_vars()
     {
-        for(unsigned int i=0; i < m_uiNumStages; i++)
+        for(unsigned int i=0; i < m_uiStVec.size(); i++)
             m_uiStVec[i].VecDestroy();
 
         m_uiStVec.clear();
 
         m_uiEVecTmp[0].VecDestroy();
         m_uiEVecTmp[1].VecDestroy();
-        
+
+        deallocate_blk_sched();
         return 0; 
     }
 
+    template<typename T, typename Ctx>
+    void ETS<T,Ctx>::allocate_blk_sched(bool withUnzip)
+    {
+        const ot::Mesh* pMesh = m_uiAppCtx->get_mesh();
+        compute_blk_dependencies(pMesh, m_uiBlkNbrOffset, m_uiBlkNbr, m_uiBlkGhostDep);
+
+        if(withUnzip)
+        {
+            m_uiBlkUnzip[0].VecCreate(pMesh, false, true, false, m_uiEVar.GetDof());
+            m_uiBlkUnzip[1].VecCreate(pMesh, false, true, false, m_uiEVar.GetDof());
+        }
+    }
+
+    template<typename T, typename Ctx>
+    void ETS<T,Ctx>::deallocate_blk_sched()
+    {
+        m_uiBlkGraph.clear();
+        m_uiBlkNbrOffset.clear();
+        m_uiBlkNbr.clear();
+        m_uiBlkGhostDep.clear();
+        m_uiBlkUnzip[0].VecDestroy();
+        m_uiBlkUnzip[1].VecDestroy();
+    }
+
+    template<typename T, typename Ctx>
+    void ETS<T,Ctx>::set_blk_sched(bool flag)
+    {
+        deallocate_blk_sched();
+        m_uiIsBlkSched = flag;
+
+        // allocated here if the internal vars are already allocated, otherwise in allocate_internal_vars. 
+        if(m_uiIsBlkSched && m_uiEVecTmp[0].GetVecArray()!=NULL)
+            allocate_blk_sched(true);
+    }
+
+    template<typename T, typename Ctx>
+    void ETS<T,Ctx>::rhs_blk_sched(DVecView* in, DVecView* out, T time)
+    {
+        ot::Mesh* pMesh = m_uiAppCtx->get_mesh();
+        if(!(pMesh->isActive()))
+            return;
+
+        assert( (in->IsUnzip() == false) && (in->IsGhosted()==true) && (out->IsGhosted()==true) && (in->GetDof()== out->GetDof()));
+        assert(m_uiBlkUnzip[0].GetVecArray()!=NULL && m_uiBlkNbrOffset.size() == pMesh->getLocalBlockList().size()+1);
+
+        const unsigned int dof  = in->GetDof();
+        const unsigned int zSz  = pMesh->getDegOfFreedom();
+        const unsigned int uSz  = pMesh->getDegOfFreedomUnZip();
+        const unsigned int numBlks = pMesh->getLocalBlockList().size();
+        const BLK_TASK_TYPE rhsType = (m_uiAppCtx->is_rhs_blk_thread_safe()) ? BLK_TASK_TYPE::BLK_TASK_ANY : BLK_TASK_TYPE::BLK_TASK_MASTER;
+        const bool isUnzipLocal = is_blk_unzip_local(pMesh);
+
+        T* const inPtr    = in->GetVecArray();
+        T* const outPtr   = out->GetVecArray();
+        T* const uzInPtr  = m_uiBlkUnzip[0].GetVecArray();
+        T* const uzOutPtr = m_uiBlkUnzip[1].GetVecArray();
+        const Ctx* const appCtx = m_uiAppCtx;
+        const DVecView uzIn  = m_uiBlkUnzip[0];
+        const DVecView uzOut = m_uiBlkUnzip[1];
+
+        BlkTaskGraph& g = m_uiBlkGraph;
+        g.clear();
+
+        // ghost exchange of the input. 
+        const unsigned int gBegin = g.add_task([=](){
+            for(unsigned int v=0; v < dof; v++)
+                pMesh->readFromGhostBegin(inPtr + v*zSz, 1);
+        }, BLK_TASK_TYPE::BLK_TASK_MASTER);
+
+        const unsigned int gEnd = g.add_event([=](){
+            for(unsigned int v=0; v < dof; v++)
+                if(!pMesh->isGhostReadComplete(inPtr + v*zSz))
+                    return false;
+            return true;
+        }, [=](){
+            for(unsigned int v=0; v < dof; v++)
+                pMesh->readFromGhostEnd(inPtr + v*zSz, 1);
+        });
+        g.add_dependency(gBegin, gEnd);
+
+        // zip and the ghost exchange of the output, after all the blocks. 
+        const unsigned int zipT = g.add_task([=](){
+            for(unsigned int v=0; v < dof; v++)
+                pMesh->zip(uzOutPtr + v*uSz, outPtr + v*zSz);
+
+            for(unsigned int v=0; v < dof; v++)
+                pMesh->readFromGhostBegin(outPtr + v*zSz, 1);
+
+            for(unsigned int v=0; v < dof; v++)
+                pMesh->readFromGhostEnd(outPtr + v*zSz, 1);
+        }, BLK_TASK_TYPE::BLK_TASK_MASTER);
+
+        // the special points unzip communicates and writes all the blocks, a single unzip of all the blocks on the master. 
+        unsigned int uzAll = 0;
+        if(!isUnzipLocal)
+        {
+            uzAll = g.add_task([=](){
+                for(unsigned int v=0; v < dof; v++)
+                    pMesh->unzip(inPtr + v*zSz, uzInPtr + v*uSz);
+            }, BLK_TASK_TYPE::BLK_TASK_MASTER);
+            g.add_dependency(gEnd, uzAll);
+        }
+
+        for(unsigned int blk=0; blk < numBlks; blk++)
+        {
+            // otherwise the block unzips run concurrently, as soon as the ghost elements they read are exchanged. 
+            unsigned int uzT = uzAll;
+            if(isUnzipLocal)
+            {
+                uzT = g.add_task([=](){
+                    for(unsigned int v=0; v < dof; v++)
+                        pMesh->unzip(inPtr + v*zSz, uzInPtr + v*uSz, &blk, 1);
+                }, BLK_TASK_TYPE::BLK_TASK_ANY);
+
+                if(m_uiBlkGhostDep[blk])
+                    g.add_dependency(gEnd, uzT);
+            }
+
+            const unsigned int rhsT = g.add_task([=](){
+                T bt = time;
+                appCtx->rhs_blkwise(uzIn, uzOut, &blk, 1, &bt);
+            }, rhsType);
+
+            g.add_dependency(uzT, rhsT);
+            g.add_dependency(rhsT, zipT);
+        }
+
+        // the input ghost exchange should be completed before returning. 
+        g.add_dependency(gEnd, zipT);
+        g.execute();
+
+        return;
+    }
+
 
     template<typename T, typename  Ctx>
     int ETS<T,Ctx>::set_ets_coefficients(ETSType type)
     {
         m_uiType = type ;
+        m_uiIsLowStorage = false;
+        m_uiBiHat = NULL;
+        m_uiIsFSAL = false;
+        m_uiIsFSALValid = false;
 
         if(type == ETSType::RK3)
         {
@@ -290,6 +550,94 @@ namespace ts
             m_uiBi  =  (DendroScalar*)ETS_C;
             m_uiAij =  (DendroScalar*)ETS_U;
 
+        }else if (type == ETSType::LSRK3 || type == ETSType::LSRK4)
+        {
+            // 2N storage form, 
+            // du = A_i du + dt f(u, t + c_i dt)
+            // u  = u + B_i du
+            // m_uiAij stores A_i, m_uiBi stores B_i and m_uiCi stores c_i. 
+            m_uiIsLowStorage = true;
+
+            if(type == ETSType::LSRK3)
+            {
+                // Williamson (1980), 3 stage 3rd order. 
+                m_uiNumStages = 3;
+                static const DendroScalar ETS_A[] = { 0.0, -5.0/9.0, -153.0/128.0 };
+                static const DendroScalar ETS_B[] = { 1.0/3.0, 15.0/16.0, 8.0/15.0 };
+                static const DendroScalar ETS_T[] = { 0.0, 1.0/3.0, 3.0/4.0 };
+
+                m_uiCi  =  (DendroScalar*)ETS_T;
+                m_uiBi  =  (DendroScalar*)ETS_B;
+                m_uiAij =  (DendroScalar*)ETS_A;
+
+            }else
+            {
+                // Carpenter & Kennedy (1994), 5 stage 4th order. 
+                m_uiNumStages = 5;
+                static const DendroScalar ETS_A[] = { 0.0, 
+                                                      -567301805773.0/1357537059087.0, 
+                                                      -2404267990393.0/2016746695238.0, 
+                                                      -3550918686646.0/2091501179385.0, 
+                                                      -1275806237668.0/842570457699.0 };
+
+                static const DendroScalar ETS_B[] = { 1432997174477.0/9575080441755.0, 
+                                                      5161836677717.0/13612068292357.0, 
+                                                      1720146321549.0/2090206949498.0, 
+                                                      3134564353537.0/4481467310338.0, 
+                                                      2277821191437.0/14882151754819.0 };
+
+                static const DendroScalar ETS_T[] = { 0.0, 
+                                                      1432997174477.0/9575080441755.0, 
+                                                      2526269341429.0/6820363266100.0, 
+                                                      2006345519317.0/3224310063776.0, 
+                                                      2802321613138.0/2924317926251.0 };
+
+                m_uiCi  =  (DendroScalar*)ETS_T;
+                m_uiBi  =  (DendroScalar*)ETS_B;
+                m_uiAij =  (DendroScalar*)ETS_A;
+            }
+
+        }else if (type == ETSType::BS32)
+        {
+            // Bogacki-Shampine 3(2)
+            m_uiNumStages = 4;
+            m_uiErrOrder  = 2;
+            static const DendroScalar ETS_C[] = {2.0/9.0, 1.0/3.0, 4.0/9.0, 0.0};
+            static const DendroScalar ETS_E[] = {7.0/24.0, 1.0/4.0, 1.0/3.0, 1.0/8.0};
+            static const DendroScalar ETS_T[] = {0.0, 1.0/2.0, 3.0/4.0, 1.0};
+            static const DendroScalar ETS_U[] = { 0.0     , 0.0      , 0.0      , 0.0,
+                                                  1.0/2.0 , 0.0      , 0.0      , 0.0,
+                                                  0.0     , 3.0/4.0  , 0.0      , 0.0,
+                                                  2.0/9.0 , 1.0/3.0  , 4.0/9.0  , 0.0 };
+
+            m_uiCi    =  (DendroScalar*)ETS_T;
+            m_uiBi    =  (DendroScalar*)ETS_C;
+            m_uiBiHat =  (DendroScalar*)ETS_E;
+            m_uiAij   =  (DendroScalar*)ETS_U;
+            m_uiIsFSAL = true;
+
+        }else if (type == ETSType::DP54)
+        {
+            // Dormand-Prince 5(4)
+            m_uiNumStages = 7;
+            m_uiErrOrder  = 4;
+            static const DendroScalar ETS_C[] = {35.0/384.0, 0.0, 500.0/1113.0, 125.0/192.0, -2187.0/6784.0, 11.0/84.0, 0.0};
+            static const DendroScalar ETS_E[] = {5179.0/57600.0, 0.0, 7571.0/16695.0, 393.0/640.0, -92097.0/339200.0, 187.0/2100.0, 1.0/40.0};
+            static const DendroScalar ETS_T[] = {0.0, 1.0/5.0, 3.0/10.0, 4.0/5.0, 8.0/9.0, 1.0, 1.0};
+            static const DendroScalar ETS_U[] = { 0.0               , 0.0               , 0.0               , 0.0            , 0.0              , 0.0       , 0.0,
+                                                  1.0/5.0           , 0.0               , 0.0               , 0.0            , 0.0              , 0.0       , 0.0,
+                                                  3.0/40.0          , 9.0/40.0          , 0.0               , 0.0            , 0.0              , 0.0       , 0.0,
+                                                  44.0/45.0         , -56.0/15.0        , 32.0/9.0          , 0.0            , 0.0              , 0.0       , 0.0,
+                                                  19372.0/6561.0    , -25360.0/2187.0   , 64448.0/6561.0    , -212.0/729.0   , 0.0              , 0.0       , 0.0,
+                                                  9017.0/3168.0     , -355.0/33.0       , 46732.0/5247.0    , 49.0/176.0     , -5103.0/18656.0  , 0.0       , 0.0,
+                                                  35.0/384.0        , 0.0               , 500.0/1113.0      , 125.0/192.0    , -2187.0/6784.0   , 11.0/84.0 , 0.0 };
+
+            m_uiCi    =  (DendroScalar*)ETS_T;
+            m_uiBi    =  (DendroScalar*)ETS_C;
+            m_uiBiHat =  (DendroScalar*)ETS_E;
+            m_uiAij   =  (DendroScalar*)ETS_U;
+            m_uiIsFSAL = true;
+
         }else
             return -1;
 
@@ -298,6 +646,16 @@ namespace ts
         return 0;
     }
 
+    template<typename T, typename  Ctx>
+    void ETS<T,Ctx>::set_adaptive_params(DendroScalar atol, DendroScalar rtol, DendroScalar dt_min, DendroScalar dt_max)
+    {
+        m_uiATol  = atol;
+        m_uiRTol  = rtol;
+        m_uiDtMin = dt_min;
+        m_uiDtMax = dt_max;
+        return;
+    }
+
     template<typename T, typename  Ctx>
     void ETS<T,Ctx>::init()
     {
@@ -308,15 +666,22 @@ namespace ts
     }
 
     template<typename T, typename Ctx>
-    int ETS<T,Ctx>::set_evolve_vars(DVec eVars)
+    int ETS<T,Ctx>::set_evolve_vars(DVecView eVars)
     {
         m_uiEVar = eVars;
+        m_uiIsFSALValid = false;
         return 0; 
     }
 
     template<typename T, typename  Ctx>
     void ETS<T, Ctx>::evolve()
     {
+        if(is_adaptive())
+        {
+            evolve_adaptive();
+            return;
+        }
+
         const ot::Mesh* pMesh = m_uiAppCtx->get_mesh();
         m_uiTimeInfo = m_uiAppCtx->get_ts_info();
         const double current_t= m_uiTimeInfo._m_uiT;
@@ -339,25 +704,62 @@ namespace ts
             double dx,dy,dz;
             
             m_uiAppCtx->pre_timestep(m_uiEVar);
-            for(int stage=0; stage< m_uiNumStages ; stage++)
+
+            if(m_uiIsLowStorage)
+            {
+                // 2N storage RK : m_uiEVecTmp[0] : du register, m_uiEVecTmp[1] : rhs (k) of the current stage. 
+                DVec& du  = m_uiEVecTmp[0];
+                DVec& k   = m_uiEVecTmp[1];
+                for(unsigned int stage=0; stage< m_uiNumStages ; stage++)
+                {
+                    current_t_adv=current_t+m_uiCi[stage] * dt;
+
+                    m_uiAppCtx -> pre_stage(k);
+                    this->compute_rhs(&m_uiEVar, &k, current_t_adv);
+                    m_uiAppCtx -> post_stage(k);
+
+                    if(stage==0)
+                    {   // A_0 = 0, du is not initialized. 
+                        du.VecCopy(k,true);
+                        du.VecFMA(m_uiAppCtx->get_mesh(), dt, 0, true);
+                    }else
+                        du.VecFMA(m_uiAppCtx->get_mesh(), k, m_uiAij[stage], dt, true);
+
+                    m_uiEVar.VecFMA(m_uiAppCtx->get_mesh(), du, 1, m_uiBi[stage], true);
+                }
+
+            }else
             {
-                //m_uiEVecTmp[0].VecCopy(m_uiEVar,true);
-                m_uiEVecTmp[0].VecFMA(m_uiAppCtx->get_mesh(),m_uiEVar,0,1.0,true); 
-                
-                for(int p = 0 ; p < stage;  p++ )
-                    m_uiEVecTmp[0].VecFMA(m_uiAppCtx->get_mesh(), m_uiStVec[stage], 1, m_uiAij[(stage)*m_uiNumStages + p]*dt,true);
+                // linear combination vectors & coefficients, {u, k_0, k_1, ... }
+                std::vector<DVecView> lcVecs(m_uiNumStages+1);
+                std::vector<DendroScalar> lcCoeffs(m_uiNumStages+1);
+                lcVecs[0]   = m_uiEVar;
+                lcCoeffs[0] = 1.0;
+                for(unsigned int p=0; p < m_uiNumStages; p++)
+                    lcVecs[p+1] = m_uiStVec[p];
 
-                current_t_adv=current_t+m_uiCi[stage] * dt;
+                for(int stage=0; stage< m_uiNumStages ; stage++)
+                {
+                    // u + dt \sum_{p<stage} a_{stage,p} k_p in a single pass. 
+                    for(int p = 0 ; p < stage;  p++ )
+                        lcCoeffs[p+1] = m_uiAij[(stage)*m_uiNumStages + p]*dt;
 
-                m_uiAppCtx -> pre_stage(m_uiStVec[stage]);
-                m_uiAppCtx -> rhs(&m_uiEVecTmp[0], &m_uiStVec[stage], 1, current_t_adv);
-                m_uiAppCtx -> post_stage(m_uiStVec[stage]);
-                
+                    m_uiEVecTmp[0].VecLinComb(m_uiAppCtx->get_mesh(), lcCoeffs.data(), lcVecs.data(), stage+1, true);
 
-            }
+                    current_t_adv=current_t+m_uiCi[stage] * dt;
+
+                    m_uiAppCtx -> pre_stage(m_uiStVec[stage]);
+                    this->compute_rhs(&m_uiEVecTmp[0], &m_uiStVec[stage], current_t_adv);
+                    m_uiAppCtx -> post_stage(m_uiStVec[stage]);
+                    
+
+                }
+
+                for(unsigned int k=0; k< m_uiNumStages; k++)
+                    lcCoeffs[k+1] = m_uiBi[k]*dt;
 
-            for(unsigned int k=0; k< m_uiNumStages; k++)
-                m_uiEVar.VecFMA(m_uiAppCtx->get_mesh(), m_uiStVec[k], 1, m_uiBi[k]*dt, true);
+                m_uiEVar.VecLinComb(m_uiAppCtx->get_mesh(), lcCoeffs.data(), lcVecs.data(), m_uiNumStages+1, true);
+            }
             
             m_uiAppCtx->post_timestep(m_uiEVar);
             
@@ -371,6 +773,124 @@ namespace ts
         
     }
     
+    template<typename T, typename  Ctx>
+    void ETS<T, Ctx>::evolve_adaptive()
+    {
+        const ot::Mesh* pMesh = m_uiAppCtx->get_mesh();
+        m_uiTimeInfo = m_uiAppCtx->get_ts_info();
+        const double current_t= m_uiTimeInfo._m_uiT;
+        double current_t_adv=current_t;
+        double dt = std::min(m_uiTimeInfo._m_uiTh, m_uiDtMax);
+
+        // controller exponent 1/(q+1)
+        const DendroScalar ek = 1.0/(m_uiErrOrder + 1.0);
+
+        // linear combination vectors & coefficients, {u, k_0, k_1, ... }
+        std::vector<DVecView> lcVecs(m_uiNumStages+1);
+        std::vector<DendroScalar> lcCoeffs(m_uiNumStages+1);
+        std::vector<DendroScalar> errCoeffs(m_uiNumStages+1);
+        lcCoeffs[0]  = 1.0;
+        errCoeffs[0] = 0.0;
+
+        if(pMesh->isActive())
+        {
+            lcVecs[0] = m_uiEVar;
+            for(unsigned int p=0; p < m_uiNumStages; p++)
+                lcVecs[p+1] = m_uiStVec[p];
+
+            m_uiAppCtx->pre_timestep(m_uiEVar);
+        }
+
+        // k_0 = f(u^{n}, t^{n}) is reused from the previous step (FSAL) and by the retries of a rejected step. 
+        unsigned int sBegin = (m_uiIsFSAL && m_uiIsFSALValid) ? 1 : 0;
+
+        DendroScalar err = 0.0;
+        bool isRejected = false;
+        while(true)
+        {
+            // [0] : sum of the squared weighted errors, [1]: number of entries
+            DendroScalar err_l[2] = {0.0, 0.0};
+            DendroScalar err_g[2] = {0.0, 0.0};
+
+            if(pMesh->isActive())
+            {
+                for(unsigned int stage=sBegin; stage< m_uiNumStages ; stage++)
+                {
+                    for(unsigned int p = 0 ; p < stage;  p++ )
+                        lcCoeffs[p+1] = m_uiAij[(stage)*m_uiNumStages + p]*dt;
+
+                    m_uiEVecTmp[0].VecLinComb(pMesh, lcCoeffs.data(), lcVecs.data(), stage+1, true);
+
+                    current_t_adv=current_t+m_uiCi[stage] * dt;
+
+                    m_uiAppCtx -> pre_stage(m_uiStVec[stage]);
+                    this->compute_rhs(&m_uiEVecTmp[0], &m_uiStVec[stage], current_t_adv);
+                    m_uiAppCtx -> post_stage(m_uiStVec[stage]);
+                }
+
+                for(unsigned int k=0; k< m_uiNumStages; k++)
+                {
+                    lcCoeffs[k+1]  = m_uiBi[k]*dt;
+                    errCoeffs[k+1] = (m_uiBi[k] - m_uiBiHat[k])*dt;
+                }
+
+                // u^{n+1} is written to m_uiEVecTmp[1] so that a rejected step leaves u^{n} untouched. 
+                DendroIntL n = 0;
+                m_uiEVecTmp[1].VecLinCombErr(pMesh, lcCoeffs.data(), errCoeffs.data(), lcVecs.data(), m_uiNumStages+1, m_uiATol, m_uiRTol, err_l[0], n, true);
+                err_l[1] = n;
+            }
+
+            // one reduction per attempt, inactive ranks take part so that all the ranks agree on the step size. 
+            par::Mpi_Allreduce(err_l, err_g, 2, MPI_SUM, get_global_comm());
+            err = (err_g[1] > 0) ? sqrt(err_g[0]/err_g[1]) : 0.0;
+
+            if(std::isfinite(err) && err <= 1.0)
+                break;
+
+            if(dt <= m_uiDtMin)
+            {
+                if(!get_global_rank())
+                    std::cout<<"ETS error at "<<__func__<<" line : "<<__LINE__<<" step rejected at the minimum step size dt_min : "<<m_uiDtMin<<" err : "<<err<<std::endl;
+                MPI_Abort(get_global_comm(),1);
+            }
+
+            // a non-finite error (e.g. nan in one of the stages) carries no step size information, take the largest cut. 
+            const DendroScalar facRej = (std::isfinite(err)) ? std::max(ETS_ADAP_FAC_MIN, ETS_ADAP_SAFETY * pow(err, -ek)) : ETS_ADAP_FAC_MIN;
+            dt = std::max(m_uiDtMin, dt * facRej);
+            isRejected = true;
+            m_uiNumRejected++;
+            sBegin = 1;
+        }
+
+        if(pMesh->isActive())
+        {
+            const DendroScalar one = 1.0;
+            const DVecView uNext = m_uiEVecTmp[1];
+            m_uiEVar.VecLinComb(pMesh, &one, &uNext, 1, true);
+            m_uiAppCtx->post_timestep(m_uiEVar);
+
+            // FSAL: the last stage is f(u^{n+1}, t^{n+1}), i.e. k_0 of the next step. 
+            if(m_uiIsFSAL)
+            {
+                std::swap(m_uiStVec[0], m_uiStVec[m_uiNumStages-1]);
+                m_uiIsFSALValid = true;
+            }
+        }
+
+        // PI step size controller for the next step. 
+        m_uiErr = err;
+        DendroScalar fac = ETS_ADAP_SAFETY * pow(std::max(err, 1e-10), -ETS_ADAP_PI_ALPHA*ek) * pow(m_uiErrPrev, ETS_ADAP_PI_BETA*ek);
+        fac = std::min((isRejected) ? 1.0 : ETS_ADAP_FAC_MAX, std::max(ETS_ADAP_FAC_MIN, fac));
+        m_uiErrPrev = std::max(err, 1e-4);
+
+        m_uiAppCtx->set_ts_size(dt);
+        m_uiAppCtx->increment_ts_info();
+        m_uiAppCtx->set_ts_size(std::min(m_uiDtMax, std::max(m_uiDtMin, dt*fac)));
+        m_uiTimeInfo = m_uiAppCtx->get_ts_info();
+        pMesh->waitAll();
+
+    }
+    
     template<typename T, typename Ctx>
     unsigned int ETS<T,Ctx>::get_active_rank() const {
         if(is_active())
@@ -13,6 +13,8 @@
 #include <vector>
 #include "mpi.h"
 #include <bitset>
+#include <cstring>
+#include <algorithm>
 #include "TreeNode.h"
 #include "mesh.h"
 #include "asyncCtxByLev.h"
@@ -122,6 +124,91 @@ namespace ot
 
             
             
+    };
+
+    /**
+     * @brief Element DG ghost exchange restricted by the time stepper level. 
+     * For each neighbour proc. the send (recv) elements are ordered by level, finest first. The levels that advance at a 
+     * NUTS sub step are [l, lmax], hence the elements to exchange are a prefix of each proc. segment and one message per 
+     * neighbour is enough. 
+     */
+    class SubScatterMapEleDG
+    {
+        protected:
+            
+            /**@brief: pointer to mesh */
+            const ot::Mesh* m_uiMesh;
+
+            /**@brief: min level of the grid*/
+            unsigned int m_uiLMin;
+
+            /**@brief: max level of the grid*/
+            unsigned int m_uiLMax;
+
+            /**@brief: send element ids (in the all elements array), ordered by level (finest first) within each proc*/
+            std::vector<unsigned int> m_uiSendEleSM;
+
+            /**@brief: recv element ids (in the all elements array), ordered by level (finest first) within each proc*/
+            std::vector<unsigned int> m_uiRecvEleSM;
+
+            /**@brief: send element offsets by proc*/
+            std::vector<unsigned int> m_uiSendOffset;
+
+            /**@brief: recv element offsets by proc*/
+            std::vector<unsigned int> m_uiRecvOffset;
+
+            /**@brief: number of send elements with level >= l for proc p, stored at [l*npes + p]*/
+            std::vector<unsigned int> m_uiSendCount;
+
+            /**@brief: number of recv elements with level >= l for proc p, stored at [l*npes + p]*/
+            std::vector<unsigned int> m_uiRecvCount;
+
+            /**@brief: List of async requests by lev*/
+            std::vector<ot::AsyncCommByLev> m_uiAsyncCtxList;
+
+            /**@brief: Async communication Tag*/
+            unsigned int m_uiAsyncTag=0;
+
+        protected:
+            /**@brief: computes the level ordered element scatter maps. */
+            void compute_L2SM();
+
+        public:
+            /**
+             * @brief Construct a new level restricted DG scatter map. 
+             * @param pMesh pointer to the mesh. 
+             */
+            SubScatterMapEleDG(const ot::Mesh* pMesh);
+
+            /**@brief: default deallocator*/
+            ~SubScatterMapEleDG(){};
+
+            /**@brief: number of elements sent with level >= l*/
+            unsigned int get_send_count(unsigned int l) const;
+
+            /**@brief: returns true if the ghost exchange of vec for the level l (started with readFromGhostBegin) is completed, (non blocking, MPI_Test)*/
+            bool isGhostReadComplete(const void* vec, unsigned int l);
+
+            /**
+             * @brief Perform DG ghost read begin (async) for the elements with level >= l 
+             * @tparam T type of the vector
+             * @param vec : input DG vector
+             * @param l : min. level of the ghost sync
+             * @param dof : number of dof
+             */
+            template<typename T>
+            void readFromGhostBegin(T * vec, unsigned int l ,unsigned int dof=1);
+
+            /**
+             * @brief Perform DG ghost read end (async) for the elements with level >= l 
+             * @tparam T type of the vector
+             * @param vec : input DG vector
+             * @param l : min. level of the ghost sync
+             * @param dof : number of dof
+             */
+            template<typename T>
+            void readFromGhostEnd(T * vec, unsigned int l ,unsigned int dof=1);
+
     };
 
 
@@ -290,6 +377,163 @@ namespace ot
     }
 
 
+    template<typename T>
+    void SubScatterMapEleDG::readFromGhostBegin(T* vec, unsigned int l, unsigned int dof)
+    {
+        if( m_uiMesh -> getMPICommSizeGlobal() == 1 || (!m_uiMesh->isActive()))
+            return;
+
+        l = std::max(l,m_uiLMin);
+        if(l > m_uiLMax)
+            return;
+
+        MPI_Comm commActive = m_uiMesh->getMPICommunicator();
+        const unsigned int activeNpes = m_uiMesh->getMPICommSize();
+        const unsigned int nPe = m_uiMesh->getNumNodesPerElement();
+        const unsigned int dgSz = m_uiMesh->getAllElements().size() * nPe;
+        const std::vector<unsigned int>& sProcList = m_uiMesh->getSendEleProcList();
+        const std::vector<unsigned int>& rProcList = m_uiMesh->getRecvEleProcList();
+        const unsigned int * const sCount = m_uiSendCount.data() + l*activeNpes;
+        const unsigned int * const rCount = m_uiRecvCount.data() + l*activeNpes;
+
+        unsigned int sendBSz = 0;
+        unsigned int recvBSz = 0;
+        for(unsigned int p=0; p < sProcList.size(); p++)
+            sendBSz += sCount[sProcList[p]];
+
+        for(unsigned int p=0; p < rProcList.size(); p++)
+            recvBSz += rCount[rProcList[p]];
+
+        ot::AsyncCommByLev ctx(vec,l);
+        
+        if(recvBSz)
+        {
+            ctx.allocateRecvBuffer(sizeof(T)*recvBSz*nPe*dof);
+            T* recvB = (T*)ctx.getRecvBuffer();
+            unsigned int bOffset = 0;
+
+            for(unsigned int recv_p=0; recv_p < rProcList.size(); recv_p++)
+            {
+                const unsigned int proc_id = rProcList[recv_p];
+                if(rCount[proc_id]==0)
+                    continue;
+
+                MPI_Request* req = new MPI_Request();
+                par::Mpi_Irecv(recvB + bOffset, dof*nPe*rCount[proc_id], proc_id, m_uiAsyncTag, commActive, req);
+                ctx.getRequestList().push_back(req);
+                bOffset += dof*nPe*rCount[proc_id];
+            }
+        }
+
+        if(sendBSz)
+        {
+            ctx.allocateSendBuffer(sizeof(T)*sendBSz*nPe*dof);
+            T* sendB = (T*)ctx.getSendBuffer();
+            unsigned int bOffset = 0;
+
+            for(unsigned int send_p=0; send_p < sProcList.size(); send_p++)
+            {
+                const unsigned int proc_id = sProcList[send_p];
+                const unsigned int cnt = sCount[proc_id];
+                if(cnt==0)
+                    continue;
+                
+                const unsigned int * const sm = m_uiSendEleSM.data() + m_uiSendOffset[proc_id];
+                for(unsigned int var=0; var < dof; var++)
+                {
+                    const T* const v = vec + var*dgSz;
+                    for(unsigned int k=0; k < cnt; k++)
+                        std::memcpy(sendB + bOffset + (var*cnt + k)*nPe, v + sm[k]*nPe, sizeof(T)*nPe);
+                }
+
+                MPI_Request* req = new MPI_Request();
+                par::Mpi_Isend(sendB + bOffset, dof*nPe*cnt, proc_id, m_uiAsyncTag, commActive, req);
+                ctx.getRequestList().push_back(req);
+                bOffset += dof*nPe*cnt;
+            }
+        }
+
+        m_uiAsyncTag++;
+        m_uiAsyncCtxList.push_back(ctx);
+        return;
+
+    }
+
+    template<typename T>
+    void SubScatterMapEleDG::readFromGhostEnd(T* vec, unsigned int l, unsigned int dof)
+    {
+        if( m_uiMesh -> getMPICommSizeGlobal() == 1 || (!m_uiMesh->isActive()))
+            return;
+
+        l = std::max(l,m_uiLMin);
+        if(l > m_uiLMax)
+            return;
+
+        const unsigned int activeNpes = m_uiMesh->getMPICommSize();
+        const unsigned int nPe = m_uiMesh->getNumNodesPerElement();
+        const unsigned int dgSz = m_uiMesh->getAllElements().size() * nPe;
+        const std::vector<unsigned int>& rProcList = m_uiMesh->getRecvEleProcList();
+        const unsigned int * const rCount = m_uiRecvCount.data() + l*activeNpes;
+
+        int ctxIndex=-1;
+        for(unsigned int i=0;i<m_uiAsyncCtxList.size();i++)
+        {
+            if(m_uiAsyncCtxList[i].getBuffer()==vec && m_uiAsyncCtxList[i].getLevel() == l)
+            {
+                ctxIndex=i;
+                break;
+            }
+        }
+
+        if(ctxIndex<0)
+        {
+            std::cout<<" Rank: "<<m_uiMesh->getMPIRank()<<" [SubSM Error]: "<<__LINE__<<" readFromGhostEnd async context not foound:  "<<std::endl;
+            MPI_Abort(m_uiMesh->getMPICommunicator(),0);
+        }
+
+        ot::AsyncCommByLev ctx = m_uiAsyncCtxList[ctxIndex];
+
+        MPI_Status status;
+        for (unsigned int i = 0; i < ctx.getRequestList().size(); i++)
+            MPI_Wait(ctx.getRequestList()[i], &status);
+
+        if(ctx.getRecvBuffer()!=NULL)
+        {
+            const T* const recvB = (const T*)ctx.getRecvBuffer();
+            unsigned int bOffset = 0;
+
+            for(unsigned int recv_p=0; recv_p < rProcList.size(); recv_p++)
+            {
+                const unsigned int proc_id = rProcList[recv_p];
+                const unsigned int cnt = rCount[proc_id];
+                if(cnt==0)
+                    continue;
+                
+                const unsigned int * const sm = m_uiRecvEleSM.data() + m_uiRecvOffset[proc_id];
+                for(unsigned int var=0; var < dof; var++)
+                {
+                    T* const v = vec + var*dgSz;
+                    for(unsigned int k=0; k < cnt; k++)
+                        std::memcpy(v + sm[k]*nPe, recvB + bOffset + (var*cnt + k)*nPe, sizeof(T)*nPe);
+                }
+
+                bOffset += dof*nPe*cnt;
+            }
+        }
+
+        ctx.deAllocateSendBuffer();
+        ctx.deAllocateRecvBuffer();
+
+        for (unsigned int i = 0; i < ctx.getRequestList().size(); i++)
+            delete ctx.getRequestList()[i];
+
+        ctx.getRequestList().clear();
+        m_uiAsyncCtxList.erase(m_uiAsyncCtxList.begin() + ctxIndex);
+        return;
+
+    }
+
+
 } // end of namespace ot
 
 
@@ -22,8 +22,21 @@ namespace ts
 
     /**
      * @brief default available time integrator methods. 
+     * LSRK3 : Williamson 3 stage 3rd order low storage (2N) RK method. 
+     * LSRK4 : Carpenter-Kennedy 5 stage 4th order low storage (2N) RK method. 
+     * BS32  : Bogacki-Shampine 3(2) embedded pair, adaptive step size. 
+     * DP54  : Dormand-Prince 5(4) embedded pair, adaptive step size. 
+     * Low storage and embedded methods are only supported by the uniform time stepper (ETS). 
      */
-    enum ETSType {RK3=0, RK4, RK5};
+    enum ETSType {RK3=0, RK4, RK5, LSRK3, LSRK4, BS32, DP54};
+
+    /**@brief: step size controller parameters for the embedded (adaptive) methods. */
+    #define ETS_ADAP_SAFETY 0.9
+    #define ETS_ADAP_FAC_MIN 0.2
+    #define ETS_ADAP_FAC_MAX 5.0
+    /**@brief: PI controller gains (scaled by 1/(q+1), q is the lower order of the pair) */
+    #define ETS_ADAP_PI_ALPHA 0.7
+    #define ETS_ADAP_PI_BETA 0.4
     
 
     /**@brief data type to store the time stepper level. */
@@ -0,0 +1,271 @@
+/**
+ * @file blkSched.cpp
+ * @brief Dependency driven task scheduler for the block wise time steppers.
+ * @version 0.1
+ *
+ * School of Computing, University of Utah.
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include "blkSched.h"
+#include <algorithm>
+
+namespace ts
+{
+
+    unsigned int BlkTaskGraph::add_task(const std::function<void()>& work, BLK_TASK_TYPE type)
+    {
+        assert(type != BLK_TASK_TYPE::BLK_TASK_EVENT);
+        BlkTask t;
+        t.work = work;
+        t.type = type;
+        t.numDep = 0;
+        m_uiTasks.push_back(t);
+        return m_uiTasks.size()-1;
+    }
+
+    unsigned int BlkTaskGraph::add_event(const std::function<bool()>& test, const std::function<void()>& work)
+    {
+        BlkTask t;
+        t.work = work;
+        t.test = test;
+        t.type = BLK_TASK_TYPE::BLK_TASK_EVENT;
+        t.numDep = 0;
+        m_uiTasks.push_back(t);
+        return m_uiTasks.size()-1;
+    }
+
+    void BlkTaskGraph::add_dependency(unsigned int before, unsigned int after)
+    {
+        assert(before < m_uiTasks.size() && after < m_uiTasks.size() && before!=after);
+        m_uiTasks[before].succ.push_back(after);
+        m_uiTasks[after].numDep++;
+    }
+
+    void BlkTaskGraph::clear()
+    {
+        m_uiTasks.clear();
+        m_uiDepCount.clear();
+        m_uiMasterReady.clear();
+        m_uiNumPending = 0;
+    }
+
+    void BlkTaskGraph::release(unsigned int i)
+    {
+        // note: taskyield may not execute the spawned tasks, hence with a single thread everything runs on the master.
+        if(m_uiTasks[i].type == BLK_TASK_TYPE::BLK_TASK_ANY && m_uiNumThreads > 1)
+        {
+            #pragma omp task firstprivate(i)
+            run(i);
+        }
+        else
+        {
+            #pragma omp critical (blk_sched_master)
+            m_uiMasterReady.push_back(i);
+        }
+    }
+
+    void BlkTaskGraph::run(unsigned int i)
+    {
+        if(m_uiTasks[i].work)
+            m_uiTasks[i].work();
+
+        complete(i);
+    }
+
+    void BlkTaskGraph::complete(unsigned int i)
+    {
+        const std::vector<unsigned int>& succ = m_uiTasks[i].succ;
+        for(unsigned int k=0; k < succ.size(); k++)
+        {
+            unsigned int c;
+            #pragma omp atomic capture
+            c = --m_uiDepCount[succ[k]];
+
+            if(c==0)
+                release(succ[k]);
+        }
+
+        // successors are released before, so pending does not reach 0 early.
+        #pragma omp atomic
+        m_uiNumPending--;
+    }
+
+    void BlkTaskGraph::progress()
+    {
+        std::vector<unsigned int> ready;
+        std::vector<unsigned int> events;
+        unsigned int pending;
+
+        do
+        {
+            #pragma omp critical (blk_sched_master)
+            ready.swap(m_uiMasterReady);
+
+            for(unsigned int k=0; k < ready.size(); k++)
+            {
+                if(m_uiTasks[ready[k]].type == BLK_TASK_TYPE::BLK_TASK_EVENT)
+                    events.push_back(ready[k]);
+                else
+                    run(ready[k]);
+            }
+            ready.clear();
+
+            for(unsigned int k=0; k < events.size(); )
+            {
+                if(m_uiTasks[events[k]].test())
+                {
+                    run(events[k]);
+                    events[k] = events.back();
+                    events.pop_back();
+                }
+                else
+                    k++;
+            }
+
+            #pragma omp atomic read
+            pending = m_uiNumPending;
+
+            if(pending)
+            {
+                #pragma omp taskyield
+            }
+
+        }while(pending);
+
+    }
+
+    void BlkTaskGraph::execute()
+    {
+        const unsigned int n = m_uiTasks.size();
+        if(n==0)
+            return;
+
+        m_uiDepCount.resize(n);
+        for(unsigned int i=0; i < n; i++)
+            m_uiDepCount[i] = m_uiTasks[i].numDep;
+
+        m_uiNumPending = n;
+        m_uiMasterReady.clear();
+
+        #pragma omp parallel
+        {
+            #pragma omp master
+            {
+                m_uiNumThreads = omp_get_num_threads();
+
+                #pragma omp taskgroup
+                {
+                    for(unsigned int i=0; i < n; i++)
+                        if(m_uiTasks[i].numDep==0)
+                            release(i);
+
+                    progress();
+                }
+            }
+        }
+
+        assert(m_uiNumPending==0);
+        return;
+    }
+
+
+    void compute_blk_dependencies(const ot::Mesh* pMesh, std::vector<unsigned int>& nbrOffset, std::vector<unsigned int>& nbr, std::vector<unsigned int>& isGhostDep)
+    {
+        nbrOffset.clear();
+        nbr.clear();
+        isGhostDep.clear();
+
+        if(!(pMesh->isActive()))
+            return;
+
+        const std::vector<ot::Block>& blkList = pMesh->getLocalBlockList();
+        const ot::TreeNode* pNodes = pMesh->getAllElements().data();
+        const unsigned int numBlks = blkList.size();
+
+        const std::vector<unsigned int>& e2e = pMesh->getE2EMapping();
+        const std::vector<unsigned int>& e2b = pMesh->getE2BlkMap();
+        const unsigned int numDir = pMesh->getNumDirections();
+        const unsigned int eLocalBegin = pMesh->getElementLocalBegin();
+        const unsigned int eLocalEnd = pMesh->getElementLocalEnd();
+
+        nbrOffset.resize(numBlks+1,0);
+        isGhostDep.resize(numBlks,0);
+
+        // the unzip with the special points (order 4, padding width 3) communicates, every block depends on the ghost exchange.
+        const bool isAllGhostDep = (pMesh->getMPICommSize() > 1 && !is_blk_unzip_local(pMesh));
+        const bool computeGhostDep = (pMesh->getMPICommSize() > 1 && !isAllGhostDep);
+        if(isAllGhostDep)
+            isGhostDep.assign(numBlks,1);
+
+        // the elements that intersect the padded block box [pMin, pMax) are found by walking the e2e map from the block elements,
+        // (the walk does not leave the padded box, so the cost is linear in the block and padding elements).
+        std::vector<unsigned int> eVisited(pMesh->getAllElements().size(),LOOK_UP_TABLE_DEFAULT);
+        std::vector<unsigned int> bVisited(numBlks,LOOK_UP_TABLE_DEFAULT);
+        std::vector<unsigned int> eQueue;
+
+        for(unsigned int b=0; b < numBlks; b++)
+        {
+            nbrOffset[b] = nbr.size();
+
+            const ot::TreeNode blkNode = blkList[b].getBlockNode();
+            const long bSz = 1l<<(m_uiMaxDepth - blkNode.getLevel());
+            const long eSz = 1l<<(m_uiMaxDepth - blkList[b].getRegularGridLev());
+            const long pMin[3] = {blkNode.getX() - eSz, blkNode.getY() - eSz, blkNode.getZ() - eSz};
+            const long pMax[3] = {blkNode.getX() + bSz + eSz, blkNode.getY() + bSz + eSz, blkNode.getZ() + bSz + eSz};
+
+            eQueue.clear();
+            for(unsigned int e = blkList[b].getLocalElementBegin(); e < blkList[b].getLocalElementEnd(); e++)
+            {
+                eVisited[e] = b;
+                eQueue.push_back(e);
+            }
+
+            for(unsigned int q=0; q < eQueue.size(); q++)
+            {
+                const unsigned int e = eQueue[q];
+                for(unsigned int dir=0; dir < numDir; dir++)
+                {
+                    const unsigned int lookUp = e2e[e*numDir + dir];
+                    if(lookUp == LOOK_UP_TABLE_DEFAULT || eVisited[lookUp] == b)
+                        continue;
+
+                    const long nSz = 1l<<(m_uiMaxDepth - pNodes[lookUp].getLevel());
+                    const long x[3] = {pNodes[lookUp].getX(), pNodes[lookUp].getY(), pNodes[lookUp].getZ()};
+                    if(!( x[0] < pMax[0] && x[0] + nSz > pMin[0] &&
+                          x[1] < pMax[1] && x[1] + nSz > pMin[1] &&
+                          x[2] < pMax[2] && x[2] + nSz > pMin[2] ))
+                        continue;
+
+                    eVisited[lookUp] = b;
+                    eQueue.push_back(lookUp);
+
+                    if(lookUp >= eLocalBegin && lookUp < eLocalEnd)
+                    {
+                        const unsigned int o = e2b[lookUp - eLocalBegin];
+                        if(bVisited[o] != b)
+                        {
+                            bVisited[o] = b;
+                            nbr.push_back(o);
+                        }
+                    }
+                    else if(computeGhostDep)
+                        isGhostDep[b] = 1;
+                }
+            }
+
+            std::sort(nbr.begin() + nbrOffset[b], nbr.end());
+        }
+        nbrOffset[numBlks] = nbr.size();
+
+        return;
+    }
+
+    bool is_blk_unzip_local(const ot::Mesh* pMesh)
+    {
+        const std::vector<ot::Block>& blkList = pMesh->getLocalBlockList();
+        return !(blkList.size() > 0 && pMesh->getElementOrder()==4 && blkList[0].get1DPadWidth()==3);
+    }
+
+}// end of namespace ts
@@ -257,3 +257,126 @@ void ot::SubScatterMap::compute_L2SM()
 
 
 }
+
+
+ot::SubScatterMapEleDG::SubScatterMapEleDG(const ot::Mesh* pMesh)
+{
+    m_uiMesh = pMesh;
+    m_uiMesh->computeMinMaxLevel(m_uiLMin , m_uiLMax);
+    m_uiAsyncTag = 0;
+
+    this->compute_L2SM();
+
+}
+
+unsigned int ot::SubScatterMapEleDG::get_send_count(unsigned int l) const
+{
+    if( !(m_uiMesh->isActive()) || m_uiMesh->getMPICommSizeGlobal()==1 || l > m_uiLMax )
+        return 0;
+
+    l = std::max(l,m_uiLMin);
+    const unsigned int activeNpes = m_uiMesh->getMPICommSize();
+    unsigned int cnt =0;
+    for(unsigned int p=0; p < activeNpes; p++)
+        cnt += m_uiSendCount[l*activeNpes + p];
+
+    return cnt;
+}
+
+bool ot::SubScatterMapEleDG::isGhostReadComplete(const void* vec, unsigned int l)
+{
+    if( !(m_uiMesh->isActive()) || m_uiMesh->getMPICommSizeGlobal()==1 )
+        return true;
+
+    l = std::max(l,m_uiLMin);
+    if(l > m_uiLMax)
+        return true;
+
+    for(unsigned int i=0; i < m_uiAsyncCtxList.size(); i++)
+    {
+        if(m_uiAsyncCtxList[i].getBuffer()==vec && m_uiAsyncCtxList[i].getLevel() == l)
+        {
+            std::vector<MPI_Request*>& reqList = m_uiAsyncCtxList[i].getRequestList();
+            int flag;
+            MPI_Status status;
+            for(unsigned int k=0; k < reqList.size(); k++)
+            {
+                MPI_Test(reqList[k], &flag, &status);
+                if(!flag)
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
+    return true;
+}
+
+void ot::SubScatterMapEleDG::compute_L2SM()
+{
+    if( !(m_uiMesh->isActive()) || m_uiMesh->getMPICommSizeGlobal()==1 )
+        return;
+
+    const unsigned int activeNpes = m_uiMesh->getMPICommSize();
+    const ot::TreeNode* const pNodes = m_uiMesh->getAllElements().data();
+    const unsigned int eleLocalBegin = m_uiMesh->getElementLocalBegin();
+
+    const std::vector<unsigned int>& sCounts = m_uiMesh->getElementSendCounts();
+    const std::vector<unsigned int>& rCounts = m_uiMesh->getElementRecvCounts();
+    const std::vector<unsigned int>& sProcList = m_uiMesh->getSendEleProcList();
+    const std::vector<unsigned int>& rProcList = m_uiMesh->getRecvEleProcList();
+    const std::vector<unsigned int>& sSM = m_uiMesh->getSendElementSM();
+    const std::vector<unsigned int>& rSM = m_uiMesh->getRecvElementSM();
+
+    m_uiSendOffset = m_uiMesh->getElementSendOffsets();
+    m_uiRecvOffset = m_uiMesh->getElementRecvOffsets();
+
+    m_uiSendEleSM.resize(sSM.size());
+    m_uiRecvEleSM.resize(rSM.size());
+
+    for(unsigned int k=0; k < sSM.size(); k++)
+        m_uiSendEleSM[k] = eleLocalBegin + sSM[k];
+
+    for(unsigned int k=0; k < rSM.size(); k++)
+        m_uiRecvEleSM[k] = rSM[k];
+
+    m_uiSendCount.clear();
+    m_uiRecvCount.clear();
+    m_uiSendCount.resize((m_uiLMax+1)*activeNpes,0);
+    m_uiRecvCount.resize((m_uiLMax+1)*activeNpes,0);
+
+    // finest first, stable so that the sender and the receiver agree on the element order. 
+    const auto byLevel = [pNodes](unsigned int a, unsigned int b){ return pNodes[a].getLevel() > pNodes[b].getLevel(); };
+
+    for(unsigned int p =0; p < sProcList.size(); p++ )
+    {
+        const unsigned int proc_id = sProcList[p];
+        unsigned int* const sm = m_uiSendEleSM.data() + m_uiSendOffset[proc_id];
+        std::stable_sort(sm, sm + sCounts[proc_id], byLevel);
+        
+        for(unsigned int k=0; k < sCounts[proc_id]; k++)
+            m_uiSendCount[pNodes[sm[k]].getLevel()*activeNpes + proc_id]++;
+    }
+
+    for(unsigned int p =0; p < rProcList.size(); p++ )
+    {
+        const unsigned int proc_id = rProcList[p];
+        unsigned int* const sm = m_uiRecvEleSM.data() + m_uiRecvOffset[proc_id];
+        std::stable_sort(sm, sm + rCounts[proc_id], byLevel);
+
+        for(unsigned int k=0; k < rCounts[proc_id]; k++)
+            m_uiRecvCount[pNodes[sm[k]].getLevel()*activeNpes + proc_id]++;
+    }
+
+    // counts by level to counts of level >= l
+    for(int l = m_uiLMax-1; l >= (int)m_uiLMin; l--)
+        for(unsigned int p=0; p < activeNpes; p++)
+        {
+            m_uiSendCount[l*activeNpes + p] += m_uiSendCount[(l+1)*activeNpes + p];
+            m_uiRecvCount[l*activeNpes + p] += m_uiRecvCount[(l+1)*activeNpes + p];
+        }
+
+    return ;
+
+}
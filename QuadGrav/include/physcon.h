@@ -5,6 +5,7 @@
 #include "parameters.h"
 #include "grUtils.h"
 #include "derivs.h"
+#include "memory_pool.h"
 
 #define deriv_x deriv42_x
 #define deriv_y deriv42_y
@@ -1,114 +1,114 @@
-  free(agrad_0_gt0);
-  free(agrad_1_gt0);
-  free(agrad_2_gt0);
-  free(agrad_0_gt1);
-  free(agrad_1_gt1);
-  free(agrad_2_gt1);
-  free(agrad_0_gt2);
-  free(agrad_1_gt2);
-  free(agrad_2_gt2);
-  free(agrad_0_gt3);
-  free(agrad_1_gt3);
-  free(agrad_2_gt3);
-  free(agrad_0_gt4);
-  free(agrad_1_gt4);
-  free(agrad_2_gt4);
-  free(agrad_0_gt5);
-  free(agrad_1_gt5);
-  free(agrad_2_gt5);
-  free(agrad_0_At0);
-  free(agrad_1_At0);
-  free(agrad_2_At0);
-  free(agrad_0_At1);
-  free(agrad_1_At1);
-  free(agrad_2_At1);
-  free(agrad_0_At2);
-  free(agrad_1_At2);
-  free(agrad_2_At2);
-  free(agrad_0_At3);
-  free(agrad_1_At3);
-  free(agrad_2_At3);
-  free(agrad_0_At4);
-  free(agrad_1_At4);
-  free(agrad_2_At4);
-  free(agrad_0_At5);
-  free(agrad_1_At5);
-  free(agrad_2_At5);
-  free(agrad_0_alpha);
-  free(agrad_1_alpha);
-  free(agrad_2_alpha);
-  free(agrad_0_beta0);
-  free(agrad_1_beta0);
-  free(agrad_2_beta0);
-  free(agrad_0_beta1);
-  free(agrad_1_beta1);
-  free(agrad_2_beta1);
-  free(agrad_0_beta2);
-  free(agrad_1_beta2);
-  free(agrad_2_beta2);
-  free(agrad_0_chi);
-  free(agrad_1_chi);
-  free(agrad_2_chi);
-  free(agrad_0_Gt0);
-  free(agrad_1_Gt0);
-  free(agrad_2_Gt0);
-  free(agrad_0_Gt1);
-  free(agrad_1_Gt1);
-  free(agrad_2_Gt1);
-  free(agrad_0_Gt2);
-  free(agrad_1_Gt2);
-  free(agrad_2_Gt2);
-  free(agrad_0_K);
-  free(agrad_1_K);
-  free(agrad_2_K);
-  free(agrad_0_B0);
-  free(agrad_1_B0);
-  free(agrad_2_B0);
-  free(agrad_0_B1);
-  free(agrad_1_B1);
-  free(agrad_2_B1);
-  free(agrad_0_B2);
-  free(agrad_1_B2);
-  free(agrad_2_B2);
-  free(agrad_0_Rsc);
-  free(agrad_1_Rsc);
-  free(agrad_2_Rsc);
-  free(agrad_0_Rsch);
-  free(agrad_1_Rsch);
-  free(agrad_2_Rsch);
-  free(agrad_0_Rtt0);
-  free(agrad_1_Rtt0);
-  free(agrad_2_Rtt0);
-  free(agrad_0_Rtt1);
-  free(agrad_1_Rtt1);
-  free(agrad_2_Rtt1);
-  free(agrad_0_Rtt2);
-  free(agrad_1_Rtt2);
-  free(agrad_2_Rtt2);
-  free(agrad_0_Rtt3);
-  free(agrad_1_Rtt3);
-  free(agrad_2_Rtt3);
-  free(agrad_0_Rtt4);
-  free(agrad_1_Rtt4);
-  free(agrad_2_Rtt4);
-  free(agrad_0_Rtt5);
-  free(agrad_1_Rtt5);
-  free(agrad_2_Rtt5);
-  free(agrad_0_Vat0);
-  free(agrad_1_Vat0);
-  free(agrad_2_Vat0);
-  free(agrad_0_Vat1);
-  free(agrad_1_Vat1);
-  free(agrad_2_Vat1);
-  free(agrad_0_Vat2);
-  free(agrad_1_Vat2);
-  free(agrad_2_Vat2);
-  free(agrad_0_Vat3);
-  free(agrad_1_Vat3);
-  free(agrad_2_Vat3);
-  free(agrad_0_Vat4);
-  free(agrad_1_Vat4);
-  free(agrad_2_Vat4);
-  free(agrad_0_Vat5);
-  free(agrad_1_Vat5);
-  free(agrad_2_Vat5);
+  mem::get_pool()->free(agrad_0_gt0);
+  mem::get_pool()->free(agrad_1_gt0);
+  mem::get_pool()->free(agrad_2_gt0);
+  mem::get_pool()->free(agrad_0_gt1);
+  mem::get_pool()->free(agrad_1_gt1);
+  mem::get_pool()->free(agrad_2_gt1);
+  mem::get_pool()->free(agrad_0_gt2);
+  mem::get_pool()->free(agrad_1_gt2);
+  mem::get_pool()->free(agrad_2_gt2);
+  mem::get_pool()->free(agrad_0_gt3);
+  mem::get_pool()->free(agrad_1_gt3);
+  mem::get_pool()->free(agrad_2_gt3);
+  mem::get_pool()->free(agrad_0_gt4);
+  mem::get_pool()->free(agrad_1_gt4);
+  mem::get_pool()->free(agrad_2_gt4);
+  mem::get_pool()->free(agrad_0_gt5);
+  mem::get_pool()->free(agrad_1_gt5);
+  mem::get_pool()->free(agrad_2_gt5);
+  mem::get_pool()->free(agrad_0_At0);
+  mem::get_pool()->free(agrad_1_At0);
+  mem::get_pool()->free(agrad_2_At0);
+  mem::get_pool()->free(agrad_0_At1);
+  mem::get_pool()->free(agrad_1_At1);
+  mem::get_pool()->free(agrad_2_At1);
+  mem::get_pool()->free(agrad_0_At2);
+  mem::get_pool()->free(agrad_1_At2);
+  mem::get_pool()->free(agrad_2_At2);
+  mem::get_pool()->free(agrad_0_At3);
+  mem::get_pool()->free(agrad_1_At3);
+  mem::get_pool()->free(agrad_2_At3);
+  mem::get_pool()->free(agrad_0_At4);
+  mem::get_pool()->free(agrad_1_At4);
+  mem::get_pool()->free(agrad_2_At4);
+  mem::get_pool()->free(agrad_0_At5);
+  mem::get_pool()->free(agrad_1_At5);
+  mem::get_pool()->free(agrad_2_At5);
+  mem::get_pool()->free(agrad_0_alpha);
+  mem::get_pool()->free(agrad_1_alpha);
+  mem::get_pool()->free(agrad_2_alpha);
+  mem::get_pool()->free(agrad_0_beta0);
+  mem::get_pool()->free(agrad_1_beta0);
+  mem::get_pool()->free(agrad_2_beta0);
+  mem::get_pool()->free(agrad_0_beta1);
+  mem::get_pool()->free(agrad_1_beta1);
+  mem::get_pool()->free(agrad_2_beta1);
+  mem::get_pool()->free(agrad_0_beta2);
+  mem::get_pool()->free(agrad_1_beta2);
+  mem::get_pool()->free(agrad_2_beta2);
+  mem::get_pool()->free(agrad_0_chi);
+  mem::get_pool()->free(agrad_1_chi);
+  mem::get_pool()->free(agrad_2_chi);
+  mem::get_pool()->free(agrad_0_Gt0);
+  mem::get_pool()->free(agrad_1_Gt0);
+  mem::get_pool()->free(agrad_2_Gt0);
+  mem::get_pool()->free(agrad_0_Gt1);
+  mem::get_pool()->free(agrad_1_Gt1);
+  mem::get_pool()->free(agrad_2_Gt1);
+  mem::get_pool()->free(agrad_0_Gt2);
+  mem::get_pool()->free(agrad_1_Gt2);
+  mem::get_pool()->free(agrad_2_Gt2);
+  mem::get_pool()->free(agrad_0_K);
+  mem::get_pool()->free(agrad_1_K);
+  mem::get_pool()->free(agrad_2_K);
+  mem::get_pool()->free(agrad_0_B0);
+  mem::get_pool()->free(agrad_1_B0);
+  mem::get_pool()->free(agrad_2_B0);
+  mem::get_pool()->free(agrad_0_B1);
+  mem::get_pool()->free(agrad_1_B1);
+  mem::get_pool()->free(agrad_2_B1);
+  mem::get_pool()->free(agrad_0_B2);
+  mem::get_pool()->free(agrad_1_B2);
+  mem::get_pool()->free(agrad_2_B2);
+  mem::get_pool()->free(agrad_0_Rsc);
+  mem::get_pool()->free(agrad_1_Rsc);
+  mem::get_pool()->free(agrad_2_Rsc);
+  mem::get_pool()->free(agrad_0_Rsch);
+  mem::get_pool()->free(agrad_1_Rsch);
+  mem::get_pool()->free(agrad_2_Rsch);
+  mem::get_pool()->free(agrad_0_Rtt0);
+  mem::get_pool()->free(agrad_1_Rtt0);
+  mem::get_pool()->free(agrad_2_Rtt0);
+  mem::get_pool()->free(agrad_0_Rtt1);
+  mem::get_pool()->free(agrad_1_Rtt1);
+  mem::get_pool()->free(agrad_2_Rtt1);
+  mem::get_pool()->free(agrad_0_Rtt2);
+  mem::get_pool()->free(agrad_1_Rtt2);
+  mem::get_pool()->free(agrad_2_Rtt2);
+  mem::get_pool()->free(agrad_0_Rtt3);
+  mem::get_pool()->free(agrad_1_Rtt3);
+  mem::get_pool()->free(agrad_2_Rtt3);
+  mem::get_pool()->free(agrad_0_Rtt4);
+  mem::get_pool()->free(agrad_1_Rtt4);
+  mem::get_pool()->free(agrad_2_Rtt4);
+  mem::get_pool()->free(agrad_0_Rtt5);
+  mem::get_pool()->free(agrad_1_Rtt5);
+  mem::get_pool()->free(agrad_2_Rtt5);
+  mem::get_pool()->free(agrad_0_Vat0);
+  mem::get_pool()->free(agrad_1_Vat0);
+  mem::get_pool()->free(agrad_2_Vat0);
+  mem::get_pool()->free(agrad_0_Vat1);
+  mem::get_pool()->free(agrad_1_Vat1);
+  mem::get_pool()->free(agrad_2_Vat1);
+  mem::get_pool()->free(agrad_0_Vat2);
+  mem::get_pool()->free(agrad_1_Vat2);
+  mem::get_pool()->free(agrad_2_Vat2);
+  mem::get_pool()->free(agrad_0_Vat3);
+  mem::get_pool()->free(agrad_1_Vat3);
+  mem::get_pool()->free(agrad_2_Vat3);
+  mem::get_pool()->free(agrad_0_Vat4);
+  mem::get_pool()->free(agrad_1_Vat4);
+  mem::get_pool()->free(agrad_2_Vat4);
+  mem::get_pool()->free(agrad_0_Vat5);
+  mem::get_pool()->free(agrad_1_Vat5);
+  mem::get_pool()->free(agrad_2_Vat5);
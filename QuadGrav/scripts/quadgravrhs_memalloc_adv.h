@@ -1,114 +1,114 @@
-  double *agrad_0_gt0 = (double *) malloc(bytes);
-  double *agrad_1_gt0 = (double *) malloc(bytes);
-  double *agrad_2_gt0 = (double *) malloc(bytes);
-  double *agrad_0_gt1 = (double *) malloc(bytes);
-  double *agrad_1_gt1 = (double *) malloc(bytes);
-  double *agrad_2_gt1 = (double *) malloc(bytes);
-  double *agrad_0_gt2 = (double *) malloc(bytes);
-  double *agrad_1_gt2 = (double *) malloc(bytes);
-  double *agrad_2_gt2 = (double *) malloc(bytes);
-  double *agrad_0_gt3 = (double *) malloc(bytes);
-  double *agrad_1_gt3 = (double *) malloc(bytes);
-  double *agrad_2_gt3 = (double *) malloc(bytes);
-  double *agrad_0_gt4 = (double *) malloc(bytes);
-  double *agrad_1_gt4 = (double *) malloc(bytes);
-  double *agrad_2_gt4 = (double *) malloc(bytes);
-  double *agrad_0_gt5 = (double *) malloc(bytes);
-  double *agrad_1_gt5 = (double *) malloc(bytes);
-  double *agrad_2_gt5 = (double *) malloc(bytes);
-  double *agrad_0_At0 = (double *) malloc(bytes);
-  double *agrad_1_At0 = (double *) malloc(bytes);
-  double *agrad_2_At0 = (double *) malloc(bytes);
-  double *agrad_0_At1 = (double *) malloc(bytes);
-  double *agrad_1_At1 = (double *) malloc(bytes);
-  double *agrad_2_At1 = (double *) malloc(bytes);
-  double *agrad_0_At2 = (double *) malloc(bytes);
-  double *agrad_1_At2 = (double *) malloc(bytes);
-  double *agrad_2_At2 = (double *) malloc(bytes);
-  double *agrad_0_At3 = (double *) malloc(bytes);
-  double *agrad_1_At3 = (double *) malloc(bytes);
-  double *agrad_2_At3 = (double *) malloc(bytes);
-  double *agrad_0_At4 = (double *) malloc(bytes);
-  double *agrad_1_At4 = (double *) malloc(bytes);
-  double *agrad_2_At4 = (double *) malloc(bytes);
-  double *agrad_0_At5 = (double *) malloc(bytes);
-  double *agrad_1_At5 = (double *) malloc(bytes);
-  double *agrad_2_At5 = (double *) malloc(bytes);
-  double *agrad_0_alpha = (double *) malloc(bytes);
-  double *agrad_1_alpha = (double *) malloc(bytes);
-  double *agrad_2_alpha = (double *) malloc(bytes);
-  double *agrad_0_beta0 = (double *) malloc(bytes);
-  double *agrad_1_beta0 = (double *) malloc(bytes);
-  double *agrad_2_beta0 = (double *) malloc(bytes);
-  double *agrad_0_beta1 = (double *) malloc(bytes);
-  double *agrad_1_beta1 = (double *) malloc(bytes);
-  double *agrad_2_beta1 = (double *) malloc(bytes);
-  double *agrad_0_beta2 = (double *) malloc(bytes);
-  double *agrad_1_beta2 = (double *) malloc(bytes);
-  double *agrad_2_beta2 = (double *) malloc(bytes);
-  double *agrad_0_chi = (double *) malloc(bytes);
-  double *agrad_1_chi = (double *) malloc(bytes);
-  double *agrad_2_chi = (double *) malloc(bytes);
-  double *agrad_0_Gt0 = (double *) malloc(bytes);
-  double *agrad_1_Gt0 = (double *) malloc(bytes);
-  double *agrad_2_Gt0 = (double *) malloc(bytes);
-  double *agrad_0_Gt1 = (double *) malloc(bytes);
-  double *agrad_1_Gt1 = (double *) malloc(bytes);
-  double *agrad_2_Gt1 = (double *) malloc(bytes);
-  double *agrad_0_Gt2 = (double *) malloc(bytes);
-  double *agrad_1_Gt2 = (double *) malloc(bytes);
-  double *agrad_2_Gt2 = (double *) malloc(bytes);
-  double *agrad_0_K = (double *) malloc(bytes);
-  double *agrad_1_K = (double *) malloc(bytes);
-  double *agrad_2_K = (double *) malloc(bytes);
-  double *agrad_0_B0 = (double *) malloc(bytes);
-  double *agrad_1_B0 = (double *) malloc(bytes);
-  double *agrad_2_B0 = (double *) malloc(bytes);
-  double *agrad_0_B1 = (double *) malloc(bytes);
-  double *agrad_1_B1 = (double *) malloc(bytes);
-  double *agrad_2_B1 = (double *) malloc(bytes);
-  double *agrad_0_B2 = (double *) malloc(bytes);
-  double *agrad_1_B2 = (double *) malloc(bytes);
-  double *agrad_2_B2 = (double *) malloc(bytes);
-  double *agrad_0_Rsc = (double *) malloc(bytes);
-  double *agrad_1_Rsc = (double *) malloc(bytes);
-  double *agrad_2_Rsc = (double *) malloc(bytes);
-  double *agrad_0_Rsch = (double *) malloc(bytes);
-  double *agrad_1_Rsch = (double *) malloc(bytes);
-  double *agrad_2_Rsch = (double *) malloc(bytes);
-  double *agrad_0_Rtt0 = (double *) malloc(bytes);
-  double *agrad_1_Rtt0 = (double *) malloc(bytes);
-  double *agrad_2_Rtt0 = (double *) malloc(bytes);
-  double *agrad_0_Rtt1 = (double *) malloc(bytes);
-  double *agrad_1_Rtt1 = (double *) malloc(bytes);
-  double *agrad_2_Rtt1 = (double *) malloc(bytes);
-  double *agrad_0_Rtt2 = (double *) malloc(bytes);
-  double *agrad_1_Rtt2 = (double *) malloc(bytes);
-  double *agrad_2_Rtt2 = (double *) malloc(bytes);
-  double *agrad_0_Rtt3 = (double *) malloc(bytes);
-  double *agrad_1_Rtt3 = (double *) malloc(bytes);
-  double *agrad_2_Rtt3 = (double *) malloc(bytes);
-  double *agrad_0_Rtt4 = (double *) malloc(bytes);
-  double *agrad_1_Rtt4 = (double *) malloc(bytes);
-  double *agrad_2_Rtt4 = (double *) malloc(bytes);
-  double *agrad_0_Rtt5 = (double *) malloc(bytes);
-  double *agrad_1_Rtt5 = (double *) malloc(bytes);
-  double *agrad_2_Rtt5 = (double *) malloc(bytes);
-  double *agrad_0_Vat0 = (double *) malloc(bytes);
-  double *agrad_1_Vat0 = (double *) malloc(bytes);
-  double *agrad_2_Vat0 = (double *) malloc(bytes);
-  double *agrad_0_Vat1 = (double *) malloc(bytes);
-  double *agrad_1_Vat1 = (double *) malloc(bytes);
-  double *agrad_2_Vat1 = (double *) malloc(bytes);
-  double *agrad_0_Vat2 = (double *) malloc(bytes);
-  double *agrad_1_Vat2 = (double *) malloc(bytes);
-  double *agrad_2_Vat2 = (double *) malloc(bytes);
-  double *agrad_0_Vat3 = (double *) malloc(bytes);
-  double *agrad_1_Vat3 = (double *) malloc(bytes);
-  double *agrad_2_Vat3 = (double *) malloc(bytes);
-  double *agrad_0_Vat4 = (double *) malloc(bytes);
-  double *agrad_1_Vat4 = (double *) malloc(bytes);
-  double *agrad_2_Vat4 = (double *) malloc(bytes);
-  double *agrad_0_Vat5 = (double *) malloc(bytes);
-  double *agrad_1_Vat5 = (double *) malloc(bytes);
-  double *agrad_2_Vat5 = (double *) malloc(bytes);
+  double *agrad_0_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_gt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_gt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_gt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_At0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_At0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_At0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_At1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_At1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_At1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_At2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_At2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_At2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_At3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_At3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_At3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_At4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_At4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_At4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_At5 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_At5 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_At5 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_alpha = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_alpha = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_alpha = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_beta0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_beta0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_beta0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_beta1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_beta1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_beta1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_beta2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_beta2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_beta2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_chi = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_chi = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_chi = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Gt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Gt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Gt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_K = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_K = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_K = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_B0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_B0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_B0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_B1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_B1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_B1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_B2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_B2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_B2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Rsc = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Rsc = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Rsc = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Rsch = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Rsch = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Rsch = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Rtt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Rtt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Rtt0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Rtt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Rtt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Rtt1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Rtt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Rtt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Rtt2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Rtt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Rtt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Rtt3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Rtt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Rtt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Rtt4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Rtt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Rtt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Rtt5 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Vat0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Vat0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Vat0 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Vat1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Vat1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Vat1 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Vat2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Vat2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Vat2 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Vat3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Vat3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Vat3 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Vat4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Vat4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Vat4 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_0_Vat5 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_1_Vat5 = (double *) mem::get_pool()->allocate(bytes);
+  double *agrad_2_Vat5 = (double *) mem::get_pool()->allocate(bytes);
@@ -148,7 +148,7 @@ namespace quadgrav
         return 0;    
     }
 
-    int BSSNCtx::rhs(DVec* in , DVec* out, unsigned int sz , DendroScalar time)
+    int BSSNCtx::rhs(DVecView* in , DVecView* out, unsigned int sz , DendroScalar time)
     {
         // all the variables should be packed together. 
         assert(sz==1);
@@ -183,7 +183,7 @@ namespace quadgrav
     }
 
 
-    int BSSNCtx::rhs_blkwise(DVec in, DVec out, const unsigned int* const blkIDs, unsigned int numIds, DendroScalar*  blk_time) const
+    int BSSNCtx::rhs_blkwise(DVecView in, DVecView out, const unsigned int* const blkIDs, unsigned int numIds, DendroScalar*  blk_time) const
     {
 
         DendroScalar ** unzipIn;
@@ -241,7 +241,7 @@ namespace quadgrav
         delete [] unzipIn;
         delete [] unzipOut;
 
-        
+        return 0;
     }
 
     int BSSNCtx::rhs_blk(const DendroScalar* in, DendroScalar* out, unsigned int dof, unsigned int local_blk_id, DendroScalar  blk_time) const 
@@ -298,6 +298,7 @@ namespace quadgrav
         delete [] unzipIn;
         delete [] unzipOut;
 
+        return 0;
 
     }
 
@@ -665,6 +666,8 @@ namespace quadgrav
             newMesh=new ot::Mesh(octree,1,m_uiElementOrder,activeCommSz,comm);
             // no need to transfer data only to resize the contex variables. 
             this->grid_transfer( newMesh , false, false, false);
+            // the old vectors are released by the grid transfer. 
+            this->update_app_vars();
             
             // only reads the evolution variables. 
             if(isActive) {
@@ -707,7 +710,7 @@ namespace quadgrav
 
     }
 
-    int BSSNCtx::pre_timestep(DVec sIn)
+    int BSSNCtx::pre_timestep(DVecView sIn)
     {
 
         #ifdef BSSN_EXTRACT_BH_LOCATIONS
@@ -725,18 +728,18 @@ namespace quadgrav
         return 0;
     }
 
-    int BSSNCtx::pre_stage(DVec  sIn)
+    int BSSNCtx::pre_stage(DVecView  sIn)
     {
         
         return 0;
     }
 
-    int BSSNCtx::post_stage(DVec sIn)
+    int BSSNCtx::post_stage(DVecView sIn)
     { 
         return 0;
     }
 
-    int BSSNCtx::post_timestep(DVec sIn)
+    int BSSNCtx::post_timestep(DVecView sIn)
     {
         return 0;
     }
@@ -798,17 +801,17 @@ namespace quadgrav
         
     }
 
-    DVec BSSNCtx::get_evolution_vars()
+    DVecView BSSNCtx::get_evolution_vars()
     {
         return m_uiEVar;
     }
     
-    DVec BSSNCtx::get_constraint_vars()
+    DVecView BSSNCtx::get_constraint_vars()
     {
         return m_uiCVar;
     }
 
-    DVec BSSNCtx::get_primitive_vars()
+    DVecView BSSNCtx::get_primitive_vars()
     {
         return m_uiPVar;
     }
@@ -2369,6 +2369,7 @@ namespace quadgrav
 
 
             if(!rank)outfile<<"========================= RUNTIME =================================================================== "<<std::endl;
+            if(!rank)outfile<<"(rhs kernel timers add up the time of all the threads if the blocks run concurrently)"<<std::endl;
             if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator) << "step";
             if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator) << "min(s)";
             if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator) << "mean(s)";
@@ -2689,6 +2690,24 @@ namespace quadgrav
             if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[1];
             if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[2]<<std::endl;
 
+            // scratch pool since the last output, the rhs scratch is served by the thread caches if the shared calls stay low.
+            const mem_pool_stats poolStats = mem::get_pool()->get_stats();
+            mem::get_pool()->reset_stats();
+
+            t_stat=poolStats.hit_rate();
+            computeOverallStats(&t_stat, t_stat_g, comm);
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator) <<"  ++mem_pool_hit_rate ";
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[0];
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[1];
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[2]<<std::endl;
+
+            t_stat=poolStats.shared;
+            computeOverallStats(&t_stat, t_stat_g, comm);
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator) <<"  ++mem_pool_shared(#) ";
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[0];
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[1];
+            if(!rank)outfile << std::left << std::setw(nameWidth) << std::setfill(separator)<<t_stat_g[2]<<std::endl;
+
 
 
             t_stat=t_bdyc.snap;
@@ -506,7 +506,7 @@ int main (int argc, char** argv)
           printf("[ETS] time (s): (min, mean, max): (%f, %f , %f)\n", t_stat_g[0], t_stat_g[1], t_stat_g[2]);
 
         
-        DVec evar_ets = quadgravCtx_ets->get_evolution_vars();
+        DVecView evar_ets = quadgravCtx_ets->get_evolution_vars();
 
         t_rt.snapreset();
 
@@ -524,7 +524,7 @@ int main (int argc, char** argv)
           printf("[ENUTS] time (s): (min, mean, max): (%f, %f , %f)\n", t_stat_g[0], t_stat_g[1], t_stat_g[2]);
 
 
-        DVec evar_enuts = quadgravCtx_enuts->get_evolution_vars();
+        DVecView evar_enuts = quadgravCtx_enuts->get_evolution_vars();
 
         DVec evar_diff;
         evar_diff.VecCopy(evar_ets,false);
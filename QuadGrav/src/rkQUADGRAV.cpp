@@ -27,19 +27,6 @@ RK_QUADGRAV::RK_QUADGRAV(ot::Mesh *pMesh, DendroScalar pTBegin, DendroScalar pTE
     m_uiBHLoc[1]=Point(quadgrav::BH2.getBHCoordX(),quadgrav::BH2.getBHCoordY(),quadgrav::BH2.getBHCoordZ());
 
 
-    // allocate memory for the variables.
-    m_uiVar=new DendroScalar*[quadgrav::QUADGRAV_NUM_VARS];
-    for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-        m_uiVar[index]=m_uiMesh->createVector<DendroScalar>();
-
-    m_uiPrevVar=new DendroScalar*[quadgrav::QUADGRAV_NUM_VARS];
-    for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-        m_uiPrevVar[index]=m_uiMesh->createVector<DendroScalar>();
-
-    m_uiVarIm=new DendroScalar*[quadgrav::QUADGRAV_NUM_VARS];
-    for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-        m_uiVarIm[index]=m_uiMesh->createVector<DendroScalar>();
-
     if(m_uiRKType==RKType::RK3)
         m_uiNumRKStages=quadgrav::QUADGRAV_RK3_STAGES;
     else if(m_uiRKType==RKType::RK4)
@@ -57,34 +44,9 @@ RK_QUADGRAV::RK_QUADGRAV(ot::Mesh *pMesh, DendroScalar pTBegin, DendroScalar pTE
 
 
 
+    // allocate memory for the variables, the stages and the constraint variables.
     m_uiStage=new DendroScalar**[m_uiNumRKStages];
-    for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-    {
-        m_uiStage[stage]=new DendroScalar*[quadgrav::QUADGRAV_NUM_VARS];
-        for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-            m_uiStage[stage][index]=m_uiMesh->createVector<DendroScalar>();
-    }
-
-    m_uiUnzipVar=new DendroScalar*[quadgrav::QUADGRAV_NUM_VARS];
-    for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-        m_uiUnzipVar[index]=m_uiMesh->createUnZippedVector<DendroScalar>();
-
-
-    m_uiUnzipVarRHS=new DendroScalar*[quadgrav::QUADGRAV_NUM_VARS];
-    for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-        m_uiUnzipVarRHS[index]=m_uiMesh->createUnZippedVector<DendroScalar>();
-
-
-
-    // allocate memory for the constraint variables.
-    m_uiConstraintVars=new DendroScalar*[quadgrav::QUADGRAV_CONSTRAINT_NUM_VARS];
-    for(unsigned int index=0; index<quadgrav::QUADGRAV_CONSTRAINT_NUM_VARS; index++)
-        m_uiConstraintVars[index]=m_uiMesh->createVector<DendroScalar>();
-
-
-    m_uiUnzipConstraintVars=new DendroScalar*[quadgrav::QUADGRAV_CONSTRAINT_NUM_VARS];
-    for(unsigned int index=0; index<quadgrav::QUADGRAV_CONSTRAINT_NUM_VARS; index++)
-        m_uiUnzipConstraintVars[index]=m_uiMesh->createUnZippedVector<DendroScalar>();
+    allocateVars(m_uiMesh);
 
 
     // mpi communication
@@ -137,46 +99,10 @@ RK_QUADGRAV::RK_QUADGRAV(ot::Mesh *pMesh, DendroScalar pTBegin, DendroScalar pTE
 
 RK_QUADGRAV::~RK_QUADGRAV()
 {
-    for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-    {
-        delete [] m_uiVar[index];
-        delete [] m_uiPrevVar[index];
-        delete [] m_uiVarIm[index];
-        delete [] m_uiUnzipVar[index];
-        delete [] m_uiUnzipVarRHS[index];
-
-
-    }
-
-
-    delete [] m_uiVar;
-    delete [] m_uiPrevVar;
-    delete [] m_uiVarIm;
-    delete [] m_uiUnzipVar;
-    delete [] m_uiUnzipVarRHS;
-
-    for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-        for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-            delete [] m_uiStage[stage][index];
-
-    for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-        delete [] m_uiStage[stage];
-
+    // variable storage is freed by the field sets.
     delete [] m_uiStage;
 
 
-    // deallocate memory for the constraint variables.
-    for(unsigned int index=0; index<quadgrav::QUADGRAV_CONSTRAINT_NUM_VARS; index++)
-    {
-        delete [] m_uiConstraintVars[index];
-        delete [] m_uiUnzipConstraintVars[index];
-    }
-
-
-    delete [] m_uiConstraintVars;
-    delete [] m_uiUnzipConstraintVars;
-
-
     // mpi communication
     for(unsigned int index=0; index<quadgrav::QUADGRAV_ASYNC_COMM_K; index++)
     {
@@ -332,50 +258,16 @@ void RK_QUADGRAV::initialGridConverge()
 
 
             // performs the inter-grid transfer
-            intergridTransferVars(m_uiPrevVar,newMesh,quadgrav::QUADGRAV_USE_FD_GRID_TRANSFER);
-
-            for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-            {
-                delete [] m_uiVar[index];
-                delete [] m_uiVarIm[index];
-                delete [] m_uiUnzipVar[index];
-                delete [] m_uiUnzipVarRHS[index];
-
-                m_uiVar[index]=NULL;
-                m_uiVarIm[index]=NULL;
-                m_uiUnzipVar[index]=NULL;
-                m_uiUnzipVarRHS[index]=NULL;
-
-                m_uiVar[index]=newMesh->createVector<DendroScalar>();
-                m_uiVarIm[index]=newMesh->createVector<DendroScalar>();
-                m_uiUnzipVar[index]=newMesh->createUnZippedVector<DendroScalar>();
-                m_uiUnzipVarRHS[index]=newMesh->createUnZippedVector<DendroScalar>();
-
-
-            }
-
-            for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-                for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-                {
-                    delete [] m_uiStage[stage][index];
-                    m_uiStage[stage][index]=NULL;
-                    m_uiStage[stage][index]=newMesh->createVector<DendroScalar>();
-                }
-
-            // deallocate constraint vars allocate them for the new mesh.
-            for(unsigned int index=0; index<quadgrav::QUADGRAV_CONSTRAINT_NUM_VARS; index++)
-            {
-                delete [] m_uiConstraintVars[index];
-                delete [] m_uiUnzipConstraintVars[index];
+            intergridTransferVars(m_uiPrevVarFS,m_uiVarFS,newMesh,quadgrav::QUADGRAV_USE_FD_GRID_TRANSFER);
 
-                m_uiConstraintVars[index]=newMesh->createVector<DendroScalar>();
-                m_uiUnzipConstraintVars[index]=newMesh->createUnZippedVector<DendroScalar>();
-
-            }
+            // reallocates the vars for the new mesh (only if the new mesh is larger than the current storage).
+            allocateVars(newMesh);
 
 
             std::swap(newMesh,m_uiMesh);
             delete newMesh;
+            // the cached pool blocks are sized for the old mesh blocks.
+            mem::get_pool()->purge();
 
             #ifdef RK_SOLVER_OVERLAP_COMM_AND_COMP
             // reallocates mpi resources for the the new mesh. (this will deallocate the old resources)
@@ -516,27 +408,58 @@ void RK_QUADGRAV::performGhostExchangeVars(DendroScalar** zipIn)
 
 }
 
-void RK_QUADGRAV::intergridTransferVars(DendroScalar**& zipIn, const ot::Mesh* pnewMesh,bool useUnzip)
+void RK_QUADGRAV::allocateVars(const ot::Mesh* pMesh)
+{
+    const unsigned int dof   = (pMesh->isActive()) ? pMesh->getDegOfFreedom() : 0;
+    const unsigned int dofUz = (pMesh->isActive()) ? pMesh->getDegOfFreedomUnZip() : 0;
+
+    m_uiVarFS.allocate(quadgrav::QUADGRAV_NUM_VARS,dof);
+    m_uiPrevVarFS.allocate(quadgrav::QUADGRAV_NUM_VARS,dof);
+    m_uiVarImFS.allocate(quadgrav::QUADGRAV_NUM_VARS,dof);
+    m_uiStageFS.allocate(quadgrav::QUADGRAV_NUM_VARS*m_uiNumRKStages,dof);
+
+    m_uiUnzipVarFS.allocate(quadgrav::QUADGRAV_NUM_VARS,dofUz);
+    m_uiUnzipVarRHSFS.allocate(quadgrav::QUADGRAV_NUM_VARS,dofUz);
+
+    m_uiConstraintVarsFS.allocate(quadgrav::QUADGRAV_CONSTRAINT_NUM_VARS,dof);
+    m_uiUnzipConstraintVarsFS.allocate(quadgrav::QUADGRAV_CONSTRAINT_NUM_VARS,dofUz);
+
+    m_uiVar=m_uiVarFS.ptrs();
+    m_uiPrevVar=m_uiPrevVarFS.ptrs();
+    m_uiVarIm=m_uiVarImFS.ptrs();
+
+    for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
+        m_uiStage[stage]=m_uiStageFS.ptrs() + stage*quadgrav::QUADGRAV_NUM_VARS;
+
+    m_uiUnzipVar=m_uiUnzipVarFS.ptrs();
+    m_uiUnzipVarRHS=m_uiUnzipVarRHSFS.ptrs();
+
+    m_uiConstraintVars=m_uiConstraintVarsFS.ptrs();
+    m_uiUnzipConstraintVars=m_uiUnzipConstraintVarsFS.ptrs();
+
+}
+
+void RK_QUADGRAV::intergridTransferVars(ot::FieldSet<DendroScalar>& zipIn, ot::FieldSet<DendroScalar>& zipOut, const ot::Mesh* pnewMesh,bool useUnzip)
 {
     quadgrav::timer::t_gridTransfer.start();
 
+    zipOut.allocate(quadgrav::QUADGRAV_NUM_VARS,(pnewMesh->isActive()) ? pnewMesh->getDegOfFreedom() : 0);
+
+    DendroScalar ** in  = zipIn.ptrs();
+    DendroScalar ** out = zipOut.ptrs();
+
     if(!useUnzip)
     {
         for(unsigned int v=0; v<quadgrav::QUADGRAV_NUM_VARS; v++)
-            m_uiMesh->interGridTransfer(zipIn[v],pnewMesh);
+            m_uiMesh->interGridTransfer(in[v],out[v],pnewMesh,true);
     }else
     {
-        unzipVars_async(zipIn,m_uiUnzipVar);
+        unzipVars_async(in,m_uiUnzipVar);
         for(unsigned int v=0; v<quadgrav::QUADGRAV_NUM_VARS; v++)
-        {
-            m_uiMesh->interGridTransferUnzip(m_uiUnzipVar[v],zipIn[v],pnewMesh);
-        }
-        
+            m_uiMesh->interGridTransferUnzip(m_uiUnzipVar[v],in[v],out[v],pnewMesh);
     }
 
-
-
-    
+    zipIn.swap(zipOut);
 
     quadgrav::timer::t_gridTransfer.stop();
 
@@ -1529,52 +1452,16 @@ void RK_QUADGRAV::rkSolve()
 
 
                 // performs the inter-grid transfer
-                intergridTransferVars(m_uiPrevVar,newMesh,quadgrav::QUADGRAV_USE_FD_GRID_TRANSFER);
-
-                for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-                {
-                    delete [] m_uiVar[index];
-                    delete [] m_uiVarIm[index];
-                    delete [] m_uiUnzipVar[index];
-                    delete [] m_uiUnzipVarRHS[index];
-
-                    m_uiVar[index]=NULL;
-                    m_uiVarIm[index]=NULL;
-                    m_uiUnzipVar[index]=NULL;
-                    m_uiUnzipVarRHS[index]=NULL;
-
-                    m_uiVar[index]=newMesh->createVector<DendroScalar>();
-                    m_uiVarIm[index]=newMesh->createVector<DendroScalar>();
-                    m_uiUnzipVar[index]=newMesh->createUnZippedVector<DendroScalar>();
-                    m_uiUnzipVarRHS[index]=newMesh->createUnZippedVector<DendroScalar>();
-
-
-                }
-
-                for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-                    for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-                    {
-                        delete [] m_uiStage[stage][index];
-                        m_uiStage[stage][index]=NULL;
-                        m_uiStage[stage][index]=newMesh->createVector<DendroScalar>();
-                    }
-
-                // deallocate constraint vars allocate them for the new mesh.
-                for(unsigned int index=0; index<quadgrav::QUADGRAV_CONSTRAINT_NUM_VARS; index++)
-                {
-                    delete [] m_uiConstraintVars[index];
-                    delete [] m_uiUnzipConstraintVars[index];
-
-                    m_uiConstraintVars[index]=newMesh->createVector<DendroScalar>();
-                    m_uiUnzipConstraintVars[index]=newMesh->createUnZippedVector<DendroScalar>();
-
-                }
-
+                intergridTransferVars(m_uiPrevVarFS,m_uiVarFS,newMesh,quadgrav::QUADGRAV_USE_FD_GRID_TRANSFER);
 
+                // reallocates the vars for the new mesh (only if the new mesh is larger than the current storage).
+                allocateVars(newMesh);
 
 
                 std::swap(newMesh,m_uiMesh);
                 delete newMesh;
+                // the cached pool blocks are sized for the old mesh blocks.
+                mem::get_pool()->purge();
 
                 if(m_uiCurrentStep == 0)
                     applyInitialConditions(m_uiPrevVar);
@@ -1704,6 +1591,7 @@ void RK_QUADGRAV::rkSolve()
         #endif
 
 
+        m_uiVarFS.swap(m_uiPrevVarFS);
         std::swap(m_uiVar,m_uiPrevVar);
         //quadgrav::artificial_dissipation(m_uiMesh,m_uiPrevVar,quadgrav::QUADGRAV_NUM_VARS,quadgrav::QUADGRAV_DISSIPATION_NC,quadgrav::QUADGRAV_DISSIPATION_S,false);
         //if(m_uiCurrentStep==1) break;
@@ -1967,39 +1855,7 @@ void RK_QUADGRAV::restoreCheckPoint(const char * fNamePrefix,MPI_Comm comm)
 
         newMesh=new ot::Mesh(octree,1,m_uiOrder,activeCommSz,m_uiComm);
 
-        for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-        {
-            delete [] m_uiPrevVar[index];
-            delete [] m_uiVar[index];
-            delete [] m_uiVarIm[index];
-            delete [] m_uiUnzipVar[index];
-            delete [] m_uiUnzipVarRHS[index];
-
-            m_uiPrevVar[index]=newMesh->createVector<DendroScalar>();
-            m_uiVar[index]=newMesh->createVector<DendroScalar>();
-            m_uiVarIm[index]=newMesh->createVector<DendroScalar>();
-            m_uiUnzipVar[index]=newMesh->createUnZippedVector<DendroScalar>();
-            m_uiUnzipVarRHS[index]=newMesh->createUnZippedVector<DendroScalar>();
-
-        }
-
-        for(unsigned int stage=0; stage<m_uiNumRKStages; stage++)
-            for(unsigned int index=0; index<quadgrav::QUADGRAV_NUM_VARS; index++)
-            {
-                delete [] m_uiStage[stage][index];
-                m_uiStage[stage][index]=newMesh->createVector<DendroScalar>();
-            }
-
-        // deallocate constraint vars allocate them for the new mesh.
-        for(unsigned int index=0; index<quadgrav::QUADGRAV_CONSTRAINT_NUM_VARS; index++)
-        {
-            delete [] m_uiConstraintVars[index];
-            delete [] m_uiUnzipConstraintVars[index];
-
-            m_uiConstraintVars[index]=newMesh->createVector<DendroScalar>();
-            m_uiUnzipConstraintVars[index]=newMesh->createUnZippedVector<DendroScalar>();
-
-        }
+        allocateVars(newMesh);
 
         const char ** varNames=quadgrav::QUADGRAV_VAR_NAMES;
 
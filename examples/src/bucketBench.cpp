@@ -116,6 +116,84 @@ int main(int  argc, char** argv)
         std::cout<<npes<<"\t"<<stat_property[0]<<"\t"<<stat_property[1]<<"\t"<<stat_property[2]<<std::endl;
     }
 
+    // SFC index encode/decode: runtime char tables vs. constexpr tables (sfcTables.h) and Morton interleaving.
+    if(maxDepth<=SFC_MAX_ENCODE_LEVELS)
+    {
+        tmpNodes=tmpNodes_cpy;
+        const DendroIntL n=tmpNodes.size();
+        std::vector<uint64_t> sfcIndex(n);
+        unsigned int cnum,mid_bit,rot;
+        uint64_t key;
+
+        t1=std::chrono::high_resolution_clock::now();
+        for(DendroIntL i=0;i<n;i++)
+        {
+            key=0;
+            rot=0;
+            for(unsigned int l=0;l<tmpNodes[i].getLevel();l++)
+            {
+                mid_bit=maxDepth-l-1;
+                cnum=((((tmpNodes[i].getZ() >> mid_bit) & 1u) << 2u) | (((tmpNodes[i].getY() >> mid_bit) & 1u) << 1u) | ((tmpNodes[i].getX() >> mid_bit) & 1u));
+                key=(key<<dim) | (rotations[ROTATION_OFFSET * rot + NUM_CHILDREN + cnum] - '0');
+                rot=HILBERT_TABLE[NUM_CHILDREN * rot + cnum];
+            }
+            sfcIndex[i]=key;
+        }
+        double enc_char=std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - t1).count()*1e-3;
+
+        DendroIntL mismatch=0;
+        t1=std::chrono::high_resolution_clock::now();
+        for(DendroIntL i=0;i<n;i++)
+            mismatch+=(SFC::sfcEncode(tmpNodes[i].getX(),tmpNodes[i].getY(),tmpNodes[i].getZ(),tmpNodes[i].getLevel(),maxDepth)!=sfcIndex[i]);
+        double enc_constexpr=std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - t1).count()*1e-3;
+
+        unsigned int x,y,z;
+        t1=std::chrono::high_resolution_clock::now();
+        for(DendroIntL i=0;i<n;i++)
+        {
+            SFC::sfcDecode(sfcIndex[i],tmpNodes[i].getLevel(),maxDepth,x,y,z);
+            mismatch+=((x!=tmpNodes[i].getX()) || (y!=tmpNodes[i].getY()) || (z!=tmpNodes[i].getZ()));
+        }
+        double dec_constexpr=std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - t1).count()*1e-3;
+
+        t1=std::chrono::high_resolution_clock::now();
+        for(DendroIntL i=0;i<n;i++)
+        {
+            SFC::mortonDecode(SFC::mortonEncode(tmpNodes[i].getX(),tmpNodes[i].getY(),tmpNodes[i].getZ()),x,y,z);
+            mismatch+=((x!=tmpNodes[i].getX()) || (y!=tmpNodes[i].getY()) || (z!=tmpNodes[i].getZ()));
+        }
+        double morton_time=std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - t1).count()*1e-3;
+
+        t1=std::chrono::high_resolution_clock::now();
+        std::sort(tmpNodes.begin(),tmpNodes.end());
+        double cmp_sort=std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - t1).count();
+
+        double enc_stat[5]={enc_char,enc_constexpr,dec_constexpr,morton_time,cmp_sort};
+        const char* enc_label[5]={"enc_char","enc_cexpr","dec_cexpr","morton_rt","cmp_sort"};
+        DendroIntL mismatch_g=0;
+        par::Mpi_Reduce(&mismatch,&mismatch_g,1,MPI_SUM,0,GLOBAL_COMM);
+
+        for(unsigned int w=0;w<5;w++)
+        {
+            par::Mpi_Reduce(&enc_stat[w],&stat_property[0],1,MPI_MIN,0,GLOBAL_COMM);
+            par::Mpi_Reduce(&enc_stat[w],&stat_property[1],1,MPI_SUM,0,GLOBAL_COMM);
+            par::Mpi_Reduce(&enc_stat[w],&stat_property[2],1,MPI_MAX,0,GLOBAL_COMM);
+
+            if(!rank)
+            {
+                stat_property[1]=stat_property[1]/npes;
+                std::cout<<"npes\t"<<enc_label[w]<<"_min\t"<<enc_label[w]<<"_mean\t"<<enc_label[w]<<"_max"<<std::endl;
+                std::cout<<npes<<"\t"<<stat_property[0]<<"\t"<<stat_property[1]<<"\t"<<stat_property[2]<<std::endl;
+            }
+        }
+
+#if defined(__BMI2__)
+        if(!rank) std::cout<<"morton interleave: bmi2 pdep/pext, encode/decode mismatches: "<<mismatch_g<<std::endl;
+#else
+        if(!rank) std::cout<<"morton interleave: portable, encode/decode mismatches: "<<mismatch_g<<std::endl;
+#endif
+    }
+
     unsigned int sf_k=16;
     tmpNodes=tmpNodes_cpy;
     t1=std::chrono::high_resolution_clock::now();
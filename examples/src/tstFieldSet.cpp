@@ -0,0 +1,35 @@
+/**
+ * @file tstFieldSet.cpp
+ * @brief Checks the layout of the field sets and the reuse of their capacity (content kept for the same size).
+ * @version 0.1
+ *
+ * School of Computing, University of Utah.
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include "memTestUtils.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        std::cout << "Usage :" << argv[0] << " numVars szPerVar" << std::endl;
+        return 0;
+    }
+
+    const unsigned int numVars = atoi(argv[1]);
+    const size_t szPerVar = atol(argv[2]);
+
+    std::cout << "threads: " << omp_get_max_threads() << std::endl;
+
+    const bool isDouble = mem::test::isFieldSetReuseValid<double>(numVars, szPerVar);
+    const bool isFloat = mem::test::isFieldSetReuseValid<float>(numVars, szPerVar);
+
+    std::cout << "field set vars: " << numVars << " size: " << szPerVar
+              << " double: " << (isDouble ? "passed" : "failed")
+              << " float: " << (isFloat ? "passed" : "failed") << std::endl;
+
+    return (isDouble && isFloat) ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file tstMemPool.cpp
+ * @brief Checks the size class rounding of the memory pool and the reuse of the freed blocks across threads.
+ * @version 0.1
+ *
+ * School of Computing, University of Utah.
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include "memTestUtils.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cout << "Usage :" << argv[0] << " maxBytes numBlocks(per thread)[64] blockBytes[4096] align[DENDRO_MEM_ALIGN]" << std::endl;
+        return 0;
+    }
+
+    const size_t maxBytes = atol(argv[1]);
+    unsigned int numBlocks = 64;
+    size_t blockBytes = 4096;
+    unsigned int align = DENDRO_MEM_ALIGN;
+
+    if (argc > 2)
+        numBlocks = atoi(argv[2]);
+
+    if (argc > 3)
+        blockBytes = atol(argv[3]);
+
+    if (argc > 4)
+        align = atoi(argv[4]);
+
+    std::cout << "threads: " << omp_get_max_threads() << std::endl;
+
+    bool state = true;
+
+    // default thread cache cap, and a cap of one block (frees go to the shared lists).
+    const unsigned int tcacheSz[2] = {MEM_POOL_TCACHE_SZ, 1};
+    for (unsigned int i = 0; i < 2; i++)
+    {
+        memory_pool pool(align, 0, tcacheSz[i]);
+
+        const bool isRounding = mem::test::isPoolClassRoundingValid(pool, maxBytes);
+        const bool isReuse = mem::test::isPoolThreadReuseValid(pool, numBlocks, blockBytes);
+
+        std::cout << "tcache: " << tcacheSz[i] << " align: " << pool.get_alignment()
+                  << " class rounding: " << (isRounding ? "passed" : "failed")
+                  << " thread reuse: " << (isReuse ? "passed" : "failed") << std::endl;
+
+        state = state && isRounding && isReuse;
+    }
+
+    return (state) ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file tstPartitionWMC.cpp
+ * @brief Checks the multi-constraint partition (par::partitionWMC) against the brute force splitter scan on random level distributions.
+ * @version 0.1
+ *
+ * School of Computing, University of Utah.
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include "parUtils.h"
+#include "testUtils.h"
+
+#include <iostream>
+#include <vector>
+#include <random>
+
+/**@brief number of constraints (levels) of the test elements*/
+static unsigned int numLev = 1;
+
+/**@brief elements are global_id * numLev + level*/
+static unsigned int getLev(const DendroIntL* x)
+{
+    return (*x) % numLev;
+}
+
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv);
+
+    int rank, npes;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &npes);
+
+    if (argc < 3) {
+        if (!rank)
+            std::cout << "Usage :" << argv[0] << " numElements(per proc) numLevels numTrials[10] seed[0] tol[1e-10]" << std::endl;
+        MPI_Finalize();
+        return 0;
+    }
+
+    const unsigned int numElem = atoi(argv[1]);
+    numLev = atoi(argv[2]);
+    unsigned int numTrials = 10;
+    unsigned int seed = 0;
+    double tol = 1e-10;
+
+    if (argc > 3)
+        numTrials = atoi(argv[3]);
+
+    if (argc > 4)
+        seed = atoi(argv[4]);
+
+    if (argc > 5)
+        tol = atof(argv[5]);
+
+    std::mt19937 gen(seed + 1000 * rank);
+    unsigned int numFailed = 0;
+
+    for (unsigned int t = 0; t < numTrials; t++)
+    {
+        // 0 - uniform levels, 1 - runs of one level (refinement regions), 2 - mostly fine levels with a few coarse ones.
+        const unsigned int dist = t % 3;
+        const unsigned int lSz = std::uniform_int_distribution<unsigned int>(0, 2 * numElem)(gen);
+
+        std::vector<unsigned int> lev(lSz);
+        std::uniform_int_distribution<unsigned int> uLev(0, numLev - 1);
+        if (dist == 0)
+        {
+            for (unsigned int i = 0; i < lSz; i++)
+                lev[i] = uLev(gen);
+        }
+        else if (dist == 1)
+        {
+            std::uniform_int_distribution<unsigned int> uRun(1, std::max(1u, numElem / 4));
+            for (unsigned int i = 0; i < lSz;)
+            {
+                const unsigned int l = uLev(gen);
+                const unsigned int r = std::min(lSz - i, uRun(gen));
+                for (unsigned int j = 0; j < r; j++)
+                    lev[i + j] = l;
+                i += r;
+            }
+        }
+        else
+        {
+            std::geometric_distribution<unsigned int> gLev(0.5);
+            for (unsigned int i = 0; i < lSz; i++)
+                lev[i] = numLev - 1 - std::min(numLev - 1, gLev(gen));
+        }
+
+        DendroIntL lCount = lSz, gOffset = 0;
+        par::Mpi_Scan(&lCount, &gOffset, 1, MPI_SUM, comm);
+        gOffset -= lCount;
+
+        std::vector<DendroIntL> elem(lSz);
+        for (unsigned int i = 0; i < lSz; i++)
+            elem[i] = (gOffset + i) * numLev + lev[i];
+
+        par::partitionWMC(elem, getLev, numLev, comm);
+
+        // the partition keeps the global order.
+        lCount = elem.size();
+        par::Mpi_Scan(&lCount, &gOffset, 1, MPI_SUM, comm);
+        gOffset -= lCount;
+
+        bool isOrdered = true;
+        for (unsigned int i = 0; i < elem.size(); i++)
+            if (elem[i] / numLev != gOffset + i)
+                isOrdered = false;
+
+        bool isOrdered_g;
+        MPI_Allreduce(&isOrdered, &isOrdered_g, 1, MPI_CXX_BOOL, MPI_LAND, comm);
+
+        const bool isOptimal = par::test::isPartitionWMCOptimal(elem, getLev, numLev, tol, comm);
+
+        if (!(isOrdered_g && isOptimal))
+            numFailed++;
+
+        if (!rank)
+            std::cout << "trial " << t << " dist: " << dist << " order: " << (isOrdered_g ? "passed" : "failed")
+                      << " optimal: " << (isOptimal ? "passed" : "failed") << std::endl;
+    }
+
+    if (!rank)
+        std::cout << "partitionWMC: " << (numTrials - numFailed) << " of " << numTrials << " trials passed" << std::endl;
+
+    MPI_Finalize();
+    return (numFailed == 0) ? 0 : 1;
+}
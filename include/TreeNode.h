@@ -19,6 +19,7 @@ extern unsigned int m_uiMaxDepth;
 
 
 #include "hcurvedata.h"
+#include "sfcTables.h"
 #include "binUtils.h"
 #include "mpi.h"
 #include "point.h"
@@ -475,7 +476,6 @@ namespace ot {
         }
 
         unsigned int maxDiff = (unsigned int)(std::max((std::max((x1^x2),(y1^y2))),(z1^z2)));
-        int dim=m_uiDim;
 
 
 
@@ -501,10 +501,7 @@ namespace ot {
 
         unsigned int index1=0;
         unsigned int index2=0;
-        unsigned int num_children=1u<<dim; // This is basically the hilbert table offset
-        unsigned int rot_offset=num_children<<1;
-        char index_temp=0;
-        int current_rot=0;
+        unsigned int current_rot=0;
 
         //unsigned int b_x,b_y,b_z;
         //unsigned int a,b,c;
@@ -521,13 +518,13 @@ namespace ot {
             // index1=(b_z<<2) + ((b_x^b_z)<<1) + (b_x^b_y^b_z);
             index1= ((((ncaZ & (1u << mid_bit)) >> mid_bit) << 2u) |(((ncaY & (1u << mid_bit)) >> mid_bit) << 1u) | ((ncaX & (1u << mid_bit)) >> mid_bit));
             //index_temp=rotations[rot_offset*current_rot+num_children+index1]-'0';
-            current_rot=HILBERT_TABLE[current_rot*num_children+index1];
+            current_rot=SFC::ROT_NEXT[current_rot][index1];
         }
         mid_bit--;
         index1= ((((z1 & (1u << mid_bit)) >> mid_bit) << 2u) |(((y1 & (1u << mid_bit)) >> mid_bit) << 1u) | ((x1 & (1u << mid_bit)) >> mid_bit));
         index2= ((((z2 & (1u << mid_bit)) >> mid_bit) << 2u) |(((y2 & (1u << mid_bit)) >> mid_bit) << 1u) | ((x2 & (1u << mid_bit)) >> mid_bit));
 
-        return rotations[rot_offset*current_rot+num_children+index1] < rotations[rot_offset*current_rot+num_children+index2];
+        return SFC::ROT_INDEX[current_rot][index1] < SFC::ROT_INDEX[current_rot][index2];
 
 
 #else
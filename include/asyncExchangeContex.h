@@ -14,9 +14,27 @@
 
 #include "mpi.h"
 #include <vector>
+#include "memory_pool.h"
 
 namespace ot {
 
+    /**@brief units of the node local (shared memory) send ring used by an in-flight ghost exchange*/
+    struct ShmRingSlot
+    {
+        /** exchange sequence number (used as the notification tag)*/
+        unsigned int seq;
+
+        /** ring units [begin, end) used by the exchange*/
+        unsigned int begin;
+        unsigned int end;
+
+        /** true if this rank has completed the exchange*/
+        bool isEnded;
+
+        /** acknowledgements from the on node receivers, ring units can be reused once these are completed*/
+        std::vector<MPI_Request> ackRequests;
+    };
+
     class AsyncExchangeContex {
 
         protected :
@@ -31,6 +49,15 @@ namespace ot {
 
             std::vector<MPI_Request*>  m_uiRequests;
 
+            /** true if the on node neighbours are exchanged through the shared memory ring*/
+            bool m_uiIsShm=false;
+
+            /** shared memory exchange sequence number*/
+            unsigned int m_uiShmSeq=0;
+
+            /** first ring unit used by the shared memory exchange*/
+            unsigned int m_uiShmUnit=0;
+
         public:
             /**@brief creates an async ghost exchange contex*/
             AsyncExchangeContex(const void* var)
@@ -47,26 +74,26 @@ namespace ot {
             /**@brief allocates send buffer for ghost exchange*/
             inline void allocateSendBuffer(size_t bytes)
             {
-                m_uiSendBuf=malloc(bytes);
+                m_uiSendBuf=mem::get_pool()->allocate(bytes);
             }
 
             /**@brief allocates recv buffer for ghost exchange*/
             inline void allocateRecvBuffer(size_t bytes)
             {
-                m_uiRecvBuf=malloc(bytes);
+                m_uiRecvBuf=mem::get_pool()->allocate(bytes);
             }
 
             /**@brief allocates send buffer for ghost exchange*/
             inline void deAllocateSendBuffer()
             {
-                free(m_uiSendBuf);
+                mem::get_pool()->free(m_uiSendBuf);
                 m_uiSendBuf=NULL;
             }
 
             /**@brief allocates recv buffer for ghost exchange*/
             inline void deAllocateRecvBuffer()
             {
-                free(m_uiRecvBuf);
+                mem::get_pool()->free(m_uiRecvBuf);
                 m_uiRecvBuf=NULL;
             }
 
@@ -77,6 +104,18 @@ namespace ot {
 
             inline std::vector<MPI_Request*>& getRequestList(){ return m_uiRequests;}
 
+            /**@brief sets the shared memory ring slot used by the exchange*/
+            inline void setShmSlot(unsigned int seq, unsigned int unit)
+            {
+                m_uiIsShm=true;
+                m_uiShmSeq=seq;
+                m_uiShmUnit=unit;
+            }
+
+            inline bool isShm() const { return m_uiIsShm;}
+            inline unsigned int getShmSeq() const { return m_uiShmSeq;}
+            inline unsigned int getShmUnit() const { return m_uiShmUnit;}
+
             virtual bool operator== (AsyncExchangeContex other) const{
                 return( m_uiBuffer == other.m_uiBuffer );
             }
@@ -451,12 +451,12 @@ namespace ot
                 }
 
                 // 3. merge the coords keys.
-                std::vector<ot::Key> coordOcts_key;
+                ot::KeyCSR coordOcts_key;
                 mergeKeys(coordOcts_skey,coordOcts_key); // note that this will result sorted keys.
                 coordOcts_skey.clear();
 
                 // 4. Search the splitter keys in the coordOCt_keys to find which coords resides in the local proc.
-                SFC::seqSearch::SFC_treeSearch(&(*(splitterKeys.begin())),&(*(coordOcts_key.begin())),0,splitterKeys.size(),0,coordOcts_key.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+                SFC::seqSearch::SFC_treeSearch(&(*(splitterKeys.begin())),coordOcts_key.data(),0,splitterKeys.size(),0,coordOcts_key.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
 
                 assert(splitterKeys[rankActive].getFlag() & OCT_FOUND);
                 if(!(splitterKeys[rankActive].getFlag() & OCT_FOUND))
@@ -472,11 +472,12 @@ namespace ot
                 unsigned int outSz=myEnd-myBegin;
 
                 // 5. Search the coordOcts_key in the allElements to find out the corresponding keys.
-                SFC::seqSearch::SFC_treeSearch(&(*(coordOcts_key.begin())),&(*(meshOctree.begin())),myBegin,myEnd,localElementBegin,localElementEnd,m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+                SFC::seqSearch::SFC_treeSearchBatched(coordOcts_key.data(),meshOctree.data(),myBegin,myEnd,localElementBegin,localElementEnd,m_uiMaxDepth);
 
                 unsigned int searchResult;
                 double coord[3];
-                std::vector<unsigned int >* ownerList;
+                const unsigned int * ownerList;
+                unsigned int numOwners;
                 Point pt_min;
                 Point pt_max;
 
@@ -490,7 +491,8 @@ namespace ot
                     if(coordOcts_key[i].getFlag() & OCT_FOUND)
                     {
                         searchResult=coordOcts_key[i].getSearchResult();
-                        ownerList=coordOcts_key[i].getOwnerList();
+                        ownerList=coordOcts_key.getOwnerList(i);
+                        numOwners=coordOcts_key.getOwnerListSize(i);
 
                         coord[0] = domain_limit[0].x()  +  ((meshOctree[searchResult].minX() - grid_limit[0].x())*(domainRangeX/gridRangeX)) ;
                         coord[1] = domain_limit[0].y()  +  ((meshOctree[searchResult].minY() - grid_limit[0].y())*(domainRangeY/gridRangeY)) ;
@@ -505,14 +507,14 @@ namespace ot
                         pt_max = Point(coord[0], coord[1], coord[2]);
                         
                         // perform the linterpolation
-                        for(unsigned int w=0;w<ownerList->size();w++)
+                        for(unsigned int w=0;w<numOwners;w++)
                         {
-                            coord[0]=domain_coords[m_uiDim * (*ownerList)[w]     ];
-                            coord[1]=domain_coords[m_uiDim * (*ownerList)[w] + 1 ];
-                            coord[2]=domain_coords[m_uiDim * (*ownerList)[w] + 2 ];
-                            //out[(*ownerList)[w]]=lagrangeInterpElementToCoord(mesh,in,coord, pt_min, pt_max, searchResult,mesh->getElementOrder());
-                            out[(*ownerList)[w]] = linear_lagrange(mesh, in, coord, pt_min, pt_max, searchResult);
-                            validIndices.push_back((*ownerList)[w]);
+                            coord[0]=domain_coords[m_uiDim * ownerList[w]     ];
+                            coord[1]=domain_coords[m_uiDim * ownerList[w] + 1 ];
+                            coord[2]=domain_coords[m_uiDim * ownerList[w] + 2 ];
+                            //out[ownerList[w]]=lagrangeInterpElementToCoord(mesh,in,coord, pt_min, pt_max, searchResult,mesh->getElementOrder());
+                            out[ownerList[w]] = linear_lagrange(mesh, in, coord, pt_min, pt_max, searchResult);
+                            validIndices.push_back(ownerList[w]);
                         }
 
                     }
@@ -14,10 +14,26 @@
 #include "mpi.h"
 #include "mesh.h"
 #include "mathUtils.h"
+#include "memAlloc.h"
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <utility>
+
+/**@brief vectors with at least this many entries (per dof) are combined with threads in VecLinComb*/
+#ifndef DVEC_LINCOMB_OMP_MIN
+    #define DVEC_LINCOMB_OMP_MIN 8192
+#endif
+
 namespace ot
 {
+    /**
+     * @brief non-owning view of a DVector (or a part of it). Views are cheap to copy, never allocate or free, and carry the 
+     * layout of the viewed data, hence the mesh wide vector operations are defined on the views. The ODE and the application 
+     * interfaces take views, DVector owns the memory. 
+     */
     template<typename T,typename I>
-    class DVector
+    class DVectorView
     {   
         protected:
 
@@ -45,58 +61,58 @@ namespace ot
             /**@brief: MPI Communicator for the vector*/
             MPI_Comm m_uiComm;
             
-        public:
-            
-            /**@brief: default constructor*/
-            DVector();
-            
-            /**@brief: destructor*/
-            ~DVector();
-
             /**
-             * @brief Construct a new vec create object
-             * 
-             * @param pMesh : pointer to underlying ot::Mesh object
-             * @param isGhosted : true if need to create a vector with halo regions. 
-             * @param isUnzip : true if this is unzip vector format (block local vector format)
-             * @param isElemental : true if this is elemental vector
-             * @param dof : number of degrees of freedoms. 
+             * @brief calls f(b,e) on the index ranges [b,e) covered by the vector update (same ranges as VecFMA), and 
+             * returns the sum of the f values. Ranges are processed in parallel for large vectors. 
              */
-            void VecCreate(const ot::Mesh* pMesh, bool isGhosted = false, bool isUnzip =false, bool isElemental = false, unsigned int dof=1);
+            template<typename F>
+            T range_reduce(const ot::Mesh * pMesh, bool localOnly, F f) const;
 
-            /**
-             * @brief creates a element DG vector
-             * 
-             * @param pMesh Mesh object. 
-             * @param isGhosted true if the vector needs to be ghosted DG
-             * @param dof : degrees of freedom. 
-             */
-            void VecCreateDG(const ot::Mesh* pMesh, bool isGhosted = false , unsigned int dof=1);
+        public:
+            
+            /**@brief: default constructor (empty view)*/
+            DVectorView();
 
             /**
-             * @brief deallocates the vector object
+             * @brief view of an existing array. 
+             * @param data : pointer to the data
+             * @param sz : size of the array (all the dofs)
+             * @param dof : number of degrees of freedoms. 
+             * @param isGhosted : true if the array has the halo regions. 
+             * @param isUnzip : true if the array is in the unzip format. 
+             * @param isElemental : true if the array is an elemental vector. 
+             * @param comm : MPI communicator of the vector. 
              */
-            void VecDestroy();  
+            DVectorView(T* data, I sz, unsigned int dof, bool isGhosted, bool isUnzip, bool isElemental, MPI_Comm comm);
 
             /**@brief: returns the vec pointer*/
-            inline T*& GetVecArray() { return m_uiData; };
+            inline T* GetVecArray() const { return m_uiData; };
             
             /**@brief: Get the vector pointer.*/
-            inline void GetVecArray(T*& vec) { vec= m_uiData; }
+            inline void GetVecArray(T*& vec) const { vec= m_uiData; }
 
             /**
-             * @brief update the vector pointer object. 
-             * @param vec : vec pointer
+             * @brief view of the dofs [dof, dof + n), (contiguous, no copy), e.g. to exchange or unzip only a subset of the variables. 
+             * @param dof : first dof of the view
+             * @param n : number of dofs in the view. 
              */
-            inline void VecRestoreArray(T* vec) { m_uiData = vec;};
+            DVectorView<T,I> GetDofView(unsigned int dof, unsigned int n = 1) const;
 
             /**
-             * @brief copy vec v to current vector
-             * 
-             * @param v : other vector v. 
-             * @param isAlloc : true is the current vector (*this) is allocated. 
+             * @brief view of the local nodes of a single dof of a ghosted nodal vector, the view has the non ghosted layout. 
+             * @param pMesh : underlying mesh
+             * @param dof : dof of the view
              */
-            void VecCopy(DVector<T,I> v, bool isAlloc = false);
+            DVectorView<T,I> GetLocalView(const ot::Mesh* pMesh, unsigned int dof = 0) const;
+
+            /**
+             * @brief view of the padded block blk of a single dof of an unzip vector. Block views are plain arrays 
+             * (size getAllocationSzX()*getAllocationSzY()*getAllocationSzZ()), the mesh wide operations are not defined for them. 
+             * @param pMesh : underlying mesh
+             * @param blk : local block id
+             * @param dof : dof of the view
+             */
+            DVectorView<T,I> GetBlockView(const ot::Mesh* pMesh, unsigned int blk, unsigned int dof = 0) const;
 
             /**
              * @brief performs vector fuse multiplication and addition. 
@@ -107,7 +123,7 @@ namespace ot
              * @param b scale parameter for aU + bV
              * @param localOnly if true skip the ghosted regions of the array if applicable. 
              */
-            void VecFMA( const ot::Mesh * pMesh , DVector<T,I> v, T a, T b, bool localOnly = true);
+            void VecFMA( const ot::Mesh * pMesh , const DVectorView<T,I>& v, T a, T b, bool localOnly = true);
 
             /**
              * @brief 
@@ -118,6 +134,28 @@ namespace ot
              */
             void VecFMA( const ot::Mesh * pMesh , T a, T b, bool localOnly = true);
 
+            /**
+             * @brief computes the linear combination  \sum_{j=0}^{k-1} coeffs[j] * vecs[j] in a single pass and 
+             * store it in the current vector. The current vector can be one of the vecs.  
+             * @param pMesh underlying mesh data strucuture. 
+             * @param coeffs coefficients of the linear combination (size k)
+             * @param vecs vectors of the linear combination (size k), should have the same layout as the current vector. 
+             * @param k number of vectors. 
+             * @param localOnly if true skip the ghosted regions of the array if applicable. 
+             */
+            void VecLinComb( const ot::Mesh * pMesh , const T* coeffs, const DVectorView<T,I>* vecs, unsigned int k, bool localOnly = true);
+
+            /**
+             * @brief same as VecLinComb, and in the same pass computes the weighted error norm of the embedded error 
+             * e = \sum_{j=0}^{k-1} ecoeffs[j] * vecs[j],  errSq = \sum_i (e_i / (atol + rtol * max(|vecs[0]_i|, |this_i|)))^2
+             * @param ecoeffs coefficients of the error vector (size k). 
+             * @param atol absolute tolerance
+             * @param rtol relative tolerance
+             * @param[out] errSq local sum of the squared weighted errors. 
+             * @param[out] n local number of entries in errSq
+             */
+            void VecLinCombErr( const ot::Mesh * pMesh , const T* coeffs, const T* ecoeffs, const DVectorView<T,I>* vecs, unsigned int k, T atol, T rtol, T& errSq, DendroIntL& n, bool localOnly = true);
+
             /**
              * @brief : equal operator for the DVector
              * 
@@ -125,9 +163,7 @@ namespace ot
              * @return true if points to the same pointer. 
              * @return false otherwise. 
              */
-            bool operator==(DVector<T,I>& other) const { return ( m_uiData == (other.GetVecArray())); }
-
-            void operator=(DVector<T,I> other); 
+            bool operator==(const DVectorView<T,I>& other) const { return ( m_uiData == (other.GetVecArray())); }
 
             /**@brief: get is ghosted variable. */
             inline bool IsGhosted() const { return m_uiIsGhosted; } 
@@ -152,19 +188,98 @@ namespace ot
             /**@brief get the 2D array for a multiple dof vector
              * @param isAlloc: true if the mem allocated for T*. False otherwise. 
             */
-            void Get2DArray(T** & v2d, bool isAlloc = false);
+            void Get2DArray(T** & v2d, bool isAlloc = false) const;
 
             /**@brief: get size per dof*/
             inline I GetSizePerDof() const {return (m_uiSize/m_uiDof) ;}
 
             /**@brief: computes the min and max of the vector. */
-            void VecMinMax(const ot::Mesh* pMesh, T& min, T& max, unsigned int dof=0);
+            void VecMinMax(const ot::Mesh* pMesh, T& min, T& max, unsigned int dof=0) const;
+        
+    };
+
+    /**
+     * @brief Vector that owns its memory (allocated with VecCreate or VecCreateDG, released by VecDestroy or the destructor). The memory 
+     * comes from the mem:: allocator, i.e. large vectors are huge page aligned and placed with the NUMA policy. 
+     * DVector is move only, use DVectorView (or the implicit conversion to it) to share the data. 
+     */
+    template<typename T,typename I>
+    class DVector : public DVectorView<T,I>
+    {   
+        protected:
+            using DVectorView<T,I>::m_uiData;
+            using DVectorView<T,I>::m_uiSize;
+            using DVectorView<T,I>::m_uiIsUnzip;
+            using DVectorView<T,I>::m_uiIsElemental;
+            using DVectorView<T,I>::m_uiIsGhosted;
+            using DVectorView<T,I>::m_uiDof;
+            using DVectorView<T,I>::m_uiComm;
+
+        public:
+            
+            /**@brief: default constructor*/
+            DVector();
+            
+            /**@brief: destructor, releases the memory*/
+            ~DVector();
+
+            DVector(const DVector<T,I>& other) = delete;
+
+            DVector<T,I>& operator=(const DVector<T,I>& other) = delete;
+
+            /**@brief: move constructor, other is left empty. */
+            DVector(DVector<T,I>&& other) noexcept;
+
+            /**@brief: move assignment, releases the current memory and other is left empty. */
+            DVector<T,I>& operator=(DVector<T,I>&& other) noexcept;
+
+            /**
+             * @brief Construct a new vec create object, releases the current memory if any. 
+             * 
+             * @param pMesh : pointer to underlying ot::Mesh object
+             * @param isGhosted : true if need to create a vector with halo regions. 
+             * @param isUnzip : true if this is unzip vector format (block local vector format)
+             * @param isElemental : true if this is elemental vector
+             * @param dof : number of degrees of freedoms. 
+             */
+            void VecCreate(const ot::Mesh* pMesh, bool isGhosted = false, bool isUnzip =false, bool isElemental = false, unsigned int dof=1);
+
+            /**
+             * @brief creates a element DG vector, releases the current memory if any. 
+             * 
+             * @param pMesh Mesh object. 
+             * @param isGhosted true if the vector needs to be ghosted DG
+             * @param dof : degrees of freedom. 
+             */
+            void VecCreateDG(const ot::Mesh* pMesh, bool isGhosted = false , unsigned int dof=1);
+
+            /**
+             * @brief deallocates the vector object
+             */
+            void VecDestroy();  
+
+            /**
+             * @brief update the vector pointer object, the vector takes the ownership of vec (allocated with mem::alloc, GetSize() entries). 
+             * @param vec : vec pointer
+             */
+            inline void VecRestoreArray(T* vec) { m_uiData = vec;};
+
+            /**
+             * @brief copy vec v to current vector
+             * 
+             * @param v : other vector v. 
+             * @param isAlloc : true is the current vector (*this) is allocated. 
+             */
+            void VecCopy(const DVectorView<T,I>& v, bool isAlloc = false);
+
+            /**@brief: view of the vector*/
+            inline DVectorView<T,I> GetView() const { return DVectorView<T,I>(*this); }
         
     };
 
 
     template<typename T,typename I>
-    DVector<T,I>::DVector()
+    DVectorView<T,I>::DVectorView()
     {
         m_uiData = NULL;
         m_uiSize =0;
@@ -176,22 +291,82 @@ namespace ot
 
     }
 
+    template<typename T,typename I>
+    DVectorView<T,I>::DVectorView(T* data, I sz, unsigned int dof, bool isGhosted, bool isUnzip, bool isElemental, MPI_Comm comm)
+    {
+        m_uiData = data;
+        m_uiSize = sz;
+        m_uiDof = dof;
+        m_uiIsElemental = isElemental;
+        m_uiIsGhosted = isGhosted;
+        m_uiIsUnzip = isUnzip;
+        m_uiComm = comm;
+    }
+
+    template<typename T,typename I>
+    DVectorView<T,I> DVectorView<T,I>::GetDofView(unsigned int dof, unsigned int n) const
+    {
+        assert( (dof + n) <= m_uiDof );
+        const I nPDOF = this->GetSizePerDof();
+        return DVectorView<T,I>(m_uiData + dof*nPDOF, n*nPDOF, n, m_uiIsGhosted, m_uiIsUnzip, m_uiIsElemental, m_uiComm);
+    }
+
+    template<typename T,typename I>
+    DVectorView<T,I> DVectorView<T,I>::GetLocalView(const ot::Mesh* pMesh, unsigned int dof) const
+    {
+        assert( (m_uiIsUnzip==false) && (m_uiIsGhosted==true) && (m_uiIsElemental ==false) && dof < m_uiDof);
+        if(!(pMesh->isActive()))
+            return DVectorView<T,I>(NULL, 0, 1, false, false, false, m_uiComm);
+
+        return DVectorView<T,I>(m_uiData + dof*this->GetSizePerDof() + pMesh->getNodeLocalBegin(), pMesh->getNumLocalMeshNodes(), 1, false, false, false, m_uiComm);
+    }
+
+    template<typename T,typename I>
+    DVectorView<T,I> DVectorView<T,I>::GetBlockView(const ot::Mesh* pMesh, unsigned int blk, unsigned int dof) const
+    {
+        assert( (m_uiIsUnzip==true) && (m_uiIsElemental ==false) && dof < m_uiDof && blk < pMesh->getLocalBlockList().size());
+        const ot::Block& block = pMesh->getLocalBlockList()[blk];
+        const I sz = block.getAllocationSzX()*block.getAllocationSzY()*block.getAllocationSzZ();
+        return DVectorView<T,I>(m_uiData + dof*this->GetSizePerDof() + block.getOffset(), sz, 1, false, true, false, m_uiComm);
+    }
+
+    template<typename T,typename I>
+    DVector<T,I>::DVector() : DVectorView<T,I>()
+    {
+
+    }
+
     template<typename T,typename I>
     DVector<T,I>::~DVector()
     {
-        // delete [] m_uiData;
-        // m_uiData = NULL;
-        // m_uiSize =0;
-        // m_uiDof=0;
-        // m_uiIsElemental = false;
-        // m_uiIsGhosted =false;
-        // m_uiIsUnzip =false;
-        // m_uiComm = MPI_COMM_NULL;
+        this->VecDestroy();
+    }
+
+    template<typename T,typename I>
+    DVector<T,I>::DVector(DVector<T,I>&& other) noexcept : DVectorView<T,I>(other)
+    {
+        other.m_uiData = NULL;
+        other.m_uiSize = 0;
+    }
+
+    template<typename T,typename I>
+    DVector<T,I>& DVector<T,I>::operator=(DVector<T,I>&& other) noexcept
+    {
+        if(this != &other)
+        {
+            this->VecDestroy();
+            DVectorView<T,I>::operator=(other);
+            other.m_uiData = NULL;
+            other.m_uiSize = 0;
+        }
+
+        return *this;
     }
 
     template<typename T,typename I>
     void DVector<T,I>::VecCreate(const ot::Mesh* pMesh, bool isGhosted, bool isUnzip, bool isElemental, unsigned int dof)
     {
+        this->VecDestroy();
         
         m_uiIsGhosted = isGhosted;
         m_uiIsUnzip = isUnzip;
@@ -247,7 +422,7 @@ namespace ot
 
         }
 
-        m_uiData = new T[m_uiSize];
+        m_uiData = mem::alloc<T>(m_uiSize);
 
         return ;
 
@@ -256,6 +431,8 @@ namespace ot
     template<typename T, typename I>
     void DVector<T,I>::VecCreateDG(const ot::Mesh* pMesh, bool isGhosted, unsigned int dof)
     {
+        this->VecDestroy();
+
         m_uiIsGhosted = isGhosted;
         m_uiIsElemental = true; // dg vectors are inherently elemental vectors. 
         m_uiDof = dof;
@@ -272,7 +449,7 @@ namespace ot
         else
             m_uiSize = pMesh->getNumLocalMeshElements()*pMesh->getNumNodesPerElement() * m_uiDof;
 
-        m_uiData = new T[m_uiSize];
+        m_uiData = mem::alloc<T>(m_uiSize);
         return ;
 
 
@@ -282,7 +459,7 @@ namespace ot
     template<typename T,typename I>
     void DVector<T,I>::VecDestroy()
     {
-        delete [] m_uiData;
+        mem::dealloc(m_uiData,m_uiSize);
         m_uiData = NULL;
         m_uiSize =0;
         m_uiDof=0;
@@ -293,22 +470,7 @@ namespace ot
 
 
     template<typename T, typename I>
-    void DVector<T,I>::operator=(DVector<T,I> other)
-    {
-        m_uiData = other.GetVecArray();;
-        m_uiDof = other.GetDof();
-        m_uiSize = other.GetSize();
-        m_uiIsElemental = other.IsElemental();
-        m_uiIsGhosted = other.IsGhosted();
-        m_uiIsUnzip = other.IsUnzip();
-        m_uiComm = other.GetMPIComm();
-
-        return;
-    }
-
-
-    template<typename T, typename I>
-    void DVector<T,I>::Get2DArray(T**& v2d, bool isAlloc)
+    void DVectorView<T,I>::Get2DArray(T**& v2d, bool isAlloc) const
     {
 
         assert((m_uiSize%m_uiDof)==0);
@@ -327,11 +489,12 @@ namespace ot
 
 
     template<typename T, typename I >
-    void DVector<T,I>::VecCopy(DVector<T,I> v, bool isAlloc)
+    void DVector<T,I>::VecCopy(const DVectorView<T,I>& v, bool isAlloc)
     {
         if(!isAlloc)
         {
-            m_uiData = new T [ v.GetSize() ];
+            this->VecDestroy();
+            m_uiData = mem::alloc<T>(v.GetSize());
         }else
         {
             assert(m_uiSize ==v.GetSize());
@@ -342,8 +505,9 @@ namespace ot
         m_uiIsElemental = v.IsElemental();
         m_uiIsGhosted = v.IsGhosted();
         m_uiIsUnzip = v.IsUnzip();
+        m_uiComm = v.GetMPIComm();
 
-        T* dptr = v.GetVecArray();
+        const T* dptr = v.GetVecArray();
          
         std::memcpy(m_uiData, dptr, sizeof(T)*m_uiSize);
         return;
@@ -351,7 +515,7 @@ namespace ot
     }
 
     template<typename T, typename I>
-    void DVector<T,I>::VecFMA(const ot::Mesh * pMesh , DVector<T,I> v, T a, T b, bool localOnly)
+    void DVectorView<T,I>::VecFMA(const ot::Mesh * pMesh , const DVectorView<T,I>& v, T a, T b, bool localOnly)
     {   
         
         if(!(pMesh->isActive()))
@@ -432,7 +596,7 @@ namespace ot
     }
 
     template<typename T, typename I>
-    void DVector<T,I>::VecFMA(const ot::Mesh * pMesh , T a, T b, bool localOnly)
+    void DVectorView<T,I>::VecFMA(const ot::Mesh * pMesh , T a, T b, bool localOnly)
     {
         if(!(pMesh->isActive()))
             return;
@@ -504,7 +668,155 @@ namespace ot
     }
 
     template<typename T, typename I>
-    void DVector<T,I>::VecMinMax(const ot::Mesh* pMesh, T& min, T& max, unsigned int dof)
+    template<typename F>
+    T DVectorView<T,I>::range_reduce(const ot::Mesh * pMesh, bool localOnly, F f) const
+    {
+        const I nPDOF = this->GetSizePerDof();
+        T sum = 0;
+
+        if(m_uiIsUnzip==true && localOnly)
+        {
+            // only the block internal, row by row. 
+            const ot::Block* const  blkList = pMesh->getLocalBlockList().data();
+            const unsigned int numBlks = pMesh->getLocalBlockList().size();
+
+            #pragma omp parallel for schedule(dynamic) collapse(2) reduction(+:sum) if(nPDOF>=DVEC_LINCOMB_OMP_MIN)
+            for (unsigned int v=0; v < m_uiDof; v++)
+            {
+                for(unsigned int blk =0; blk< numBlks; blk ++)
+                {
+                    const I offset = v*nPDOF + blkList[blk].getOffset();
+                    const unsigned int nx = blkList[blk].getAllocationSzX();
+                    const unsigned int ny = blkList[blk].getAllocationSzY();
+                    const unsigned int nz = blkList[blk].getAllocationSzZ();
+                    const unsigned int pw = blkList[blk].get1DPadWidth();
+
+                    for(unsigned int kk =pw; kk < (nz-pw); kk++)
+                     for(unsigned int jj=pw; jj < (ny-pw); jj++)
+                        sum += f(offset + kk*ny*nx + jj*nx + pw, offset + kk*ny*nx + jj*nx + (nx-pw));
+                }
+            }
+
+        }else
+        {
+            // contiguous range per dof. (whole vector for unzip vectors with padding)
+            I b, e;
+            unsigned int numDof = m_uiDof;
+            if(m_uiIsUnzip==true)
+            {
+                b = 0; e = m_uiSize; numDof = 1;
+            }else if(!m_uiIsGhosted)
+            {
+                b = 0; e = nPDOF;
+            }else if(localOnly)
+            {
+                b = pMesh->getNodeLocalBegin(); e = pMesh->getNodeLocalEnd();
+            }else
+            {
+                b = pMesh->getNodePreGhostBegin(); e = pMesh->getNodePostGhostEnd();
+            }
+
+            const I nc = (m_uiIsUnzip) ? m_uiSize : nPDOF;
+            const I chunk = DVEC_LINCOMB_OMP_MIN;
+            const I numChunks = ((e-b) + chunk -1)/chunk;
+
+            #pragma omp parallel for schedule(static) collapse(2) reduction(+:sum) if((e-b)>=DVEC_LINCOMB_OMP_MIN)
+            for(unsigned int v=0; v < numDof; v++)
+            {
+                for(I c=0; c < numChunks; c++)
+                {
+                    const I cb = b + c*chunk;
+                    const I ce = std::min(cb + chunk, e);
+                    sum += f(v*nc + cb, v*nc + ce);
+                }
+            }
+
+        }
+
+        return sum;
+    }
+
+    template<typename T, typename I>
+    void DVectorView<T,I>::VecLinComb(const ot::Mesh * pMesh , const T* coeffs, const DVectorView<T,I>* vecs, unsigned int k, bool localOnly)
+    {
+        if(!(pMesh->isActive()) || k==0)
+            return;
+
+        std::vector<const T*> vptr(k);
+        for(unsigned int j=0; j < k; j++)
+        {
+            assert((this->IsElemental() == vecs[j].IsElemental()) && (this->IsUnzip() == vecs[j].IsUnzip()) && (this->IsGhosted() == vecs[j].IsGhosted()) && (this->GetSize() == vecs[j].GetSize()) && (this->GetDof() == vecs[j].GetDof()) );
+            vptr[j] = vecs[j].m_uiData;
+        }
+
+        const T* const * const vp = vptr.data();
+        T* const out = m_uiData;
+
+        // out[b:e) = \sum_j coeffs[j] * vp[j][b:e), each entry is read from all the vectors before it is written. 
+        range_reduce(pMesh, localOnly, [out,vp,coeffs,k](I b, I e)
+        {
+            #pragma omp simd
+            for(I n=b; n < e; n++)
+            {
+                T s = coeffs[0]*vp[0][n];
+                for(unsigned int j=1; j < k; j++)
+                    s += coeffs[j]*vp[j][n];
+                out[n] = s;
+            }
+            return (T)0;
+        });
+
+        return;
+
+    }
+
+    template<typename T, typename I>
+    void DVectorView<T,I>::VecLinCombErr(const ot::Mesh * pMesh , const T* coeffs, const T* ecoeffs, const DVectorView<T,I>* vecs, unsigned int k, T atol, T rtol, T& errSq, DendroIntL& n, bool localOnly)
+    {
+        errSq = 0;
+        n = 0;
+        if(!(pMesh->isActive()) || k==0)
+            return;
+
+        std::vector<const T*> vptr(k);
+        for(unsigned int j=0; j < k; j++)
+        {
+            assert((this->IsElemental() == vecs[j].IsElemental()) && (this->IsUnzip() == vecs[j].IsUnzip()) && (this->IsGhosted() == vecs[j].IsGhosted()) && (this->GetSize() == vecs[j].GetSize()) && (this->GetDof() == vecs[j].GetDof()) );
+            vptr[j] = vecs[j].m_uiData;
+        }
+
+        const T* const * const vp = vptr.data();
+        T* const out = m_uiData;
+
+        // same sweep as VecLinComb, the error vector is never stored.
+        errSq = range_reduce(pMesh, localOnly, [out,vp,coeffs,ecoeffs,k,atol,rtol](I b, I e)
+        {
+            T lsum = 0;
+            #pragma omp simd reduction(+:lsum)
+            for(I n=b; n < e; n++)
+            {
+                const T u0 = vp[0][n];
+                T s  = coeffs[0]*u0;
+                T er = ecoeffs[0]*u0;
+                for(unsigned int j=1; j < k; j++)
+                {
+                    s  += coeffs[j]*vp[j][n];
+                    er += ecoeffs[j]*vp[j][n];
+                }
+                out[n] = s;
+                const T sc = atol + rtol * std::max(std::fabs(u0),std::fabs(s));
+                lsum += (er/sc)*(er/sc);
+            }
+            return lsum;
+        });
+
+        n = (DendroIntL)range_reduce(pMesh, localOnly, [](I b, I e){ return (T)(e-b); });
+        return;
+
+    }
+
+    template<typename T, typename I>
+    void DVectorView<T,I>::VecMinMax(const ot::Mesh* pMesh, T& min, T& max, unsigned int dof) const
     {
         if(!(pMesh->isActive())) return;
 
@@ -528,4 +840,5 @@ namespace ot
 }// end of namespace ot
 
 
-typedef ot::DVector<DendroScalar, DendroIntL> DVec;
\ No newline at end of file
+typedef ot::DVector<DendroScalar, DendroIntL> DVec;
+typedef ot::DVectorView<DendroScalar, DendroIntL> DVecView;
\ No newline at end of file
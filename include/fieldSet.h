@@ -0,0 +1,216 @@
+/**
+ * @file fieldSet.h
+ * @brief Multi-variable state stored in a single aligned allocation.
+ * All the variables of a field set (e.g. the evolution variables, or all the rk stages) live in one buffer aligned to
+ * DENDRO_FIELD_SET_ALIGN bytes, each variable starts at a DENDRO_FIELD_ALIGN byte boundary. The buffer is reused while the
+ * requested size fits in the capacity, hence remesh only reallocates when the new mesh is larger than the current one. The
+ * buffer comes from the mem:: allocator (huge pages and NUMA placement).
+ * @version 0.1
+ *
+ * School of Computing, University of Utah.
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#pragma once
+#include <utility>
+#include <algorithm>
+#include <assert.h>
+#include <omp.h>
+#include "memAlloc.h"
+
+/**@brief alignment (bytes) of the field set buffer, 2MB i.e. huge page boundary */
+#ifndef DENDRO_FIELD_SET_ALIGN
+    #define DENDRO_FIELD_SET_ALIGN (2ul<<20)
+#endif
+
+/**@brief alignment (bytes) of each variable in the field set */
+#ifndef DENDRO_FIELD_ALIGN
+    #define DENDRO_FIELD_ALIGN 64ul
+#endif
+
+namespace ot
+{
+    template<typename T>
+    class FieldSet
+    {
+        protected:
+
+            /**@brief: buffer storing all the variables*/
+            T* m_uiData = NULL;
+
+            /**@brief: allocated size of the buffer (number of T)*/
+            size_t m_uiCapacity = 0;
+
+            /**@brief: offset between two consecutive variables (number of T)*/
+            size_t m_uiStride = 0;
+
+            /**@brief: number of entries of a variable*/
+            size_t m_uiSzPerVar = 0;
+
+            /**@brief: number of variables*/
+            unsigned int m_uiNumVars = 0;
+
+            /**@brief: pointer to each variable (NULL if the size per variable is zero)*/
+            T** m_uiPtrs = NULL;
+
+            /**@brief: part of the buffer [0, m_uiTouched) already first touched (number of T)*/
+            size_t m_uiTouched = 0;
+
+        protected:
+
+            /**
+             * @brief: first touch of the buffer above begin. Each variable is touched with its own static loop over [0, m_uiSzPerVar),
+             * (same schedule as the solver node loops) so every thread owns the pages of its node range in all the variables.
+             * @param begin : entries below begin are already touched
+             */
+            void first_touch(size_t begin)
+            {
+                T* const __restrict__ p = m_uiData;
+                const size_t stride = m_uiStride;
+                const size_t szPerVar = m_uiSzPerVar;
+                const unsigned int numVars = m_uiNumVars;
+
+                #pragma omp parallel
+                {
+                    for(unsigned int v=0; v < numVars; v++)
+                    {
+                        T* const __restrict__ pv = p + v*stride;
+                        const size_t vBegin = (begin > v*stride) ? (begin - v*stride) : 0;
+                        if(vBegin >= stride)
+                            continue;
+
+                        #pragma omp for schedule(static) nowait
+                        for(size_t n=0; n < szPerVar; n++)
+                            if(n >= vBegin)
+                                pv[n] = (T)0;
+
+                        #pragma omp single nowait
+                        for(size_t n=std::max(szPerVar, vBegin); n < stride; n++)
+                            pv[n] = (T)0;
+                    }
+                }
+            }
+
+        public:
+
+            FieldSet(){};
+
+            ~FieldSet() { this->release(); }
+
+            FieldSet(const FieldSet&) = delete;
+            FieldSet& operator=(const FieldSet&) = delete;
+
+            FieldSet(FieldSet&& other) noexcept { this->swap(other); }
+
+            FieldSet& operator=(FieldSet&& other) noexcept
+            {
+                if(this != &other)
+                {
+                    this->release();
+                    this->swap(other);
+                }
+                return *this;
+            }
+
+            /**
+             * @brief allocates numVars variables of szPerVar entries each. The existing buffer is reused if it is large enough,
+             * otherwise it is reallocated. Pages are first touched by the threads (static schedule over the entries of each variable)
+             * when they are used for the first time. The content is preserved only if numVars and szPerVar are unchanged.
+             * @param numVars : number of variables
+             * @param szPerVar : number of entries per variable (e.g. pMesh->getDegOfFreedom())
+             * @return true if the buffer was reallocated
+             */
+            bool allocate(unsigned int numVars, size_t szPerVar)
+            {
+                const size_t fAlign = DENDRO_FIELD_ALIGN/sizeof(T);
+                const size_t stride = ((szPerVar + fAlign -1)/fAlign)*fAlign;
+                const size_t sz = stride*numVars;
+                bool isRealloc = false;
+
+                if(numVars != m_uiNumVars)
+                {
+                    delete [] m_uiPtrs;
+                    m_uiPtrs = (numVars) ? new T*[numVars] : NULL;
+                }
+
+                m_uiNumVars  = numVars;
+                m_uiStride   = stride;
+                m_uiSzPerVar = szPerVar;
+
+                if(sz > m_uiCapacity)
+                {
+                    mem::dealloc(m_uiData, m_uiCapacity);
+                    m_uiData = NULL;
+
+                    const size_t bytes = ((sz*sizeof(T) + DENDRO_FIELD_SET_ALIGN -1)/DENDRO_FIELD_SET_ALIGN)*DENDRO_FIELD_SET_ALIGN;
+                    m_uiData = mem::alloc<T>(bytes/sizeof(T), DENDRO_FIELD_SET_ALIGN, mem::MEM_ALLOC_PARALLEL_TOUCH);
+
+                    m_uiCapacity = bytes/sizeof(T);
+                    m_uiTouched  = 0;
+                    isRealloc = true;
+                }
+
+                if(sz > m_uiTouched)
+                {
+                    this->first_touch(m_uiTouched);
+                    m_uiTouched = sz;
+                }
+
+                for(unsigned int v=0; v < m_uiNumVars; v++)
+                    m_uiPtrs[v] = (szPerVar) ? m_uiData + v*m_uiStride : NULL;
+
+                return isRealloc;
+            }
+
+            /**@brief: frees the buffer and the pointer table*/
+            void release()
+            {
+                mem::dealloc(m_uiData, m_uiCapacity);
+                delete [] m_uiPtrs;
+
+                m_uiData = NULL;
+                m_uiPtrs = NULL;
+                m_uiCapacity = 0;
+                m_uiTouched = 0;
+                m_uiStride = 0;
+                m_uiSzPerVar = 0;
+                m_uiNumVars = 0;
+            }
+
+            /**@brief: swaps the content (and the pointer tables) of two field sets*/
+            void swap(FieldSet& other) noexcept
+            {
+                std::swap(m_uiData, other.m_uiData);
+                std::swap(m_uiCapacity, other.m_uiCapacity);
+                std::swap(m_uiTouched, other.m_uiTouched);
+                std::swap(m_uiStride, other.m_uiStride);
+                std::swap(m_uiSzPerVar, other.m_uiSzPerVar);
+                std::swap(m_uiNumVars, other.m_uiNumVars);
+                std::swap(m_uiPtrs, other.m_uiPtrs);
+            }
+
+            /**@brief: pointer table, valid until the next allocate with a different number of variables*/
+            inline T** ptrs() const { return m_uiPtrs; }
+
+            /**@brief: pointer to the variable v*/
+            inline T* operator[](unsigned int v) const { return m_uiPtrs[v]; }
+
+            /**@brief: number of variables*/
+            inline unsigned int get_num_vars() const { return m_uiNumVars; }
+
+            /**@brief: number of entries per variable*/
+            inline size_t get_size_per_var() const { return m_uiSzPerVar; }
+
+            /**@brief: offset between two consecutive variables*/
+            inline size_t get_stride() const { return m_uiStride; }
+
+            /**@brief: allocated size (number of T)*/
+            inline size_t get_capacity() const { return m_uiCapacity; }
+
+            /**@brief: memory used by the field set in bytes*/
+            inline size_t get_bytes() const { return m_uiCapacity*sizeof(T); }
+
+    };
+
+}// end of namespace ot
@@ -0,0 +1,147 @@
+/**
+*@brief flat search key container. Keys are stored as a plain octant array and the
+* owner / stencil-direction lists of every key are stored in CSR form next to it,
+* so building a key set does not allocate per key.
+*/
+//
+
+#ifndef SFCSORTBENCH_KEYCSR_H
+#define SFCSORTBENCH_KEYCSR_H
+
+#include "TreeNode.h"
+#include <iostream>
+#include <vector>
+#include <assert.h>
+
+namespace ot
+{
+
+    /**
+     * @brief search key without owner storage. (owners are kept in ot::KeyCSR)
+     * */
+    class FlatKey : public ot::TreeNode
+    {
+
+    protected:
+        unsigned int m_uiSearchResult;
+
+    public:
+        FlatKey()
+        {
+            m_uiX=0;
+            m_uiY=0;
+            m_uiZ=0;
+            m_uiLevel=0;
+            m_uiSearchResult=0;
+        }
+
+        FlatKey(unsigned int px, unsigned int py, unsigned int pz, unsigned int plevel,unsigned int pDim,unsigned int pMaxDepth)
+        {
+            m_uiX=px;
+            m_uiY=py;
+            m_uiZ=pz;
+            m_uiLevel=plevel;
+            m_uiSearchResult=0;
+        }
+
+        FlatKey(unsigned int pLevel, unsigned int pMaxDepth)
+        {
+            m_uiX=0;
+            m_uiY=0;
+            m_uiZ=0;
+            m_uiLevel=pLevel;
+            m_uiSearchResult=0;
+        }
+
+        FlatKey(const ot::TreeNode& node)
+        {
+            m_uiX=node.getX();
+            m_uiY=node.getY();
+            m_uiZ=node.getZ();
+            m_uiLevel=node.getFlag();
+            m_uiSearchResult=0;
+        }
+
+        inline void setSearchResult(unsigned int pIndex) {m_uiSearchResult=pIndex;}
+        inline unsigned int getSearchResult()const {return m_uiSearchResult;}
+
+    };
+
+
+    /**
+     * @brief SFC sorted unique keys with their owner lists in CSR form.
+     * owners of key k are m_uiOwner[m_uiOwnerOffset[k] : m_uiOwnerOffset[k+1]) and the
+     * corresponding stencil index & direction (same packing as ot::Key) are stored at the same positions.
+     * Note: owner rows are positional, hence the key array must stay in SFC order. SFC_treeSearch on a
+     * sorted key array does not change the key order, so the keys can be searched directly.
+     * */
+    class KeyCSR
+    {
+
+    protected:
+        std::vector<ot::FlatKey> m_uiKeys;
+        std::vector<unsigned int> m_uiOwnerOffset;
+        std::vector<unsigned int> m_uiOwner;
+        std::vector<unsigned int> m_uiStencilIndexWithDirection;
+
+    public:
+        KeyCSR()
+        {
+            m_uiOwnerOffset.push_back(0);
+        }
+
+        inline void clear()
+        {
+            m_uiKeys.clear();
+            m_uiOwner.clear();
+            m_uiStencilIndexWithDirection.clear();
+            m_uiOwnerOffset.clear();
+            m_uiOwnerOffset.push_back(0);
+        }
+
+        /**@brief reserve space for nKeys keys with nOwners owners in total*/
+        inline void reserve(unsigned int nKeys, unsigned int nOwners)
+        {
+            m_uiKeys.reserve(nKeys);
+            m_uiOwnerOffset.reserve(nKeys+1);
+            m_uiOwner.reserve(nOwners);
+            m_uiStencilIndexWithDirection.reserve(nOwners);
+        }
+
+        /**@brief appends a new key (with empty owner list) at the end. Keys should be appended in SFC order. */
+        inline void addKey(const ot::TreeNode& key)
+        {
+            m_uiKeys.push_back(ot::FlatKey(key));
+            m_uiKeys.back().setFlag(key.getLevel());
+            m_uiOwnerOffset.push_back(m_uiOwnerOffset.back());
+        }
+
+        /**@brief adds an owner to the last key. */
+        inline void addOwner(unsigned int ownerLocalID, unsigned int stencilIndexDirection)
+        {
+            assert(!m_uiKeys.empty());
+            m_uiOwner.push_back(ownerLocalID);
+            m_uiStencilIndexWithDirection.push_back(stencilIndexDirection);
+            m_uiOwnerOffset.back()++;
+        }
+
+        inline unsigned int size() const {return m_uiKeys.size();}
+        inline bool empty() const {return m_uiKeys.empty();}
+
+        inline ot::FlatKey& operator[](unsigned int k) {return m_uiKeys[k];}
+        inline const ot::FlatKey& operator[](unsigned int k) const {return m_uiKeys[k];}
+
+        /**@brief key array (to be used with SFC_treeSearch)*/
+        inline ot::FlatKey* data() {return m_uiKeys.data();}
+        inline const std::vector<ot::FlatKey>& keys() const {return m_uiKeys;}
+
+        inline unsigned int getOwnerListSize(unsigned int k) const {return m_uiOwnerOffset[k+1]-m_uiOwnerOffset[k];}
+        inline const unsigned int* getOwnerList(unsigned int k) const {return m_uiOwner.data()+m_uiOwnerOffset[k];}
+        inline const unsigned int* getStencilIndexDirectionList(unsigned int k) const {return m_uiStencilIndexWithDirection.data()+m_uiOwnerOffset[k];}
+
+    };
+
+}
+
+
+#endif //SFCSORTBENCH_KEYCSR_H
@@ -0,0 +1,165 @@
+/**
+ * @file memAlloc.h
+ * @brief Pluggable allocator for the large field buffers (mesh vectors, DVector, field sets, memory_pool).
+ * Buffers larger than DENDRO_MEM_HUGE_THRESHOLD bytes are aligned to the huge page size, advised with MADV_HUGEPAGE and
+ * optionally bound to the local NUMA node (mbind/set_mempolicy syscalls, no libnuma). The placement is applied before the
+ * first touch, hence the policy decides where the pages are faulted.
+ * @version 0.1
+ *
+ * School of Computing, University of Utah.
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+
+/**@brief: default alignment (bytes), cache line */
+#ifndef DENDRO_MEM_ALIGN
+    #define DENDRO_MEM_ALIGN 64ul
+#endif
+
+/**@brief: huge page size (bytes), x86-64 2MB pages */
+#ifndef DENDRO_MEM_HUGE_PAGE_SZ
+    #define DENDRO_MEM_HUGE_PAGE_SZ (2ul<<20)
+#endif
+
+/**@brief: buffers with at least this many bytes get the huge page alignment and the placement policy */
+#ifndef DENDRO_MEM_HUGE_THRESHOLD
+    #define DENDRO_MEM_HUGE_THRESHOLD (4ul<<20)
+#endif
+
+namespace mem
+{
+    /**@brief: placement policy flags, MEM_POLICY_NUMA_LOCAL and MEM_POLICY_NUMA_INTERLEAVE are exclusive. */
+    enum MEM_POLICY
+    {
+        MEM_POLICY_DEFAULT=0,
+        MEM_POLICY_THP=1u,
+        MEM_POLICY_NUMA_LOCAL=2u,
+        MEM_POLICY_NUMA_INTERLEAVE=4u
+    };
+
+    /**
+     * @brief allocation hints. 
+     * MEM_ALLOC_PARALLEL_TOUCH : the buffer is first touched by all the threads (e.g. FieldSet), MEM_POLICY_NUMA_LOCAL is not applied 
+     * so that the pages stay on the node of the thread which touches them. 
+     */
+    enum MEM_ALLOC_FLAGS
+    {
+        MEM_ALLOC_DEFAULT=0,
+        MEM_ALLOC_PARALLEL_TOUCH=1u
+    };
+
+    /**
+     * @brief allocator interface. Memory allocated with allocate should be released with deallocate of the same allocator.
+     */
+    class Allocator
+    {
+        public:
+            virtual ~Allocator(){};
+
+            /**
+             * @brief allocates bytes (uninitialized).
+             * @param bytes : size in bytes
+             * @param align : requested alignment, the allocation is aligned to max(align, alignment(bytes))
+             * @param flags : MEM_ALLOC_FLAGS hints
+             * @return pointer to the memory, NULL if bytes is zero
+             */
+            virtual void* allocate(size_t bytes, size_t align=0, unsigned int flags=MEM_ALLOC_DEFAULT) = 0;
+
+            /**@brief: releases memory from allocate, bytes is the allocated size*/
+            virtual void deallocate(void* p, size_t bytes) = 0;
+
+            /**@brief: applies the placement policy to the pages of [p, p+bytes) allocated elsewhere (e.g. new []). Should be called
+             * before the pages are touched. */
+            virtual void advise(void* p, size_t bytes, unsigned int flags=MEM_ALLOC_DEFAULT) = 0;
+
+            /**@brief: TLB friendly alignment for a buffer of bytes*/
+            virtual size_t alignment(size_t bytes) const = 0;
+    };
+
+    /**
+     * @brief default allocator, posix_memalign with the placement policy applied to the large buffers.
+     */
+    class PolicyAllocator : public Allocator
+    {
+        protected:
+            /**@brief: MEM_POLICY flags*/
+            unsigned int m_uiPolicy;
+
+            /**@brief: buffers smaller than this (bytes) use the default alignment and no placement policy*/
+            size_t m_uiThreshold;
+
+        public:
+            PolicyAllocator(unsigned int policy, size_t threshold = DENDRO_MEM_HUGE_THRESHOLD);
+
+            ~PolicyAllocator(){};
+
+            void* allocate(size_t bytes, size_t align=0, unsigned int flags=MEM_ALLOC_DEFAULT);
+
+            void deallocate(void* p, size_t bytes);
+
+            void advise(void* p, size_t bytes, unsigned int flags=MEM_ALLOC_DEFAULT);
+
+            size_t alignment(size_t bytes) const;
+
+            /**@brief: sets the placement policy (MEM_POLICY flags)*/
+            inline void set_policy(unsigned int policy) { m_uiPolicy = policy; }
+
+            /**@brief: placement policy*/
+            inline unsigned int get_policy() const { return m_uiPolicy; }
+
+            /**@brief: huge page threshold (bytes)*/
+            inline size_t get_threshold() const { return m_uiThreshold; }
+    };
+
+    /**@brief: allocator used by the mesh vectors, DVector, FieldSet and memory_pool*/
+    Allocator* get_allocator();
+
+    /**@brief: replaces the allocator (not owned, NULL restores the default). Should be called before any allocation, memory is
+     * released with the allocator that allocated it. */
+    void set_allocator(Allocator* alloc);
+
+    /**@brief: default allocator, the policy is set with the DENDRO_MEM_THP and DENDRO_MEM_NUMA_LOCAL build options*/
+    PolicyAllocator* get_default_allocator();
+
+    /**@brief: true if transparent huge pages are enabled (always or madvise)*/
+    bool is_thp_enabled();
+
+    /**@brief: NUMA node of the cpu running the calling thread (0 if unknown)*/
+    int get_numa_node();
+
+    /**@brief: prefers the local NUMA node for the future allocations of the calling thread (set_mempolicy), returns 0 on success*/
+    int set_thread_local_policy();
+
+    /**@brief: allocates n entries of T (T should be trivially constructible, entries are not initialized), flags : MEM_ALLOC_FLAGS*/
+    template<typename T>
+    inline T* alloc(size_t n, size_t align=0, unsigned int flags=MEM_ALLOC_DEFAULT)
+    {
+        return (T*) get_allocator()->allocate(n*sizeof(T), align, flags);
+    }
+
+    /**@brief: releases memory from alloc, n is the allocated number of entries*/
+    template<typename T>
+    inline void dealloc(T* p, size_t n)
+    {
+        if(p!=NULL)
+            get_allocator()->deallocate((void*)p, n*sizeof(T));
+    }
+
+    /**@brief: applies the placement policy to [p, p+bytes) (not touched yet)*/
+    inline void advise(void* p, size_t bytes)
+    {
+        if(p!=NULL)
+            get_allocator()->advise(p, bytes);
+    }
+
+    /**@brief: TLB friendly alignment of a buffer of bytes*/
+    inline size_t tlb_alignment(size_t bytes)
+    {
+        return get_allocator()->alignment(bytes);
+    }
+
+}// end of namespace mem
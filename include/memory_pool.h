@@ -29,54 +29,152 @@
 
 
 #include <vector>
+#include <cstddef>
+#include <omp.h>
+#include "memAlloc.h"
 
-struct mem_blk {
-public:
-  unsigned int  size;
-  bool          free;
-  double*       data;
-  
-  mem_blk(unsigned int sz) {
-    size = sz;
-    free = true;
-    data = NULL;
-  }
-  
-  ~mem_blk() {
-    if (data != NULL) { 
-      delete [] data;
-      data = NULL;
-    }
-  }
-}; 
+// number of size classes, class c has the size (4 + c%4) * 2^(c/4) bytes (4 classes per power of two).
+#define MEM_POOL_NUM_CLASSES 256
+
+// default max. number of free blocks per size class in a thread cache, the rest goes to the shared free lists. A rhs call holds
+// all its scratch blocks (same size class) at once, ~210 for MassGrav and ~590 for QuadGrav, the cap has to be above that.
+#ifndef MEM_POOL_TCACHE_SZ
+  #define MEM_POOL_TCACHE_SZ 1024
+#endif
+
+/**
+ * @brief statistics of a memory_pool. Sizes are in bytes (size classes, i.e. padded sizes).
+ */
+struct mem_pool_stats {
+  /** number of allocate calls */
+  unsigned long allocs;
+  /** allocate calls served from a free list (thread cache or shared) */
+  unsigned long hits;
+  /** number of free calls */
+  unsigned long frees;
+  /** allocate and free calls that went through the shared free lists (critical section) */
+  unsigned long shared;
+  /** bytes handed out and not freed */
+  unsigned long used;
+  /** bytes held by the pool (used + cached) */
+  unsigned long reserved;
+  /** max. of used */
+  unsigned long high_water;
+  /** max. of reserved */
+  unsigned long high_water_reserved;
+
+  /** fraction of the allocations served without a new allocation */
+  inline double hit_rate() const { return (allocs) ? (double)hits/(double)allocs : 0.0; }
+};
 
+/**
+ * @brief size class memory pool with thread local free lists. Requests are padded to the alignment and rounded up to the size
+ * class, freed blocks go to the free list of the calling (OpenMP) thread and the overflow to the shared free lists of the class.
+ * The memory comes from the mem:: allocator. Blocks are released to the allocator only by purge (e.g. on remesh, when the
+ * block sizes change) or by the destructor.
+ */
 class memory_pool
 {
 private:
+  /** per thread free lists and counters (padded to avoid false sharing) */
+  struct thread_cache {
+    std::vector<void*>  blocks[MEM_POOL_NUM_CLASSES];
+    unsigned long       allocs;
+    unsigned long       hits;
+    unsigned long       frees;
+    unsigned long       shared;
+    char                pad[64];
+  };
+
+  /** bytes handed out and not freed */
   unsigned long                       m_ulCount;
+
+  /** bytes held by the pool */
+  unsigned long                       m_ulReserved;
+
+  /** high water marks of m_ulCount and m_ulReserved */
+  unsigned long                       m_ulHighWater;
+  unsigned long                       m_ulHighWaterReserved;
   
+  /** alignment of the returned blocks (power of 2, at least DENDRO_MEM_ALIGN), also the size of the block header */
   unsigned int                        m_uiAlignment;
-  unsigned int                        m_uiPadding;
-  
-  // for the entries ...
-  // need, address, size, is_available. 
-  std::vector<mem_blk>                m_vecBlocks; 
+
+  /** max. number of free blocks per size class in a thread cache */
+  unsigned int                        m_uiTCacheSz;
   
+  /** thread caches (indexed by omp_get_thread_num at the outer level) */
+  std::vector<thread_cache>           m_vecThreadCache;
+
+  /** shared free lists of each size class */
+  std::vector<void*>                  m_vecBlocks[MEM_POOL_NUM_CLASSES];
+
+  /** counters of the calls that do not use a thread cache */
+  thread_cache                        m_sharedCounters;
+
+  /** size class of a request, csz is set to the class size */
+  unsigned int size_class(size_t bytes, size_t& csz) const;
+
+  /** size of the class c */
+  static size_t class_size(unsigned int c);
+
+  /** thread cache of the calling thread, NULL if the calling thread cannot use a cache (e.g. nested parallel regions) */
+  thread_cache* get_thread_cache();
+
+  void update_used(long bytes);
+
+  void update_reserved(long bytes);
   
 public:
-  memory_pool(unsigned int pad = 3, unsigned int align = 32);
+  /**
+   * @brief creates a pool
+   * @param align : alignment of the blocks (rounded up to a power of 2, at least DENDRO_MEM_ALIGN)
+   * @param numThreads : number of thread caches (0 : omp_get_max_threads())
+   * @param tcacheSz : max. number of free blocks per size class in a thread cache
+   */
+  memory_pool(unsigned int align = DENDRO_MEM_ALIGN, unsigned int numThreads = 0, unsigned int tcacheSz = MEM_POOL_TCACHE_SZ);
   
   ~memory_pool();
+
+  memory_pool(const memory_pool&) = delete;
+  memory_pool& operator=(const memory_pool&) = delete;
   
-  // basic ops. block based only. of size (sz +2*pad)^3 
-  double* allocate(unsigned int sz);
-  void    free(double* buf);
+  /** allocates at least bytes (aligned to the pool alignment), thread safe */
+  void*   allocate(size_t bytes);
+
+  /** returns a block from allocate to the pool, thread safe */
+  void    free(void* buf);
+
+  /** allocates n entries of T (not initialized) */
+  template<typename T>
+  inline T* allocate_n(size_t n) { return (T*) allocate(n*sizeof(T)); }
   
-  // how much memory is currently used by the pool
+  /** how much memory is currently used (handed out) from the pool */
   unsigned long used();
+
+  /** statistics of the pool */
+  mem_pool_stats get_stats();
+
+  /** resets the counters and the high water marks */
+  void reset_stats();
   
-  // delete all allocated blocks.
+  /** releases all the free (cached) blocks, should be called outside of the parallel regions (e.g. on remesh). */
   void purge();
+
+  /** alignment of the blocks */
+  inline unsigned int get_alignment() const { return m_uiAlignment; }
+
+  /** max. number of free blocks per size class in a thread cache */
+  inline unsigned int get_tcache_size() const { return m_uiTCacheSz; }
+
+  /** sets the thread cache cap (e.g. to the number of scratch blocks of a rhs call), should be called outside of the parallel
+   * regions. Cached blocks above a smaller cap stay in the caches until purge. */
+  inline void set_tcache_size(unsigned int sz) { m_uiTCacheSz = sz; }
 };
 
+namespace mem
+{
+  /** process wide pool for the short lived buffers (rhs scratch, ghost exchange buffers, block async vectors) */
+  memory_pool* get_pool();
+}
+
 #endif // MEMORY_POOL_H
@@ -31,6 +31,7 @@
 #include "testUtils.h"
 
 #include <memory>
+#include <type_traits>
 #include <fdCoefficient.h>
 #include "refel.h"
 #include "block.h"
@@ -40,6 +41,7 @@
 #include "node.h"
 #include "dendro.h"
 #include "asyncExchangeContex.h"
+#include "memAlloc.h"
 
 #include "wavelet.h"
 #include "dendroProfileParams.h" // only need to profile unzip_asyn for bssn. remove this header file later.
@@ -107,6 +109,39 @@ enum NeighbourLevel
 #define OCT_SPLIT 1u
 #define OCT_COARSE 2u
 
+#ifndef DENDRO_SHM_GHOST_NUM_SLOTS
+    // number of ring units (one unit = on node send nodes of one double variable) of the shared memory ghost exchange.
+    #define DENDRO_SHM_GHOST_NUM_SLOTS 32u
+#endif
+
+#ifndef DENDRO_MESH_STACK_NPE
+    // max. nodes per element (order 8, 3D) for the per element scratch kept on the stack, larger orders use the heap.
+    #define DENDRO_MESH_STACK_NPE 729u
+#endif
+
+/**
+ * @brief dispatches a mesh kernel templated on the element order (template<unsigned int pOrder,...>). If the mesh is built with
+ * DENDRO_ELE_ORDER_SPECIALIZATION, element orders 2-8 (3D) use the compile time specialized kernel, otherwise the generic kernel
+ * (pOrder=0) which reads the element order at runtime. Note that the current m_uiElementOrder is used since the mesh construction
+ * temporarily changes the element order.
+ * */
+#ifdef DENDRO_ELE_ORDER_SPECIALIZATION
+    #define DENDRO_MESH_ELE_ORDER_DISPATCH(kernel, ...)                      \
+        switch( (m_uiDim==3) ? m_uiElementOrder : 0u )                      \
+        {                                                                   \
+            case 2: return kernel<2>(__VA_ARGS__);                          \
+            case 3: return kernel<3>(__VA_ARGS__);                          \
+            case 4: return kernel<4>(__VA_ARGS__);                          \
+            case 5: return kernel<5>(__VA_ARGS__);                          \
+            case 6: return kernel<6>(__VA_ARGS__);                          \
+            case 7: return kernel<7>(__VA_ARGS__);                          \
+            case 8: return kernel<8>(__VA_ARGS__);                          \
+            default: return kernel<0>(__VA_ARGS__);                         \
+        }
+#else
+    #define DENDRO_MESH_ELE_ORDER_DISPATCH(kernel, ...) return kernel<0>(__VA_ARGS__);
+#endif
+
 namespace ot
 {
 
@@ -214,13 +249,13 @@ private:
 
     // Keys Related attributes
     /**search keys generated for local elements. */
-    std::vector<Key> m_uiKeys;
+    ot::KeyCSR m_uiKeys;
 
     /**search keys generated for ghost elements*/
-    std::vector<Key> m_uiGhostKeys;
+    ot::KeyCSR m_uiGhostKeys;
 
     /**search keys generated for missing diagonal elements in the ghost*/
-    std::vector<Key> m_uiKeysDiag;
+    ot::KeyCSR m_uiKeysDiag;
 
     /**input to the mesh generation (will be freed after use)*/
     std::vector<ot::TreeNode> m_uiEmbeddedOctree;
@@ -238,6 +273,8 @@ private:
 
     /** stores all the pre + local + post ELEMENTS. */
     std::vector<ot::TreeNode> m_uiAllElements;
+    /** SFC keys of m_uiAllElements for the batched key searches, only kept during the mesh construction. */
+    std::vector<uint128_t> m_uiAllElementKeys;
     /** stores the local nodes */
     std::vector<ot::TreeNode> m_uiAllLocalNode;
 
@@ -486,6 +523,41 @@ private:
     /**@brief: communicator tag used for async communication*/
     unsigned int m_uiCommTag=0;
 
+    // ===== node local (MPI-3 shared window) ghost exchange, used if built with DENDRO_SHM_GHOST_EXCHANGE.
+
+    /**@brief: true if the shared memory ghost exchange is setup*/
+    bool m_uiIsShmSetup=false;
+
+    /**@brief: node local communicator (split from the active comm.)*/
+    MPI_Comm m_uiCommNodeShm=MPI_COMM_NULL;
+
+    /**@brief: shared window storing the on node send ring of each rank*/
+    MPI_Win m_uiShmWin=MPI_WIN_NULL;
+
+    /**@brief: base of the local send ring*/
+    char* m_uiShmBase=NULL;
+
+    /**@brief: rank in m_uiCommNodeShm for each active rank (MPI_UNDEFINED if not on the same node)*/
+    std::vector<int> m_uiShmNodeRank;
+
+    /**@brief: number of on node send nodes (one ring unit is m_uiShmSendTotal doubles)*/
+    unsigned int m_uiShmSendTotal=0;
+
+    /**@brief: offset (in nodes) of each on node receiver in a ring unit*/
+    std::vector<unsigned int> m_uiShmSendOffset;
+
+    /**@brief: for each on node sender, base of its send ring, its ring unit size (bytes) and the offset of this rank in it*/
+    std::vector<const char*> m_uiShmRecvBase;
+    std::vector<size_t> m_uiShmRecvUnitBytes;
+    std::vector<unsigned int> m_uiShmRecvOffset;
+
+    /**@brief: next ring unit and the shared memory exchange sequence number*/
+    unsigned int m_uiShmRingPos=0;
+    unsigned int m_uiShmSeq=0;
+
+    /**@brief: in-flight exchanges using the ring*/
+    std::vector<ShmRingSlot> m_uiShmSlots;
+
     /**bool vector for elementy ID, of size m_uiAllElements*/
     std::vector<bool> m_uiIsNodalMapValid;
 
@@ -540,6 +612,12 @@ private:
 
     void generateSearchKeys();
 
+    /**
+     * @brief computes the SFC keys of m_uiAllElements (m_uiAllElementKeys), should be called whenever m_uiAllElements changes
+     * during the construction.
+     * */
+    void computeAllElementKeys();
+
     /**
      * @author Milinda Fernando
      * @brief generates search keys for ghost elements, inorder to build the E2E mapping between ghost elements.
@@ -1023,6 +1101,50 @@ private:
 
     // --- 3rd point exchange function end.
 
+    // --- element order specialized kernels. (pOrder=0 denotes the generic version, see DENDRO_MESH_ELE_ORDER_DISPATCH)
+
+    /**@brief element order specialized version of computeOveralppingNodes*/
+    template<unsigned int pOrder>
+    inline bool computeOveralppingNodes_p(const ot::TreeNode &parent, const ot::TreeNode &child, int *idx, int *idy, int *idz);
+
+    /**@brief element order specialized version of unzip*/
+    template<unsigned int pOrder, typename T>
+    void unzip_p(const T* zippedVec, T* unzippedVec, const unsigned int *blkIDs, unsigned int numblks);
+
+    /**@brief element order specialized version of zip*/
+    template<unsigned int pOrder, typename T>
+    void zip_p(const T *unzippedVec, T *zippedVec);
+
+    /**@brief element order specialized version of zip (for specified blocks)*/
+    template<unsigned int pOrder, typename T>
+    void zip_p(const T *unzippedVec, T *zippedVec, const unsigned int *blkIDs, unsigned int numblks, unsigned int ll);
+
+    /**@brief element order specialized version of getElementNodalValues*/
+    template<unsigned int pOrder, typename T>
+    void getElementNodalValues_p(const T *vec, T *nodalValues, unsigned int elementID, bool isDGVec=false) const;
+
+    /**@brief: creates the node local communicator and the shared send ring window (collective on the active comm.)*/
+    void setupShmGhostExchange();
+
+    /**@brief: frees the shared send ring window and the node local communicator*/
+    void freeShmGhostExchange();
+
+    /**
+     * @brief: reserves ring units for a ghost exchange. Returns false (use the MPI path) if the shared memory exchange is disabled, 
+     * the exchange does not fit in the ring or the ring units are still used by an exchange that is not ended. The decision only 
+     * depends on the order of the ghost exchange calls, hence it is the same on all the ranks. 
+     * @param[in] units: number of ring units needed
+     * @param[out] unit: first ring unit
+     * @param[out] seq: exchange sequence number
+     */
+    bool acquireShmRingSlot(unsigned int units, unsigned int& unit, unsigned int& seq);
+
+    /**@brief: acknowledges the on node senders that the ring data is read, and marks the exchange seq as ended.*/
+    void releaseShmRingSlot(unsigned int seq);
+
+    /**@brief: true if the active rank proc shares the node with this rank and the exchange is done through the shared ring*/
+    inline bool isShmNeighbour(unsigned int proc) const { return (m_uiIsShmSetup && m_uiShmNodeRank[proc]!=MPI_UNDEFINED); }
+
 public:
     /**@brief parallel mesh constructor
      * @param[in] in: complete sorted 2:1 balanced octree to generate mesh
@@ -1041,8 +1163,10 @@ public:
      * @param[in] grainSz: prefered grain sz. (this parameter is used to perform automatic comm expansion and shrinking)
      * @param[in] ld_tol: load imbalance tolerance for comm expansion and shrinking
      * @param[in] sf_k: splitter fix _k value. (Needed by SFC_partitioinng for large p>=10,000)
+     * @param[in] getWeight: octant weight function for the partition
+     * @param[in] getConstraint: octant level constraint for the multi-constraint partition (overrides getWeight if not NULL)
      * */
-    Mesh(std::vector<ot::TreeNode> &in, unsigned int k_s, unsigned int pOrder, MPI_Comm comm, bool pBlockSetup = true, SM_TYPE smType = SM_TYPE::FDM, unsigned int grainSz = DENDRO_DEFAULT_GRAIN_SZ, double ld_tol = DENDRO_DEFAULT_LB_TOL, unsigned int sf_k = DENDRO_DEFAULT_SF_K, unsigned int (*getWeight)(const ot::TreeNode *)=NULL , unsigned int coarsetBLkLev = 0);
+    Mesh(std::vector<ot::TreeNode> &in, unsigned int k_s, unsigned int pOrder, MPI_Comm comm, bool pBlockSetup = true, SM_TYPE smType = SM_TYPE::FDM, unsigned int grainSz = DENDRO_DEFAULT_GRAIN_SZ, double ld_tol = DENDRO_DEFAULT_LB_TOL, unsigned int sf_k = DENDRO_DEFAULT_SF_K, unsigned int (*getWeight)(const ot::TreeNode *)=NULL , unsigned int coarsetBLkLev = 0, unsigned int (*getConstraint)(const ot::TreeNode *)=NULL);
 
     /**@brief destructor for mesh (releases the allocated variables in the class. )*/
     ~Mesh();
@@ -1144,6 +1268,9 @@ public:
     /**@brief returns const list of local blocks (regular grids) for the consdering mesh. */
     inline const std::vector<ot::Block> &getLocalBlockList() const { return m_uiLocalBlockList; }
 
+    /**@brief returns the local element to block map, (indexed by the local element id, i.e. e - getElementLocalBegin()). */
+    inline const std::vector<unsigned int> &getE2BlkMap() const { return m_uiE2BlkMap; }
+
     /**@brief return the number of directions in the E2E mapping. */
     inline unsigned int getNumDirections() const { return m_uiNumDirections; }
 
@@ -1302,6 +1429,15 @@ public:
      */
     void getElementQMat(unsigned int currentId, double *&qMat, bool isAllocated = true) const;
 
+    /**
+     * @brief : Applies the transpose of the elemental interpolation matrix (see getElementQMat) without forming it. 
+     * Hanging faces and edges are applied as sum factorized 1D interpolations, hence the cost is O(p^3) instead of O(p^6). 
+     * @param[in] currentId: Element ID. 
+     * @param[in] in: elemental input vector (size of nPe)
+     * @param[out] out: Q^T in (size of nPe)
+     */
+    void applyElementQTMat(unsigned int currentId, const double* in, double* out) const;
+
 
     /**
      * @brief Get the elemental nodal values using unzip representation of the array. 
@@ -1481,7 +1617,8 @@ public:
     inline const ot::TreeNode *getNodalSplitterNodes() const { return m_uiSplitterNodes; }
 
     // Methods needed for PDE & ODE and other solvers.
-    /**@brief allocate memory for variable array based on the adaptive mesh*/
+    /**@brief allocate memory for variable array based on the adaptive mesh. Vectors are allocated with new [] (released with delete [])
+     * and large vectors get the placement policy of the mem:: allocator (huge pages, NUMA node) before the first touch. */
     template <typename T>
     T* createVector() const;
 
@@ -1762,6 +1899,14 @@ public:
     template<typename T>
     void readFromGhostEnd(T* vec, unsigned int dof =1);    
 
+    /**
+     * @brief: returns true if the ghost exchange of vec (started with readFromGhostBegin) is completed. Non blocking (MPI_Test), 
+     * readFromGhostEnd should still be called to unpack the ghost values. 
+     * @param vec : vector of the ghost exchange
+     */
+    template<typename T>
+    bool isGhostReadComplete(const T* vec);
+
     /**
      * @brief : ghost read begin. 
      * 
@@ -1889,8 +2034,10 @@ public:
      * @param[in] ld_tol: tolerance value used for flexible partitioning
      * @param[in] sfK: spliiter fix parameter (need to specify larger value when run in super large scale)
      * @param[in] getWeight: function pointer which returns a uint weight values for an given octant
+     * @param[in] getConstraint: function pointer which returns the constraint (e.g. time level) of an octant. If not NULL
+     * each constraint is partitioned separately (par::partitionWMC) and getWeight is ignored. 
      * */
-    ot::Mesh *ReMesh(unsigned int grainSz = DENDRO_DEFAULT_GRAIN_SZ, double ld_tol = DENDRO_DEFAULT_LB_TOL, unsigned int sfK = DENDRO_DEFAULT_SF_K,unsigned int (*getWeight)(const ot::TreeNode *)=NULL);
+    ot::Mesh *ReMesh(unsigned int grainSz = DENDRO_DEFAULT_GRAIN_SZ, double ld_tol = DENDRO_DEFAULT_LB_TOL, unsigned int sfK = DENDRO_DEFAULT_SF_K,unsigned int (*getWeight)(const ot::TreeNode *)=NULL,unsigned int (*getConstraint)(const ot::TreeNode *)=NULL);
 
     /**
      * @brief transfer a variable vector form old grid to new grid.
@@ -1933,6 +2080,17 @@ public:
     template<typename T>
     void interGridTransferUnzip(T*& unzip, T*& vec, const ot::Mesh *pMesh);
 
+    /**
+     * @brief unzip based intergrid transfer without deallocating the existing vector.
+     * @tparam T : data type of the vectors
+     * @param unzip : unzip representation of the vector (old mesh).
+     * @param vec : zip representation of the vector (old mesh).
+     * @param vecOut : transfered vector, allocated with ghost on the new mesh.
+     * @param pMesh : new mesh.
+     */
+    template<typename T>
+    void interGridTransferUnzip(const T* unzip, const T* vec, T* vecOut, const ot::Mesh *pMesh);
+
     /**
     *@brief : Returns the nodal values of a given element for a given variable vector.
     *@param[in] vec: variable vector that we want to get the nodal values.
@@ -2141,19 +2299,27 @@ inline void Mesh::child2ParentInterpolation(const double *in, double *out, unsig
 
 inline bool Mesh::computeOveralppingNodes(const ot::TreeNode &parent, const ot::TreeNode &child, int *idx, int *idy, int *idz)
 {
+    DENDRO_MESH_ELE_ORDER_DISPATCH(this->computeOveralppingNodes_p,parent,child,idx,idy,idz);
+}
+
+template<unsigned int pOrder>
+inline bool Mesh::computeOveralppingNodes_p(const ot::TreeNode &parent, const ot::TreeNode &child, int *idx, int *idy, int *idz)
+{
+    const unsigned int eleOrder = (pOrder!=0) ? pOrder : m_uiElementOrder;
+
 
     unsigned int Lp = 1u << (m_uiMaxDepth - parent.getLevel());
     unsigned int Lc = 1u << (m_uiMaxDepth - child.getLevel());
     //intilize the mapping to -1. -1 denotes that mapping is not defined for given k value.
 
     unsigned int dp, dc;
-    dp = (m_uiElementOrder);
-    dc = m_uiElementOrder;
+    dp = (eleOrder);
+    dc = eleOrder;
 
     assert(Lp % dp == 0);
     assert(Lc % dc == 0);
 
-    for (unsigned int k = 0; k < (m_uiElementOrder + 1); k++)
+    for (unsigned int k = 0; k < (eleOrder + 1); k++)
     {
         idx[k] = -1;
         idy[k] = -1;
@@ -2165,7 +2331,7 @@ inline bool Mesh::computeOveralppingNodes(const ot::TreeNode &parent, const ot::
     bool stateZ = false;
     if (parent == child)
     {
-        for (unsigned int k = 0; k < (m_uiElementOrder + 1); k++)
+        for (unsigned int k = 0; k < (eleOrder + 1); k++)
         {
             idx[k] = k;
             idy[k] = k;
@@ -2176,46 +2342,46 @@ inline bool Mesh::computeOveralppingNodes(const ot::TreeNode &parent, const ot::
     else if (parent.isAncestor(child))
     {
 
-        /*if((((child.getX()-parent.getX())*m_uiElementOrder)%Lp) || (((child.getY()-parent.getY())*m_uiElementOrder)%Lp) || (((child.getZ()-parent.getZ())*m_uiElementOrder)%Lp)) return false;
+        /*if((((child.getX()-parent.getX())*eleOrder)%Lp) || (((child.getY()-parent.getY())*eleOrder)%Lp) || (((child.getZ()-parent.getZ())*eleOrder)%Lp)) return false;
             else*/
         {
             unsigned int index[3];
-            for (unsigned int k = 0; k < (m_uiElementOrder + 1); k++)
+            for (unsigned int k = 0; k < (eleOrder + 1); k++)
             {
 
-                index[0] = (m_uiElementOrder + 1);
-                index[1] = (m_uiElementOrder + 1);
-                index[2] = (m_uiElementOrder + 1);
+                index[0] = (eleOrder + 1);
+                index[1] = (eleOrder + 1);
+                index[2] = (eleOrder + 1);
 
                 if (!(((child.getX() - parent.getX()) * dp * dc + k * Lc * dp) % (Lp * dc)))
-                    index[0] = ((child.getX() - parent.getX()) * dp * dc + k * Lc * dp) / (Lp * dc); //((child.getX()-parent.getX())*m_uiElementOrder + k*Lc)/Lp;
+                    index[0] = ((child.getX() - parent.getX()) * dp * dc + k * Lc * dp) / (Lp * dc); //((child.getX()-parent.getX())*eleOrder + k*Lc)/Lp;
 
                 if (!(((child.getY() - parent.getY()) * dp * dc + k * Lc * dp) % (Lp * dc)))
-                    index[1] = ((child.getY() - parent.getY()) * dp * dc + k * Lc * dp) / (Lp * dc); //((child.getY()-parent.getY())*m_uiElementOrder + k*Lc)/Lp;
+                    index[1] = ((child.getY() - parent.getY()) * dp * dc + k * Lc * dp) / (Lp * dc); //((child.getY()-parent.getY())*eleOrder + k*Lc)/Lp;
 
                 if (!(((child.getZ() - parent.getZ()) * dp * dc + k * Lc * dp) % (Lp * dc)))
-                    index[2] = ((child.getZ() - parent.getZ()) * dp * dc + k * Lc * dp) / (Lp * dc); //((child.getZ()-parent.getZ())*m_uiElementOrder + k*Lc)/Lp;
+                    index[2] = ((child.getZ() - parent.getZ()) * dp * dc + k * Lc * dp) / (Lp * dc); //((child.getZ()-parent.getZ())*eleOrder + k*Lc)/Lp;
 
-                if (!stateX && index[0] < (m_uiElementOrder + 1))
+                if (!stateX && index[0] < (eleOrder + 1))
                     stateX = true;
 
-                if (!stateY && index[1] < (m_uiElementOrder + 1))
+                if (!stateY && index[1] < (eleOrder + 1))
                     stateY = true;
 
-                if (!stateZ && index[2] < (m_uiElementOrder + 1))
+                if (!stateZ && index[2] < (eleOrder + 1))
                     stateZ = true;
 
-                if (index[0] < (m_uiElementOrder + 1))
+                if (index[0] < (eleOrder + 1))
                 {
                     idx[k] = index[0];
                     assert((parent.getX() + idx[k] * Lp / dp) == (child.getX() + k * Lc / dc));
                 }
-                if (index[1] < (m_uiElementOrder + 1))
+                if (index[1] < (eleOrder + 1))
                 {
                     idy[k] = index[1];
                     assert((parent.getY() + idy[k] * Lp / dp) == (child.getY() + k * Lc / dc));
                 }
-                if (index[2] < (m_uiElementOrder + 1))
+                if (index[2] < (eleOrder + 1))
                 {
                     idz[k] = index[2];
                     assert((parent.getZ() + idz[k] * Lp / dp) == (child.getZ() + k * Lc / dc));
@@ -18,6 +18,7 @@ namespace ot
         if(!m_uiIsActive) return NULL;
 
         T* vec=new T[m_uiNumActualNodes];
+        mem::advise(vec,sizeof(T)*m_uiNumActualNodes);
         
         return vec;
 
@@ -29,6 +30,7 @@ namespace ot
         if(!m_uiIsActive) return NULL;
 
         T* vec=new T[m_uiNumActualNodes*dof];
+        mem::advise(vec,sizeof(T)*m_uiNumActualNodes*dof);
 
         for(unsigned int i=0; i < m_uiNumActualNodes*dof; i++)
             vec[i] = initVal;
@@ -55,6 +57,7 @@ namespace ot
     {
         if(!m_uiIsActive) return NULL;
         T* vec=new T[m_uiNumTotalElements*m_uiNpE*dof];
+        mem::advise(vec,sizeof(T)*m_uiNumTotalElements*m_uiNpE*dof);
 
          for(unsigned int i=0; i < m_uiNumTotalElements*m_uiNpE*dof; i++)
             vec[i] = initVal;
@@ -68,6 +71,7 @@ namespace ot
         if(!m_uiIsActive) return NULL;
 
         T* vec=new T[m_uiNumActualNodes];
+        mem::advise(vec,sizeof(T)*m_uiNumActualNodes);
 
         for(unsigned int k=0;k<m_uiNumActualNodes;k++)
             vec[k]=initValue;
@@ -81,6 +85,7 @@ namespace ot
         if(!m_uiIsActive) return NULL;
 
         T* vec=new T[m_uiNumActualNodes];
+        mem::advise(vec,sizeof(T)*m_uiNumActualNodes);
 
         unsigned int nodeLookUp_CG;
         unsigned int nodeLookUp_DG;
@@ -192,6 +197,7 @@ namespace ot
         if(!m_uiIsActive) return NULL;
 
         T* uvec=new T[m_uiUnZippedVecSz];
+        mem::advise(uvec,sizeof(T)*m_uiUnZippedVecSz);
         return uvec;
     }
 
@@ -201,6 +207,7 @@ namespace ot
         if(!m_uiIsActive) return NULL;
 
         T* uvec=new T[m_uiUnZippedVecSz];
+        mem::advise(uvec,sizeof(T)*m_uiUnZippedVecSz);
 
         for(unsigned int k=0;k<(m_uiUnZippedVecSz);k++)
             uvec[k]=initValue;
@@ -508,6 +515,12 @@ namespace ot
             AsyncExchangeContex ctx(vec);
             MPI_Comm commActive=this->getMPICommunicator();
 
+            // on node neighbours are exchanged through the shared send ring (if enabled and the ring has space).
+            const unsigned int shmUnits=(dof*sizeof(T) + sizeof(double)-1)/sizeof(double);
+            unsigned int shmUnit=0, shmSeq=0;
+            const bool isShm=this->acquireShmRingSlot(shmUnits,shmUnit,shmSeq);
+            if(isShm)
+                ctx.setShmSlot(shmSeq,shmUnit);
 
             if(recvBSz)
             {
@@ -519,7 +532,10 @@ namespace ot
                 {
                     proc_id=recvProcList[recv_p];
                     MPI_Request* req=new MPI_Request();
-                    par::Mpi_Irecv((recvB+dof*nodeRecvOffset[proc_id]),dof*nodeRecvCount[proc_id],proc_id,m_uiCommTag,commActive,req);
+                    if(isShm && this->isShmNeighbour(proc_id))
+                        MPI_Irecv(NULL,0,MPI_BYTE,m_uiShmNodeRank[proc_id],2*shmSeq,m_uiCommNodeShm,req); // data ready notification.
+                    else
+                        par::Mpi_Irecv((recvB+dof*nodeRecvOffset[proc_id]),dof*nodeRecvCount[proc_id],proc_id,m_uiCommTag,commActive,req);
                     ctx.getRequestList().push_back(req);
 
                 }
@@ -531,14 +547,19 @@ namespace ot
                 ctx.allocateSendBuffer(sizeof(T)*dof*sendBSz);
                 sendB=(T*)ctx.getSendBuffer();
 
+                T* shmB = (isShm) ? (T*)(m_uiShmBase + (size_t)shmUnit*m_uiShmSendTotal*sizeof(double)) : NULL;
+
                 for(unsigned int send_p=0;send_p<sendProcList.size();send_p++) {
                     proc_id=sendProcList[send_p];
 
+                    // on node receivers read directly from the shared ring.
+                    T* packB = (isShm && this->isShmNeighbour(proc_id)) ? (shmB + dof*m_uiShmSendOffset[proc_id]) : (sendB + dof*nodeSendOffset[proc_id]);
+
                     for(unsigned int var=0;var<dof;var++)
                     {
                         for (unsigned int k = nodeSendOffset[proc_id]; k < (nodeSendOffset[proc_id] + nodeSendCount[proc_id]); k++)
                         {
-                            sendB[dof*(nodeSendOffset[proc_id]) + (var*nodeSendCount[proc_id])+(k-nodeSendOffset[proc_id])] = (vec+var*m_uiNumActualNodes)[sendNodeSM[k]];
+                            packB[(var*nodeSendCount[proc_id])+(k-nodeSendOffset[proc_id])] = (vec+var*m_uiNumActualNodes)[sendNodeSM[k]];
                         }
 
                     }
@@ -547,12 +568,18 @@ namespace ot
 
                 }
 
+                if(isShm)
+                    MPI_Win_sync(m_uiShmWin);
+
                 // active send procs
                 for(unsigned int send_p=0;send_p<sendProcList.size();send_p++)
                 {
                     proc_id=sendProcList[send_p];
                     MPI_Request * req=new MPI_Request();
-                    par::Mpi_Isend(sendB+dof*nodeSendOffset[proc_id],dof*nodeSendCount[proc_id],proc_id,m_uiCommTag,commActive,req);
+                    if(isShm && this->isShmNeighbour(proc_id))
+                        MPI_Isend(NULL,0,MPI_BYTE,m_uiShmNodeRank[proc_id],2*shmSeq,m_uiCommNodeShm,req);
+                    else
+                        par::Mpi_Isend(sendB+dof*nodeSendOffset[proc_id],dof*nodeSendCount[proc_id],proc_id,m_uiCommTag,commActive,req);
                     ctx.getRequestList().push_back(req);
 
                 }
@@ -617,6 +644,10 @@ namespace ot
                 MPI_Wait(m_uiMPIContexts[ctxIndex].getRequestList()[i], &status);
             }
 
+            const bool isShm=m_uiMPIContexts[ctxIndex].isShm();
+            if(isShm)
+                MPI_Win_sync(m_uiShmWin);
+
             if(recvBSz)
             {
                 // copy the recv data to the vec
@@ -625,11 +656,14 @@ namespace ot
                 for(unsigned int recv_p=0;recv_p<recvProcList.size();recv_p++){
                     proc_id=recvProcList[recv_p];
 
+                    // on node senders: read from their shared ring.
+                    const T* unpackB = (isShm && this->isShmNeighbour(proc_id)) ? ((const T*)(m_uiShmRecvBase[proc_id] + (size_t)m_uiMPIContexts[ctxIndex].getShmUnit()*m_uiShmRecvUnitBytes[proc_id]) + dof*m_uiShmRecvOffset[proc_id]) : (recvB + dof*nodeRecvOffset[proc_id]);
+
                     for(unsigned int var=0;var<dof;var++)
                     {
                         for (unsigned int k = nodeRecvOffset[proc_id]; k < (nodeRecvOffset[proc_id] + nodeRecvCount[proc_id]); k++)
                         {
-                            (vec+var*m_uiNumActualNodes)[recvNodeSM[k]]=recvB[dof*(nodeRecvOffset[proc_id]) + (var*nodeRecvCount[proc_id])+(k-nodeRecvOffset[proc_id])];
+                            (vec+var*m_uiNumActualNodes)[recvNodeSM[k]]=unpackB[(var*nodeRecvCount[proc_id])+(k-nodeRecvOffset[proc_id])];
                         }
                     }
 
@@ -637,6 +671,9 @@ namespace ot
 
             }
 
+            if(isShm)
+                this->releaseShmRingSlot(m_uiMPIContexts[ctxIndex].getShmSeq());
+
 
 
             m_uiMPIContexts[ctxIndex].deAllocateSendBuffer();
@@ -656,6 +693,33 @@ namespace ot
         return;
     }
 
+    template<typename T>
+    bool Mesh::isGhostReadComplete(const T* vec)
+    {
+        if(this->getMPICommSizeGlobal()==1 || (!m_uiIsActive))
+            return true;
+
+        for(unsigned int i=0;i<m_uiMPIContexts.size();i++)
+        {
+            if(m_uiMPIContexts[i].getBuffer()==vec)
+            {
+                std::vector<MPI_Request*>& reqList = m_uiMPIContexts[i].getRequestList();
+                int flag;
+                MPI_Status status;
+                for(unsigned int k=0; k < reqList.size(); k++)
+                {
+                    MPI_Test(reqList[k], &flag, &status);
+                    if(!flag)
+                        return false;
+                }
+
+                return true;
+            }
+        }
+
+        return true;
+    }
+
     template<typename T>
     void Mesh::readFromGhostBeginElementVec(T* vec, unsigned int dof)
     {
@@ -865,7 +929,7 @@ namespace ot
                         for (unsigned int k = m_uiSendEleOffset[proc_id]; k < (m_uiSendEleOffset[proc_id] + m_uiSendEleCount[proc_id]); k++)
                         {
                             for(unsigned int node =0; node < m_uiNpE; node++)
-                              sendB[dof*m_uiNpE*(m_uiSendEleOffset[proc_id]) + (var*m_uiNpE*m_uiSendEleCount[proc_id])+ node ] = (vec+var*m_uiNumTotalElements*m_uiNpE)[ (m_uiElementLocalBegin +  m_uiScatterMapElementRound1[k])*m_uiNpE + node];
+                              sendB[dof*m_uiNpE*(m_uiSendEleOffset[proc_id]) + (var*m_uiNpE*m_uiSendEleCount[proc_id]) + (k-m_uiSendEleOffset[proc_id])*m_uiNpE + node ] = (vec+var*m_uiNumTotalElements*m_uiNpE)[ (m_uiElementLocalBegin +  m_uiScatterMapElementRound1[k])*m_uiNpE + node];
                         }
                     }
                 }
@@ -944,7 +1008,7 @@ namespace ot
                     {
                         for (unsigned int k = m_uiRecvEleOffset[proc_id]; k < (m_uiRecvEleOffset[proc_id] + m_uiRecvEleCount[proc_id]); k++)
                             for(unsigned int node =0; node < m_uiNpE; node ++)
-                                (vec+var*m_uiNumTotalElements*m_uiNpE)[m_uiGhostElementRound1Index[k]*m_uiNpE+ node ] = recvB[dof*(m_uiRecvEleOffset[proc_id]) + (var*m_uiNpE*m_uiRecvEleCount[proc_id])+ node];
+                                (vec+var*m_uiNumTotalElements*m_uiNpE)[m_uiGhostElementRound1Index[k]*m_uiNpE+ node ] = recvB[dof*m_uiNpE*(m_uiRecvEleOffset[proc_id]) + (var*m_uiNpE*m_uiRecvEleCount[proc_id]) + (k-m_uiRecvEleOffset[proc_id])*m_uiNpE + node];
                     }
 
                 }
@@ -2454,14 +2518,24 @@ namespace ot
     template<typename T>
     void Mesh::getElementNodalValues(const T* vec,T* nodalValues,unsigned int elementID, bool isDGVec ) const
     {
+        DENDRO_MESH_ELE_ORDER_DISPATCH(this->getElementNodalValues_p,vec,nodalValues,elementID,isDGVec);
+    }
+
+    template<unsigned int pOrder, typename T>
+    void Mesh::getElementNodalValues_p(const T* vec,T* nodalValues,unsigned int elementID, bool isDGVec) const
+    {
+        // compile time element order (if specialized) so that the element loops have constant trip counts.
+        const unsigned int eleOrder = (pOrder!=0) ? pOrder : m_uiElementOrder;
+        const unsigned int nPe = (pOrder!=0) ? (pOrder+1)*(pOrder+1)*(pOrder+1) : m_uiNpE;
+
 
         if(!m_uiIsActive) return;
 
         // handles the element get nodal values if the vec is an element DG vector. 
         if(isDGVec)
         {
-            for(unsigned int node =0; node < m_uiNpE; node++)
-                nodalValues[node] = vec[elementID*m_uiNpE +  node];
+            for(unsigned int node =0; node < nPe; node++)
+                nodalValues[node] = vec[elementID*nPe +  node];
 
             return;
         }
@@ -2470,11 +2544,20 @@ namespace ot
         #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                 dendro::timer::t_unzip_sync_nodalval.start();
         #endif
-        std::vector<T> edgeInpIn;
-        std::vector<T> edgeInpOut;
-
-        std::vector<T> faceInpIn;
-        std::vector<T> faceInpOut;
+        // face and edge work buffers, stack resident if the element order is known at compile time.
+        T faceBufStack[(pOrder!=0) ? 2*(pOrder+1)*(pOrder+1) : 1];
+        T edgeBufStack[(pOrder!=0) ? 2*(pOrder+1) : 1];
+        std::vector<T> bufHeap;
+        T* faceInpIn = faceBufStack;
+        T* edgeInpIn = edgeBufStack;
+        if(pOrder==0)
+        {
+            bufHeap.resize(2*(eleOrder+1)*(eleOrder+1) + 2*(eleOrder+1));
+            faceInpIn = bufHeap.data();
+            edgeInpIn = faceInpIn + 2*(eleOrder+1)*(eleOrder+1);
+        }
+        T* const faceInpOut = faceInpIn + (eleOrder+1)*(eleOrder+1);
+        T* const edgeInpOut = edgeInpIn + (eleOrder+1);
 
         unsigned int cnum;
         bool isHanging;
@@ -2487,17 +2570,12 @@ namespace ot
         for(unsigned int w=0;w<OCT_DIR_TOTAL;w++)
             nodeStatus[w]=false;
 
-        edgeInpIn.resize((m_uiElementOrder+1));
-        edgeInpOut.resize((m_uiElementOrder+1));
-
-        faceInpIn.resize((m_uiElementOrder+1)*(m_uiElementOrder+1));
-        faceInpOut.resize((m_uiElementOrder+1)*(m_uiElementOrder+1));
 
-        for(unsigned int k=1;k<(m_uiElementOrder);k++)
-            for(unsigned int j=1;j<(m_uiElementOrder);j++)
-                for(unsigned int i=1;i<(m_uiElementOrder);i++)
+        for(unsigned int k=1;k<(eleOrder);k++)
+            for(unsigned int j=1;j<(eleOrder);j++)
+                for(unsigned int i=1;i<(eleOrder);i++)
                 {
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]];
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*nPe+k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]];
                     assert(!(this->isNodeHanging(elementID,i,j,k))); // internal nodes cannot be hangging.
                 }
         nodeStatus[OCT_DIR_INTERNAL]=true;
@@ -2510,11 +2588,11 @@ namespace ot
             for (unsigned int index = 0; index < faceIndex.size(); index++)
                 faceInpIn[index] = vec[m_uiE2NMapping_CG[faceIndex[index]]];
 
-            this->parent2ChildInterpolation(&(*(faceInpIn.begin())), &(*(faceInpOut.begin())), cnum, 2);
+            this->parent2ChildInterpolation(faceInpIn, faceInpOut, cnum, 2);
 
-            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+0]=faceInpOut[k*(m_uiElementOrder+1)+j];
+            for(unsigned int k=0;k<(eleOrder+1);k++)
+                for(unsigned int j=0;j<(eleOrder+1);j++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+0]=faceInpOut[k*(eleOrder+1)+j];
 
             nodeStatus[OCT_DIR_LEFT_DOWN]=true;
             nodeStatus[OCT_DIR_LEFT_UP]=true;
@@ -2532,9 +2610,9 @@ namespace ot
         }else
         {
 
-            for(unsigned int k=1;k<m_uiElementOrder;k++)
-                for(unsigned int j=1;j<m_uiElementOrder;j++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+0]];
+            for(unsigned int k=1;k<eleOrder;k++)
+                for(unsigned int j=1;j<eleOrder;j++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*nPe+k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+0]];
         }
 
 
@@ -2545,11 +2623,11 @@ namespace ot
             for (unsigned int index = 0; index < faceIndex.size(); index++)
                 faceInpIn[index] = vec[m_uiE2NMapping_CG[faceIndex[index]]];
 
-            this->parent2ChildInterpolation(&(*(faceInpIn.begin())), &(*(faceInpOut.begin())), cnum, 2);
+            this->parent2ChildInterpolation(faceInpIn, faceInpOut, cnum, 2);
 
-            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+m_uiElementOrder]=faceInpOut[k*(m_uiElementOrder+1)+j];
+            for(unsigned int k=0;k<(eleOrder+1);k++)
+                for(unsigned int j=0;j<(eleOrder+1);j++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+eleOrder]=faceInpOut[k*(eleOrder+1)+j];
 
             nodeStatus[OCT_DIR_RIGHT_DOWN]=true;
             nodeStatus[OCT_DIR_RIGHT_UP]=true;
@@ -2565,9 +2643,9 @@ namespace ot
 
         }else
         {
-            for(unsigned int k=1;k<m_uiElementOrder;k++)
-                for(unsigned int j=1;j<m_uiElementOrder;j++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+m_uiElementOrder]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+m_uiElementOrder]];
+            for(unsigned int k=1;k<eleOrder;k++)
+                for(unsigned int j=1;j<eleOrder;j++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+eleOrder]=vec[m_uiE2NMapping_CG[elementID*nPe+k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+eleOrder]];
         }
 
 
@@ -2579,11 +2657,11 @@ namespace ot
             for (unsigned int index = 0; index < faceIndex.size(); index++)
                 faceInpIn[index] = vec[m_uiE2NMapping_CG[faceIndex[index]]];
 
-            this->parent2ChildInterpolation(&(*(faceInpIn.begin())), &(*(faceInpOut.begin())), cnum, 2);
+            this->parent2ChildInterpolation(faceInpIn, faceInpOut, cnum, 2);
 
-            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+i]=faceInpOut[k*(m_uiElementOrder+1)+i];
+            for(unsigned int k=0;k<(eleOrder+1);k++)
+                for(unsigned int i=0;i<(eleOrder+1);i++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+i]=faceInpOut[k*(eleOrder+1)+i];
 
 
             nodeStatus[OCT_DIR_RIGHT_DOWN]=true;
@@ -2600,9 +2678,9 @@ namespace ot
         }else
         {
 
-            for(unsigned int k=1;k<m_uiElementOrder;k++)
-                for(unsigned int i=1;i<m_uiElementOrder;i++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+i]];
+            for(unsigned int k=1;k<eleOrder;k++)
+                for(unsigned int i=1;i<eleOrder;i++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*nPe+k*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+i]];
         }
 
 
@@ -2613,11 +2691,11 @@ namespace ot
             for (unsigned int index = 0; index < faceIndex.size(); index++)
                 faceInpIn[index] = vec[m_uiE2NMapping_CG[faceIndex[index]]];
 
-            this->parent2ChildInterpolation(&(*(faceInpIn.begin())), &(*(faceInpOut.begin())), cnum, 2);
+            this->parent2ChildInterpolation(faceInpIn, faceInpOut, cnum, 2);
 
-            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+i]=faceInpOut[k*(m_uiElementOrder+1)+i];
+            for(unsigned int k=0;k<(eleOrder+1);k++)
+                for(unsigned int i=0;i<(eleOrder+1);i++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+i]=faceInpOut[k*(eleOrder+1)+i];
 
             nodeStatus[OCT_DIR_RIGHT_UP]=true;
             nodeStatus[OCT_DIR_LEFT_UP]=true;
@@ -2634,9 +2712,9 @@ namespace ot
         {
 
 
-            for(unsigned int k=1;k<m_uiElementOrder;k++)
-                for(unsigned int i=1;i<m_uiElementOrder;i++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+i]];
+            for(unsigned int k=1;k<eleOrder;k++)
+                for(unsigned int i=1;i<eleOrder;i++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*nPe+k*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+i]];
         }
 
 
@@ -2648,11 +2726,11 @@ namespace ot
             for (unsigned int index = 0; index < faceIndex.size(); index++)
                 faceInpIn[index] = vec[m_uiE2NMapping_CG[faceIndex[index]]];
 
-            this->parent2ChildInterpolation(&(*(faceInpIn.begin())), &(*(faceInpOut.begin())), cnum, 2);
+            this->parent2ChildInterpolation(faceInpIn, faceInpOut, cnum, 2);
 
-            for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                    nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]=faceInpOut[j*(m_uiElementOrder+1)+i];
+            for(unsigned int j=0;j<(eleOrder+1);j++)
+                for(unsigned int i=0;i<(eleOrder+1);i++)
+                    nodalValues[0*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]=faceInpOut[j*(eleOrder+1)+i];
 
             nodeStatus[OCT_DIR_LEFT_BACK]=true;
             nodeStatus[OCT_DIR_RIGHT_BACK]=true;
@@ -2668,9 +2746,9 @@ namespace ot
         }else
         {
 
-            for(unsigned int j=1;j<m_uiElementOrder;j++)
-                for(unsigned int i=1;i<m_uiElementOrder;i++)
-                    nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]];
+            for(unsigned int j=1;j<eleOrder;j++)
+                for(unsigned int i=1;i<eleOrder;i++)
+                    nodalValues[0*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*nPe+0*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]];
         }
 
 
@@ -2681,11 +2759,11 @@ namespace ot
             for (unsigned int index = 0; index < faceIndex.size(); index++)
                 faceInpIn[index] = vec[m_uiE2NMapping_CG[faceIndex[index]]];
 
-            this->parent2ChildInterpolation(&(*(faceInpIn.begin())), &(*(faceInpOut.begin())), cnum, 2);
+            this->parent2ChildInterpolation(faceInpIn, faceInpOut, cnum, 2);
 
-            for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                    nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]=faceInpOut[j*(m_uiElementOrder+1)+i];
+            for(unsigned int j=0;j<(eleOrder+1);j++)
+                for(unsigned int i=0;i<(eleOrder+1);i++)
+                    nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]=faceInpOut[j*(eleOrder+1)+i];
 
 
             nodeStatus[OCT_DIR_LEFT_FRONT]=true;
@@ -2701,9 +2779,9 @@ namespace ot
 
         }else
         {
-            for(unsigned int j=1;j<m_uiElementOrder;j++)
-                for(unsigned int i=1;i<m_uiElementOrder;i++)
-                    nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]];
+            for(unsigned int j=1;j<eleOrder;j++)
+                for(unsigned int i=1;i<eleOrder;i++)
+                    nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*nPe+eleOrder*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]];
         }
 
 
@@ -2719,18 +2797,18 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+0]=edgeInpOut[k];
+                for(unsigned int k=0;k<(eleOrder+1);k++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+0]=edgeInpOut[k];
 
                 nodeStatus[OCT_DIR_LEFT_DOWN_BACK]=true;
                 nodeStatus[OCT_DIR_LEFT_DOWN_FRONT]=true;
 
             }else
             {
-                for(unsigned int k=1;k<(m_uiElementOrder);k++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+0]];
+                for(unsigned int k=1;k<(eleOrder);k++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*nPe+k*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+0]];
             }
         }
 
@@ -2747,18 +2825,18 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+0]=edgeInpOut[k];
+                for(unsigned int k=0;k<(eleOrder+1);k++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+0]=edgeInpOut[k];
 
                 nodeStatus[OCT_DIR_LEFT_UP_BACK]=true;
                 nodeStatus[OCT_DIR_LEFT_UP_FRONT]=true;
 
             }else
             {
-                for(unsigned int k=1;k<(m_uiElementOrder);k++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+0]];
+                for(unsigned int k=1;k<(eleOrder);k++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*nPe+k*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+0]];
             }
         }
 
@@ -2774,18 +2852,18 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                    nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+0]=edgeInpOut[j];
+                for(unsigned int j=0;j<(eleOrder+1);j++)
+                    nodalValues[0*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+0]=edgeInpOut[j];
 
                 nodeStatus[OCT_DIR_LEFT_DOWN_BACK]=true;
                 nodeStatus[OCT_DIR_LEFT_UP_BACK]=true;
 
             }else
             {
-                for(unsigned int j=1;j<(m_uiElementOrder);j++)
-                    nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+0]];
+                for(unsigned int j=1;j<(eleOrder);j++)
+                    nodalValues[0*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*nPe+0*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+0]];
             }
         }
 
@@ -2802,18 +2880,18 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                    nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+0]=edgeInpOut[j];
+                for(unsigned int j=0;j<(eleOrder+1);j++)
+                    nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+0]=edgeInpOut[j];
 
                 nodeStatus[OCT_DIR_LEFT_DOWN_FRONT]=true;
                 nodeStatus[OCT_DIR_LEFT_UP_FRONT]=true;
 
             }else
             {
-                for(unsigned int j=1;j<(m_uiElementOrder);j++)
-                    nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+0]];
+                for(unsigned int j=1;j<(eleOrder);j++)
+                    nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*nPe+eleOrder*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+0]];
             }
         }
 
@@ -2830,18 +2908,18 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+m_uiElementOrder]=edgeInpOut[k];
+                for(unsigned int k=0;k<(eleOrder+1);k++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+eleOrder]=edgeInpOut[k];
 
                 nodeStatus[OCT_DIR_RIGHT_DOWN_BACK]=true;
                 nodeStatus[OCT_DIR_RIGHT_DOWN_FRONT]=true;
 
             }else
             {
-                for(unsigned int k=1;k<(m_uiElementOrder);k++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+m_uiElementOrder]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+m_uiElementOrder]];
+                for(unsigned int k=1;k<(eleOrder);k++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+eleOrder]=vec[m_uiE2NMapping_CG[elementID*nPe+k*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+eleOrder]];
             }
         }
 
@@ -2858,18 +2936,18 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+m_uiElementOrder]=edgeInpOut[k];
+                for(unsigned int k=0;k<(eleOrder+1);k++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+eleOrder]=edgeInpOut[k];
 
                 nodeStatus[OCT_DIR_RIGHT_UP_BACK]=true;
                 nodeStatus[OCT_DIR_RIGHT_UP_FRONT]=true;
 
             }else
             {
-                for(unsigned int k=1;k<(m_uiElementOrder);k++)
-                    nodalValues[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+m_uiElementOrder]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+m_uiElementOrder]];
+                for(unsigned int k=1;k<(eleOrder);k++)
+                    nodalValues[k*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+eleOrder]=vec[m_uiE2NMapping_CG[elementID*nPe+k*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+eleOrder]];
             }
         }
 
@@ -2885,18 +2963,18 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                    nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+m_uiElementOrder]=edgeInpOut[j];
+                for(unsigned int j=0;j<(eleOrder+1);j++)
+                    nodalValues[0*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+eleOrder]=edgeInpOut[j];
 
                 nodeStatus[OCT_DIR_RIGHT_DOWN_BACK]=true;
                 nodeStatus[OCT_DIR_RIGHT_UP_BACK]=true;
 
             }else
             {
-                for(unsigned int j=1;j<(m_uiElementOrder);j++)
-                    nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+m_uiElementOrder]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+m_uiElementOrder]];
+                for(unsigned int j=1;j<(eleOrder);j++)
+                    nodalValues[0*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+eleOrder]=vec[m_uiE2NMapping_CG[elementID*nPe+0*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+eleOrder]];
             }
         }
 
@@ -2913,18 +2991,18 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                    nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+m_uiElementOrder]=edgeInpOut[j];
+                for(unsigned int j=0;j<(eleOrder+1);j++)
+                    nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+eleOrder]=edgeInpOut[j];
 
                 nodeStatus[OCT_DIR_RIGHT_DOWN_FRONT]=true;
                 nodeStatus[OCT_DIR_RIGHT_UP_FRONT]=true;
 
             }else
             {
-                for(unsigned int j=1;j<(m_uiElementOrder);j++)
-                    nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+m_uiElementOrder]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+m_uiElementOrder]];
+                for(unsigned int j=1;j<(eleOrder);j++)
+                    nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+eleOrder]=vec[m_uiE2NMapping_CG[elementID*nPe+eleOrder*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+eleOrder]];
             }
         }
 
@@ -2943,18 +3021,18 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                    nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+i]=edgeInpOut[i];
+                for(unsigned int i=0;i<(eleOrder+1);i++)
+                    nodalValues[0*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+i]=edgeInpOut[i];
 
                 nodeStatus[OCT_DIR_LEFT_DOWN_BACK]=true;
                 nodeStatus[OCT_DIR_RIGHT_DOWN_BACK]=true;
 
             }else
             {
-                for(unsigned int i=1;i<(m_uiElementOrder);i++)
-                    nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+i]];
+                for(unsigned int i=1;i<(eleOrder);i++)
+                    nodalValues[0*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*nPe+0*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+i]];
             }
         }
 
@@ -2970,18 +3048,18 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                    nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+i]=edgeInpOut[i];
+                for(unsigned int i=0;i<(eleOrder+1);i++)
+                    nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+i]=edgeInpOut[i];
 
                 nodeStatus[OCT_DIR_LEFT_DOWN_FRONT]=true;
                 nodeStatus[OCT_DIR_RIGHT_DOWN_FRONT]=true;
 
             }else
             {
-                for(unsigned int i=1;i<(m_uiElementOrder);i++)
-                    nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+i]];
+                for(unsigned int i=1;i<(eleOrder);i++)
+                    nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*nPe+eleOrder*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+i]];
             }
         }
 
@@ -2997,18 +3075,18 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                    nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+i]=edgeInpOut[i];
+                for(unsigned int i=0;i<(eleOrder+1);i++)
+                    nodalValues[0*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+i]=edgeInpOut[i];
 
                 nodeStatus[OCT_DIR_LEFT_UP_BACK]=true;
                 nodeStatus[OCT_DIR_RIGHT_UP_BACK]=true;
 
             }else
             {
-                for(unsigned int i=1;i<(m_uiElementOrder);i++)
-                    nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+i]];
+                for(unsigned int i=1;i<(eleOrder);i++)
+                    nodalValues[0*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*nPe+0*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+i]];
             }
         }
 
@@ -3025,10 +3103,10 @@ namespace ot
                 for(unsigned int index=0;index<edgeIndex.size();index++)
                     edgeInpIn[index]=vec[m_uiE2NMapping_CG[edgeIndex[index]]];
 
-                this->parent2ChildInterpolation(&(*(edgeInpIn.begin())),&(*(edgeInpOut.begin())),cnum,1);
+                this->parent2ChildInterpolation(edgeInpIn,edgeInpOut,cnum,1);
 
-                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                    nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+i]=edgeInpOut[i];
+                for(unsigned int i=0;i<(eleOrder+1);i++)
+                    nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+i]=edgeInpOut[i];
 
                 nodeStatus[OCT_DIR_LEFT_UP_FRONT]=true;
                 nodeStatus[OCT_DIR_RIGHT_UP_FRONT]=true;
@@ -3036,44 +3114,44 @@ namespace ot
 
             }else
             {
-                for(unsigned int i=1;i<(m_uiElementOrder);i++)
-                    nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+i]];
+                for(unsigned int i=1;i<(eleOrder);i++)
+                    nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+i]=vec[m_uiE2NMapping_CG[elementID*nPe+eleOrder*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+i]];
             }
         }
 
 
         //node: OCT_DIR_LEFT_DOWN_BACK
         if((!(this->isNodeHanging(elementID,0,0,0))) || (!nodeStatus[OCT_DIR_LEFT_DOWN_BACK]))
-            nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+0]];
+            nodalValues[0*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*nPe+0*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+0]];
 
         //node: OCT_DIR_RIGHT_DOWN_BACK
-        if(!(this->isNodeHanging(elementID,m_uiElementOrder,0,0)) || (!nodeStatus[OCT_DIR_RIGHT_DOWN_BACK]))
-            nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+m_uiElementOrder]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+m_uiElementOrder]];
+        if(!(this->isNodeHanging(elementID,eleOrder,0,0)) || (!nodeStatus[OCT_DIR_RIGHT_DOWN_BACK]))
+            nodalValues[0*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+eleOrder]=vec[m_uiE2NMapping_CG[elementID*nPe+0*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+eleOrder]];
 
         //node: OCT_DIR_LEFT_UP_BACK
-        if(!(this->isNodeHanging(elementID,0,m_uiElementOrder,0)) || (!nodeStatus[OCT_DIR_LEFT_UP_BACK]))
-            nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+0]];
+        if(!(this->isNodeHanging(elementID,0,eleOrder,0)) || (!nodeStatus[OCT_DIR_LEFT_UP_BACK]))
+            nodalValues[0*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*nPe+0*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+0]];
 
         //node: OCT_DIR_RIGHT_UP_BACK
-        if(!(this->isNodeHanging(elementID,m_uiElementOrder,m_uiElementOrder,0)) || (!nodeStatus[OCT_DIR_RIGHT_UP_BACK]))
-            nodalValues[0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+m_uiElementOrder]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+0*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+m_uiElementOrder]];
+        if(!(this->isNodeHanging(elementID,eleOrder,eleOrder,0)) || (!nodeStatus[OCT_DIR_RIGHT_UP_BACK]))
+            nodalValues[0*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+eleOrder]=vec[m_uiE2NMapping_CG[elementID*nPe+0*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+eleOrder]];
 
 
         //node: OCT_DIR_LEFT_DOWN_FRONT
-        if(!(this->isNodeHanging(elementID,0,0,m_uiElementOrder))|| (!nodeStatus[OCT_DIR_LEFT_DOWN_FRONT]))
-            nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+0]];
+        if(!(this->isNodeHanging(elementID,0,0,eleOrder))|| (!nodeStatus[OCT_DIR_LEFT_DOWN_FRONT]))
+            nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*nPe+eleOrder*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+0]];
 
         //node: OCT_DIR_RIGHT_DOWN_FRONT
-        if(!(this->isNodeHanging(elementID,m_uiElementOrder,0,m_uiElementOrder))|| (!nodeStatus[OCT_DIR_RIGHT_DOWN_FRONT]))
-            nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+m_uiElementOrder]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+0*(m_uiElementOrder+1)+m_uiElementOrder]];
+        if(!(this->isNodeHanging(elementID,eleOrder,0,eleOrder))|| (!nodeStatus[OCT_DIR_RIGHT_DOWN_FRONT]))
+            nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+eleOrder]=vec[m_uiE2NMapping_CG[elementID*nPe+eleOrder*(eleOrder+1)*(eleOrder+1)+0*(eleOrder+1)+eleOrder]];
 
         //node: OCT_DIR_LEFT_UP_FRONT
-        if(!(this->isNodeHanging(elementID,0,m_uiElementOrder,m_uiElementOrder)) || (!nodeStatus[OCT_DIR_LEFT_UP_FRONT]))
-            nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+0]];
+        if(!(this->isNodeHanging(elementID,0,eleOrder,eleOrder)) || (!nodeStatus[OCT_DIR_LEFT_UP_FRONT]))
+            nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+0]=vec[m_uiE2NMapping_CG[elementID*nPe+eleOrder*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+0]];
 
         //node: OCT_DIR_RIGHT_UP_FRONT
-        if(!(this->isNodeHanging(elementID,m_uiElementOrder,m_uiElementOrder,m_uiElementOrder)) || (!nodeStatus[OCT_DIR_RIGHT_UP_FRONT]))
-            nodalValues[m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+m_uiElementOrder]=vec[m_uiE2NMapping_CG[elementID*m_uiNpE+m_uiElementOrder*(m_uiElementOrder+1)*(m_uiElementOrder+1)+m_uiElementOrder*(m_uiElementOrder+1)+m_uiElementOrder]];
+        if(!(this->isNodeHanging(elementID,eleOrder,eleOrder,eleOrder)) || (!nodeStatus[OCT_DIR_RIGHT_UP_FRONT]))
+            nodalValues[eleOrder*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+eleOrder]=vec[m_uiE2NMapping_CG[elementID*nPe+eleOrder*(eleOrder+1)*(eleOrder+1)+eleOrder*(eleOrder+1)+eleOrder]];
 
         #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                 dendro::timer::t_unzip_sync_nodalval.stop();
@@ -3091,28 +3169,28 @@ namespace ot
         const unsigned int npe_2d = (eleOrder + 1) * (eleOrder + 1);
         const unsigned int nPe = (eleOrder + 1) * (eleOrder + 1) * (eleOrder + 1);
 
-        //@todo later move this to outer allocation and reuse the memeory. 
-        double* qMat = new double[nPe*nPe];
-        double* qTIn = new double[nPe];
+        // per element scratch on the stack (see DENDRO_MESH_STACK_NPE), the input is only copied if it is not double.
+        double qBuf[2*DENDRO_MESH_STACK_NPE];
+        const bool isStack = (nPe <= DENDRO_MESH_STACK_NPE);
+        double* qTIn = (isStack) ? qBuf : new double[2*nPe];
+        const double* qIn = (const double*) in;
 
-        this->getElementQMat(elementID,qMat,true);
-        
-        for (unsigned int i=0;i<nPe; i++)
+        if(!std::is_same<T,double>::value)
         {
-            qTIn[i] = 0;
-
-            for(unsigned int j=0;j<nPe;j++)
-            {
-                qTIn[i] += qMat[j*nPe + i] *in[j]; // note the transpose. 
-            }
+            double* qCpy = qTIn + nPe;
+            for (unsigned int i=0;i<nPe; i++)
+                qCpy[i] = in[i];
+            qIn = qCpy;
         }
 
+        // note the transpose, applied matrix free. 
+        this->applyElementQTMat(elementID,qIn,qTIn);
+
         for (unsigned int i=0;i<nPe; i++)
             out[m_uiE2NMapping_CG[elementID*nPe + i]] += qTIn[i];
 
-
-        delete [] qMat;
-        delete [] qTIn;
+        if(!isStack)
+            delete [] qTIn;
 
         
         return;
@@ -3940,7 +4018,7 @@ namespace ot
     }
 
     template<typename T>
-    void Mesh::interGridTransferUnzip(T*& unzip, T*& vec, const ot::Mesh *pMesh)
+    void Mesh::interGridTransferUnzip(const T* unzip, const T* vec, T* vecOut, const ot::Mesh *pMesh)
     {
 
         MPI_Comm comm=m_uiCommGlobal;
@@ -4148,7 +4226,7 @@ namespace ot
 
                 assert((wVec.size()/m_uiNpE)==pMesh->getNumLocalMeshElements());
 
-                T * tVec=pMesh->createVector<T>(0);
+                T * tVec=vecOut;
                 const unsigned int * e2n=&(*(pMesh->getE2NMapping().begin()));
 
                 const unsigned int m2LocalElemBegin=pMesh->getElementLocalBegin();
@@ -4180,9 +4258,6 @@ namespace ot
                 }
 
 
-                std::swap(vec,tVec);
-                delete [] tVec;
-                tVec==NULL;
                 return ;
             }
 
@@ -4321,7 +4396,7 @@ namespace ot
         T * tVec=NULL;
         if(pMesh->isActive())
         {
-            tVec=pMesh->createVector<T>(0);
+            tVec=vecOut;
             const unsigned int * e2n=&(*(pMesh->getE2NMapping().begin()));
 
             const unsigned int m2LocalElemBegin=pMesh->getElementLocalBegin();
@@ -4353,22 +4428,38 @@ namespace ot
             }
 
 
-            std::swap(vec,tVec);
-
         }
 
-        delete [] tVec;
-        tVec=NULL;
-        
         wVec.clear();
         wVec_m2.clear();
 
     }
 
+    template<typename T>
+    void Mesh::interGridTransferUnzip(T*& unzip, T*& vec, const ot::Mesh *pMesh)
+    {
+        T* tVec = pMesh->createVector<T>(0);
+        this->interGridTransferUnzip(unzip,vec,tVec,pMesh);
+
+        std::swap(vec,tVec);
+        delete [] tVec;
+        return;
+    }
+
 
     template<typename T>
     void Mesh::zip(const T* unzippedVec, T* zippedVec)
     {
+        DENDRO_MESH_ELE_ORDER_DISPATCH(this->zip_p,unzippedVec,zippedVec);
+    }
+
+    template<unsigned int pOrder, typename T>
+    void Mesh::zip_p(const T* unzippedVec, T* zippedVec)
+    {
+        // compile time element order (if specialized) so that the element loops have constant trip counts.
+        const unsigned int eleOrder = (pOrder!=0) ? pOrder : m_uiElementOrder;
+        const unsigned int nPe = (pOrder!=0) ? (pOrder+1)*(pOrder+1)*(pOrder+1) : m_uiNpE;
+
 
         if(!m_uiIsActive) return;
 
@@ -4402,12 +4493,12 @@ namespace ot
 
 
                 // (1). local nodes copy. Not need to interpolate or inject values. By block construction local octants in the block has is the same level as regular grid.
-                for(unsigned int k=0;k<m_uiElementOrder+1;k++)
-                    for(unsigned int j=0;j<m_uiElementOrder+1;j++)
-                        for(unsigned int i=0;i<m_uiElementOrder+1;i++)
+                for(unsigned int k=0;k<eleOrder+1;k++)
+                    for(unsigned int j=0;j<eleOrder+1;j++)
+                        for(unsigned int i=0;i<eleOrder+1;i++)
                         {
-                            if((m_uiE2NMapping_DG[elem*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]/m_uiNpE)==elem)
-                                zippedVec[m_uiE2NMapping_CG[elem*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]]=unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i+paddWidth)];
+                            if((m_uiE2NMapping_DG[elem*nPe+k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]/nPe)==elem)
+                                zippedVec[m_uiE2NMapping_CG[elem*nPe+k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]]=unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i+paddWidth)];
                         }
 
             }
@@ -4418,6 +4509,16 @@ namespace ot
     template<typename T>
     void Mesh::zip(const T *unzippedVec, T *zippedVec, const unsigned int *blkIDs, unsigned int numblks, unsigned int ll)
     {
+        DENDRO_MESH_ELE_ORDER_DISPATCH(this->zip_p,unzippedVec,zippedVec,blkIDs,numblks,ll);
+    }
+
+    template<unsigned int pOrder, typename T>
+    void Mesh::zip_p(const T *unzippedVec, T *zippedVec, const unsigned int *blkIDs, unsigned int numblks, unsigned int ll)
+    {
+        // compile time element order (if specialized) so that the element loops have constant trip counts.
+        const unsigned int eleOrder = (pOrder!=0) ? pOrder : m_uiElementOrder;
+        const unsigned int nPe = (pOrder!=0) ? (pOrder+1)*(pOrder+1)*(pOrder+1) : m_uiNpE;
+
         if(!m_uiIsActive)
             return ;
 
@@ -4453,18 +4554,18 @@ namespace ot
                 assert(pNodes[elem].getLevel()==regLev); // this is enforced by block construction
 
                 // todo : note here we copy values directly if it is hanging or not to the corresponding non hanging nodes. 
-                for(unsigned int k=0;k<m_uiElementOrder+1;k++)
-                    for(unsigned int j=0;j<m_uiElementOrder+1;j++)
-                        for(unsigned int i=0;i<m_uiElementOrder+1;i++)
+                for(unsigned int k=0;k<eleOrder+1;k++)
+                    for(unsigned int j=0;j<eleOrder+1;j++)
+                        for(unsigned int i=0;i<eleOrder+1;i++)
                         {
-                            // if(unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i+paddWidth)] == 0)
+                            // if(unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i+paddWidth)] == 0)
                             //     std::cout<<" ele "<<elem<<" of: "<<blk<<" write zero "<<std::endl;
                             // else
-                            //     std::cout<<" ele "<<elem<<" of: "<<blk<<" writes "<<unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i+paddWidth)]<<std::endl;
-                            // const unsigned int ownerID = (m_uiE2NMapping_DG[elem*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]/m_uiNpE);
+                            //     std::cout<<" ele "<<elem<<" of: "<<blk<<" writes "<<unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i+paddWidth)]<<std::endl;
+                            // const unsigned int ownerID = (m_uiE2NMapping_DG[elem*nPe+k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]/nPe);
                             // if(m_uiAllElements[ownerID].getLevel() >= (ll-1))
-                                zippedVec[m_uiE2NMapping_CG[elem*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]]=unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i+paddWidth)];
-                            //std::cout<<"zipped value: "<<zippedVec[m_uiE2NMapping_CG[elem*m_uiNpE+k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i]]<<std::endl;
+                                zippedVec[m_uiE2NMapping_CG[elem*nPe+k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]]=unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i+paddWidth)];
+                            //std::cout<<"zipped value: "<<zippedVec[m_uiE2NMapping_CG[elem*nPe+k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i]]<<std::endl;
                         }
 
             }
@@ -8030,6 +8131,16 @@ namespace ot
     template<typename T>
     void Mesh::unzip(const T* zippedVec, T* unzippedVec, const unsigned int *blkIDs, unsigned int numblks)
     {
+        DENDRO_MESH_ELE_ORDER_DISPATCH(this->unzip_p,zippedVec,unzippedVec,blkIDs,numblks);
+    }
+
+    template<unsigned int pOrder, typename T>
+    void Mesh::unzip_p(const T* zippedVec, T* unzippedVec, const unsigned int *blkIDs, unsigned int numblks)
+    {
+        // compile time element order (if specialized) so that the element loops have constant trip counts.
+        const unsigned int eleOrder = (pOrder!=0) ? pOrder : m_uiElementOrder;
+        const unsigned int nPe = (pOrder!=0) ? (pOrder+1)*(pOrder+1)*(pOrder+1) : m_uiNpE;
+
         if( (!m_uiIsActive) || (m_uiLocalBlockList.empty())  ) return;
 
         ot::TreeNode blkNode;
@@ -8050,44 +8161,26 @@ namespace ot
         register unsigned int nodeLookUp_CG;
         register unsigned int nodeLookUp_DG;
 
-        std::vector<T> interpOrInjectionOut; // interpolation or injection output.
-        std::vector<T> injectionInput;// input for the injection (values from all the 8 children) (This should be put in the order of the morton ordering. )
-        std::vector<T> interpolationInput;
-
-        std::vector<T> edgeInterpIn;
-        std::vector<T> edgeInterpOut;
-
-        std::vector<T> faceInterpIn;
-        std::vector<T> faceInterpOut;
-
-        std::vector<T> lookUpElementVec;
-        std::vector<T> parentEleInterpIn;
-        std::vector<T> parentEleInterpOut;
-
-        std::vector<unsigned int> edgeIndex;
-        std::vector<unsigned int > faceIndex;
-        std::vector<unsigned int > child;
-        child.resize(NUM_CHILDREN);
-
-        interpOrInjectionOut.resize(m_uiNpE);
-        interpolationInput.resize(m_uiNpE);
-        //injectionInput.resize(m_uiNpE*NUM_CHILDREN);
-
-        std::vector<T> injectionTest;
-        injectionTest.resize(m_uiNpE*NUM_CHILDREN);
-
-        edgeIndex.resize((m_uiElementOrder+1));
-        faceIndex.resize((m_uiElementOrder+1)*(m_uiElementOrder+1));
-
-        edgeInterpIn.resize((m_uiElementOrder+1));
-        edgeInterpOut.resize((m_uiElementOrder+1));
-
-        faceInterpIn.resize((m_uiElementOrder+1)*(m_uiElementOrder+1));
-        faceInterpOut.resize((m_uiElementOrder+1)*(m_uiElementOrder+1));
+        // element local work buffers, stack resident if the element order is known at compile time.
+        T eleBufStack[(pOrder!=0) ? 5*(pOrder+1)*(pOrder+1)*(pOrder+1) : 1];
+        std::vector<T> eleBufHeap;
+        T* eleBuf = eleBufStack;
+        if(pOrder==0)
+        {
+            eleBufHeap.resize(5*nPe);
+            eleBuf = eleBufHeap.data();
+        }
 
-        lookUpElementVec.resize(m_uiNpE);
-        parentEleInterpIn.resize(m_uiNpE);
-        parentEleInterpOut.resize(m_uiNpE);
+        T* const interpOrInjectionOut = eleBuf;               // interpolation or injection output.
+        #ifdef USE_FD_INTERP_FOR_UNZIP
+        T* const interpolationInput   = eleBuf + nPe;
+        #endif
+        T* const lookUpElementVec     = eleBuf + 2*nPe;
+        T* const parentEleInterpIn    = eleBuf + 3*nPe;
+        #ifdef DEBUG_UNZIP_OP_3PT
+        T* const parentEleInterpOut   = eleBuf + 4*nPe;
+        #endif
+        unsigned int child[NUM_CHILDREN];
 
         unsigned int mid_bit=0;
         unsigned int sz;
@@ -8116,9 +8209,9 @@ namespace ot
 
         // NOTE: Be careful when you access ghost elements for padding. (You should only access the level 1 ghost elements. You should not access the level 2 ghost elements at any time. )
         paddWidth = m_uiLocalBlockList[0].get1DPadWidth();
-        if(m_uiElementOrder ==4 && paddWidth==3)
+        if(eleOrder ==4 && paddWidth==3)
         {
-            //std::cout<<"read spt points : "<<m_uiElementOrder<<" pwidth : "<<paddWidth<<std::endl;
+            //std::cout<<"read spt points : "<<eleOrder<<" pwidth : "<<paddWidth<<std::endl;
             readSpecialPtsBegin(zippedVec);
         }
 
@@ -8129,7 +8222,7 @@ namespace ot
             blkNode=m_uiLocalBlockList[blk].getBlockNode();
             assert(blkNode.maxX()<=m_uiMeshDomain_max && blkNode.minX()>=m_uiMeshDomain_min);
             regLev=m_uiLocalBlockList[blk].getRegularGridLev();
-            //blkNpe_1D=m_uiElementOrder*(1u<<(regLev-blkNode.getLevel()))+1+2*GHOST_WIDTH;
+            //blkNpe_1D=eleOrder*(1u<<(regLev-blkNode.getLevel()))+1+2*GHOST_WIDTH;
             //std::cout<<"rank: "<<m_uiActiveRank<<" -- blkNpw_1D: "<<blkNpe_1D<<" blkNode: "<<blkNode<<" regLev: "<<regLev<<std::endl;
 
             sz=1u<<(m_uiMaxDepth-regLev);
@@ -8154,20 +8247,20 @@ namespace ot
                 #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                     dendro::timer::t_unzip_sync_internal.start();
                 #endif
-                this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),elem);
-                //this->getElementNodalValues(zippedVec,&(*(parentEleInterpIn.begin())),elem);
+                this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,elem);
+                //this->getElementNodalValues_p<pOrder>(zippedVec,parentEleInterpIn,elem);
                 // note: do not change the parentInterpIn values. These are used to interpolate the 3rd point in the advective terms.
-                for(unsigned int w=0;w<m_uiNpE;w++)
+                for(unsigned int w=0;w<nPe;w++)
                     parentEleInterpIn[w]=lookUpElementVec[w];
 
                 // (1). local nodes copy. Not need to interpolate or inject values. By block construction local octants in the block has is the same level as regular grid.
                 #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                     dendro::timer::t_unzip_sync_cpy.start();
                 #endif
-                for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                    for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                        for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                           unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=lookUpElementVec[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                for(unsigned int k=0;k<(eleOrder+1);k++)
+                    for(unsigned int j=0;j<(eleOrder+1);j++)
+                        for(unsigned int i=0;i<(eleOrder+1);i++)
+                           unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i+paddWidth)]=lookUpElementVec[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                 #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                     dendro::timer::t_unzip_sync_cpy.stop();
@@ -8192,16 +8285,16 @@ namespace ot
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_f_c1.start();
                             #endif
-                            assert(paddWidth<(m_uiElementOrder+1));
-                            this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
+                            assert(paddWidth<(eleOrder+1));
+                            this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
-                            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                    for(unsigned int i=(m_uiElementOrder-paddWidth);i<(m_uiElementOrder+1);i++)
-                                        unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i-(m_uiElementOrder-paddWidth))]=lookUpElementVec[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                            for(unsigned int k=0;k<(eleOrder+1);k++)
+                                for(unsigned int j=0;j<(eleOrder+1);j++)
+                                    for(unsigned int i=(eleOrder-paddWidth);i<(eleOrder+1);i++)
+                                        unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i-(eleOrder-paddWidth))]=lookUpElementVec[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.stop();
@@ -8226,11 +8319,11 @@ namespace ot
 
 
                             #ifdef USE_FD_INTERP_FOR_UNZIP
-                                const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_LEFT,child.data(),fid,cid);
+                                const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_LEFT,child,fid,cid);
                                 if(st > 0)
                                 {
                                     const unsigned int NUM_CHILDREN_BY2 = (NUM_CHILDREN>>1u);
-                                    this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec.data(), interpolationInput.data(), interpOrInjectionOut.data(), lookUp, fid, cid,child.data());
+                                    this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec, interpolationInput, interpOrInjectionOut, lookUp, fid, cid,child);
                                     for(unsigned int w =0; w < NUM_CHILDREN_BY2 ; w++)
                                     {
                                         assert(pNodes[lookUp] == pNodes[m_uiE2EMapping[child[fid[w]]*m_uiNumDirections + OCT_DIR_LEFT]]);
@@ -8240,7 +8333,7 @@ namespace ot
                                         if(child[fid[w]]<m_uiElementLocalBegin || child[fid[w]]>=m_uiElementLocalEnd)
                                             continue;
 
-                                        this->parent2ChildInterpolation(lookUpElementVec.data(),interpOrInjectionOut.data(),cid[w],m_uiDim);
+                                        this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cid[w],m_uiDim);
 
 
                                         const ot::Block blk_fd = m_uiLocalBlockList[m_uiE2BlkMap[(child[fid[w]] - m_uiElementLocalBegin)]];
@@ -8259,11 +8352,11 @@ namespace ot
                                         const unsigned int ej_fd = (pNodes[child[fid[w]]].getY()-blkNode_fd.getY())>>(m_uiMaxDepth-regL_fd);
                                         const unsigned int ek_fd = (pNodes[child[fid[w]]].getZ()-blkNode_fd.getZ())>>(m_uiMaxDepth-regL_fd);
 
-                                        assert(paddWidth<(m_uiElementOrder+1));
-                                        for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                        for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                        for(unsigned int i=(m_uiElementOrder-paddWidth);i<(m_uiElementOrder+1);i++)
-                                            unzippedVec[offset_fd+(ek_fd*m_uiElementOrder+k+paddWidth)*(ly_fd*lx_fd)+(ej_fd*m_uiElementOrder+j+paddWidth)*(lx_fd)+(ei_fd*m_uiElementOrder+i-(m_uiElementOrder-paddWidth))]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                        assert(paddWidth<(eleOrder+1));
+                                        for(unsigned int k=0;k<(eleOrder+1);k++)
+                                        for(unsigned int j=0;j<(eleOrder+1);j++)
+                                        for(unsigned int i=(eleOrder-paddWidth);i<(eleOrder+1);i++)
+                                            unzippedVec[offset_fd+(ek_fd*eleOrder+k+paddWidth)*(ly_fd*lx_fd)+(ej_fd*eleOrder+j+paddWidth)*(lx_fd)+(ei_fd*eleOrder+i-(eleOrder-paddWidth))]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
                                     }
 
                                     
@@ -8271,15 +8364,15 @@ namespace ot
 
                                 }
                             #else
-                                this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
-                                this->parent2ChildInterpolation(&(*(lookUpElementVec.begin())),&(*(interpOrInjectionOut.begin())),cnum);
+                                this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
+                                this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cnum);
 
                                 
-                                assert(paddWidth<(m_uiElementOrder+1));
-                                for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                    for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                        for(unsigned int i=(m_uiElementOrder-paddWidth);i<(m_uiElementOrder+1);i++)
-                                            unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i-(m_uiElementOrder-paddWidth))]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                assert(paddWidth<(eleOrder+1));
+                                for(unsigned int k=0;k<(eleOrder+1);k++)
+                                    for(unsigned int j=0;j<(eleOrder+1);j++)
+                                        for(unsigned int i=(eleOrder-paddWidth);i<(eleOrder+1);i++)
+                                            unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i-(eleOrder-paddWidth))]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
                             #endif
 
                             
@@ -8307,7 +8400,7 @@ namespace ot
                             child[7]=m_uiE2EMapping[child[3]*m_uiNumDirections+OCT_DIR_FRONT];
                             assert(child[7]!=LOOK_UP_TABLE_DEFAULT);
 
-                            if(m_uiElementOrder ==4 && paddWidth==3)
+                            if(eleOrder ==4 && paddWidth==3)
                             {
                                 // we need to search for the additional points. 
                                 child[0]=m_uiE2EMapping[child[1]*m_uiNumDirections+OCT_DIR_LEFT];
@@ -8325,7 +8418,7 @@ namespace ot
                             }
 
 
-                            this->child2ParentInjection(zippedVec,interpOrInjectionOut.data(),child.data(),pNodes[lookUp].getLevel());
+                            this->child2ParentInjection(zippedVec,interpOrInjectionOut,child,pNodes[lookUp].getLevel());
 
                             
 
@@ -8339,17 +8432,17 @@ namespace ot
 
                                 for(unsigned int index=0;index<(NUM_CHILDREN>>1u);index++)
                                 {
-                                    interpDownWind(fd::D1_ORDER_4_DOWNWIND,elem,child[faceNeighCnum1[index]],&(*(lookUpElementVec.begin())),faceNeighCnum2[index],&(*(parentEleInterpIn.begin())),&(*(parentEleInterpOut.begin())),OCT_DIR_LEFT,paddWidth,zippedVec,&(*(interpOrInjectionOut.begin())));
+                                    interpDownWind(fd::D1_ORDER_4_DOWNWIND,elem,child[faceNeighCnum1[index]],lookUpElementVec,faceNeighCnum2[index],parentEleInterpIn,parentEleInterpOut,OCT_DIR_LEFT,paddWidth,zippedVec,interpOrInjectionOut);
                                 }
                             #endif
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
-                            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                    for(unsigned int i=(m_uiElementOrder-paddWidth);i<(m_uiElementOrder+1);i++)
-                                        unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i-(m_uiElementOrder-paddWidth))]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                            for(unsigned int k=0;k<(eleOrder+1);k++)
+                                for(unsigned int j=0;j<(eleOrder+1);j++)
+                                    for(unsigned int i=(eleOrder-paddWidth);i<(eleOrder+1);i++)
+                                        unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i-(eleOrder-paddWidth))]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.stop();
@@ -8382,16 +8475,16 @@ namespace ot
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_f_c1.start();
                             #endif
-                            assert(paddWidth<(m_uiElementOrder+1));
-                            this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
+                            assert(paddWidth<(eleOrder+1));
+                            this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
-                            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
+                            for(unsigned int k=0;k<(eleOrder+1);k++)
+                                for(unsigned int j=0;j<(eleOrder+1);j++)
                                     for(unsigned int i=0;i<(paddWidth+1);i++)
-                                      unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+((ei+1)*m_uiElementOrder+paddWidth+i)]=lookUpElementVec[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                      unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+((ei+1)*eleOrder+paddWidth+i)]=lookUpElementVec[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.stop();
@@ -8417,11 +8510,11 @@ namespace ot
                             #endif
 
                             #ifdef USE_FD_INTERP_FOR_UNZIP
-                                const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_RIGHT,child.data(),fid,cid);
+                                const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_RIGHT,child,fid,cid);
                                 if(st > 0)
                                 {
                                     const unsigned int NUM_CHILDREN_BY2 = (NUM_CHILDREN>>1u);
-                                    this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec.data(), interpolationInput.data(), interpOrInjectionOut.data(), lookUp, fid, cid,child.data());
+                                    this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec, interpolationInput, interpOrInjectionOut, lookUp, fid, cid,child);
                                     for(unsigned int w =0; w < NUM_CHILDREN_BY2 ; w++)
                                     {
                                         assert(pNodes[lookUp] == pNodes[m_uiE2EMapping[child[fid[w]]*m_uiNumDirections + OCT_DIR_RIGHT]]);
@@ -8430,7 +8523,7 @@ namespace ot
                                         if(child[fid[w]]<m_uiElementLocalBegin || child[fid[w]]>=m_uiElementLocalEnd)
                                             continue;
 
-                                        this->parent2ChildInterpolation(lookUpElementVec.data(),interpOrInjectionOut.data(),cid[w],m_uiDim);
+                                        this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cid[w],m_uiDim);
                                         
                                         const ot::Block blk_fd = m_uiLocalBlockList[m_uiE2BlkMap[(child[fid[w]] - m_uiElementLocalBegin)]];
                                         const ot::TreeNode blkNode_fd = blk_fd.getBlockNode();
@@ -8449,10 +8542,10 @@ namespace ot
                                         const unsigned int ek_fd = (pNodes[child[fid[w]]].getZ()-blkNode_fd.getZ())>>(m_uiMaxDepth-regL_fd);
 
 
-                                        for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                        for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
+                                        for(unsigned int k=0;k<(eleOrder+1);k++)
+                                        for(unsigned int j=0;j<(eleOrder+1);j++)
                                             for(unsigned int i=0;i<(paddWidth+1);i++)
-                                            unzippedVec[offset_fd+(ek_fd*m_uiElementOrder+k+paddWidth)*(ly_fd*lx_fd)+(ej_fd*m_uiElementOrder+j+paddWidth)*(lx_fd)+((ei_fd+1)*m_uiElementOrder+paddWidth+i)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                            unzippedVec[offset_fd+(ek_fd*eleOrder+k+paddWidth)*(ly_fd*lx_fd)+(ej_fd*eleOrder+j+paddWidth)*(lx_fd)+((ei_fd+1)*eleOrder+paddWidth+i)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
                                     }
 
                                     
@@ -8460,13 +8553,13 @@ namespace ot
 
                                 }
                             #else
-                                this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
-                                this->parent2ChildInterpolation(&(*(lookUpElementVec.begin())),&(*(interpOrInjectionOut.begin())),cnum);
-                                assert(paddWidth<(m_uiElementOrder+1));
-                                for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                    for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
+                                this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
+                                this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cnum);
+                                assert(paddWidth<(eleOrder+1));
+                                for(unsigned int k=0;k<(eleOrder+1);k++)
+                                    for(unsigned int j=0;j<(eleOrder+1);j++)
                                         for(unsigned int i=0;i<(paddWidth+1);i++)
-                                            unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+((ei+1)*m_uiElementOrder+paddWidth+i)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                            unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+((ei+1)*eleOrder+paddWidth+i)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
                             #endif
 
 
@@ -8492,7 +8585,7 @@ namespace ot
                             child[6]=m_uiE2EMapping[child[2]*m_uiNumDirections+OCT_DIR_FRONT];
                             assert(child[6]!=LOOK_UP_TABLE_DEFAULT);
 
-                            if(m_uiElementOrder ==4 && paddWidth==3)
+                            if(eleOrder ==4 && paddWidth==3)
                             {
                                 child[1]=m_uiE2EMapping[child[0]*m_uiNumDirections+OCT_DIR_RIGHT];
                                 child[3]=m_uiE2EMapping[child[2]*m_uiNumDirections+OCT_DIR_RIGHT];
@@ -8511,7 +8604,7 @@ namespace ot
                             
 
 
-                            this->child2ParentInjection(zippedVec,interpOrInjectionOut.data(),child.data(),pNodes[lookUp].getLevel());
+                            this->child2ParentInjection(zippedVec,interpOrInjectionOut,child,pNodes[lookUp].getLevel());
 
                             #ifdef DEBUG_UNZIP_OP_3PT
                                 faceNeighCnum1[0]=0;faceNeighCnum1[1]=2;faceNeighCnum1[2]=4;faceNeighCnum1[3]=6;
@@ -8520,7 +8613,7 @@ namespace ot
 
                                 for(unsigned int index=0;index<(NUM_CHILDREN>>1u);index++)
                                 {
-                                    interpUpWind(fd::D1_ORDER_4_UPWIND,elem,child[faceNeighCnum1[index]],&(*(lookUpElementVec.begin())),faceNeighCnum2[index],&(*(parentEleInterpIn.begin())),&(*(parentEleInterpOut.begin())),OCT_DIR_RIGHT,paddWidth,zippedVec,&(*(interpOrInjectionOut.begin())));
+                                    interpUpWind(fd::D1_ORDER_4_UPWIND,elem,child[faceNeighCnum1[index]],lookUpElementVec,faceNeighCnum2[index],parentEleInterpIn,parentEleInterpOut,OCT_DIR_RIGHT,paddWidth,zippedVec,interpOrInjectionOut);
                                 }
                             #endif
 
@@ -8528,10 +8621,10 @@ namespace ot
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
                             
-                            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
+                            for(unsigned int k=0;k<(eleOrder+1);k++)
+                                for(unsigned int j=0;j<(eleOrder+1);j++)
                                     for(unsigned int i=0;i<(paddWidth+1);i++)
-                                        unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+((ei+1)*m_uiElementOrder+paddWidth+i)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                        unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+((ei+1)*eleOrder+paddWidth+i)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.stop();
@@ -8567,16 +8660,16 @@ namespace ot
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_f_c1.start();
                             #endif
-                            assert(paddWidth<(m_uiElementOrder+1));
-                            this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
+                            assert(paddWidth<(eleOrder+1));
+                            this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
-                            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                                    for(unsigned int j=(m_uiElementOrder-paddWidth);j<(m_uiElementOrder+1);j++)
-                                       unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j-(m_uiElementOrder-paddWidth))*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=lookUpElementVec[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                            for(unsigned int k=0;k<(eleOrder+1);k++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
+                                    for(unsigned int j=(eleOrder-paddWidth);j<(eleOrder+1);j++)
+                                       unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j-(eleOrder-paddWidth))*(lx)+(ei*eleOrder+i+paddWidth)]=lookUpElementVec[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.stop();
@@ -8596,17 +8689,17 @@ namespace ot
                             
 
                             //std::cout<<"m_uiActiveRank : "<<m_uiActiveRank<<"parent to child interpolation executed"<<std::endl;
-                            assert(paddWidth<(m_uiElementOrder+1));
+                            assert(paddWidth<(eleOrder+1));
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
 
                             #ifdef USE_FD_INTERP_FOR_UNZIP
-                            const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_DOWN,child.data(),fid,cid);
+                            const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_DOWN,child,fid,cid);
                             if(st > 0)
                             {
                                 const unsigned int NUM_CHILDREN_BY2 = (NUM_CHILDREN>>1u);
-                                this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec.data(), interpolationInput.data(), interpOrInjectionOut.data(), lookUp, fid, cid,child.data());
+                                this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec, interpolationInput, interpOrInjectionOut, lookUp, fid, cid,child);
                                 for(unsigned int w =0; w < NUM_CHILDREN_BY2 ; w++)
                                 {
                                     assert(pNodes[lookUp] == pNodes[m_uiE2EMapping[child[fid[w]]*m_uiNumDirections + OCT_DIR_DOWN]]);
@@ -8615,7 +8708,7 @@ namespace ot
                                     if(child[fid[w]]<m_uiElementLocalBegin || child[fid[w]]>=m_uiElementLocalEnd)
                                         continue;
                                         
-                                    this->parent2ChildInterpolation(lookUpElementVec.data(),interpOrInjectionOut.data(),cid[w],m_uiDim);
+                                    this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cid[w],m_uiDim);
 
                                     const ot::Block blk_fd = m_uiLocalBlockList[m_uiE2BlkMap[(child[fid[w]] - m_uiElementLocalBegin)]];
                                     const ot::TreeNode blkNode_fd = blk_fd.getBlockNode();
@@ -8631,10 +8724,10 @@ namespace ot
                                     const unsigned int ej_fd = (pNodes[child[fid[w]]].getY()-blkNode_fd.getY())>>(m_uiMaxDepth-regL_fd);
                                     const unsigned int ek_fd = (pNodes[child[fid[w]]].getZ()-blkNode_fd.getZ())>>(m_uiMaxDepth-regL_fd);
                                     
-                                    for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                        for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                                            for(unsigned int j=(m_uiElementOrder-paddWidth);j<(m_uiElementOrder+1);j++)
-                                                unzippedVec[offset_fd+(ek_fd*m_uiElementOrder+k+paddWidth)*(ly_fd*lx_fd)+(ej_fd*m_uiElementOrder+j-(m_uiElementOrder-paddWidth))*(lx_fd)+(ei_fd*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                    for(unsigned int k=0;k<(eleOrder+1);k++)
+                                        for(unsigned int i=0;i<(eleOrder+1);i++)
+                                            for(unsigned int j=(eleOrder-paddWidth);j<(eleOrder+1);j++)
+                                                unzippedVec[offset_fd+(ek_fd*eleOrder+k+paddWidth)*(ly_fd*lx_fd)+(ej_fd*eleOrder+j-(eleOrder-paddWidth))*(lx_fd)+(ei_fd*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
                                 }
 
                                 
@@ -8642,13 +8735,13 @@ namespace ot
 
                             }
                             #else
-                                this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
-                                this->parent2ChildInterpolation(&(*(lookUpElementVec.begin())),&(*(interpOrInjectionOut.begin())),cnum);
+                                this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
+                                this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cnum);
 
-                                for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                                    for(unsigned int j=(m_uiElementOrder-paddWidth);j<(m_uiElementOrder+1);j++)
-                                        unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j-(m_uiElementOrder-paddWidth))*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                for(unsigned int k=0;k<(eleOrder+1);k++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
+                                    for(unsigned int j=(eleOrder-paddWidth);j<(eleOrder+1);j++)
+                                        unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j-(eleOrder-paddWidth))*(lx)+(ei*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
 
                             #endif
@@ -8674,7 +8767,7 @@ namespace ot
                             child[7]=m_uiE2EMapping[child[3]*m_uiNumDirections+OCT_DIR_FRONT];
                             assert(child[7]!=LOOK_UP_TABLE_DEFAULT);
 
-                            if(m_uiElementOrder ==4 && paddWidth==3)
+                            if(eleOrder ==4 && paddWidth==3)
                             {
                                 child[0]=m_uiE2EMapping[child[2]*m_uiNumDirections+OCT_DIR_DOWN];
                                 child[1]=m_uiE2EMapping[child[3]*m_uiNumDirections+OCT_DIR_DOWN];
@@ -8692,7 +8785,7 @@ namespace ot
                             }
 
                             
-                            this->child2ParentInjection(zippedVec,interpOrInjectionOut.data(),child.data(),pNodes[lookUp].getLevel());
+                            this->child2ParentInjection(zippedVec,interpOrInjectionOut,child,pNodes[lookUp].getLevel());
 
                             #ifdef DEBUG_UNZIP_OP_3PT
                                 faceNeighCnum1[0]=2;faceNeighCnum1[1]=3;faceNeighCnum1[2]=6;faceNeighCnum1[3]=7;
@@ -8701,7 +8794,7 @@ namespace ot
 
                                 for(unsigned int index=0;index<(NUM_CHILDREN>>1u);index++)
                                 {
-                                interpDownWind(fd::D1_ORDER_4_DOWNWIND,elem,child[faceNeighCnum1[index]],&(*(lookUpElementVec.begin())),faceNeighCnum2[index],&(*(parentEleInterpIn.begin())),&(*(parentEleInterpOut.begin())),OCT_DIR_DOWN,paddWidth,zippedVec,&(*(interpOrInjectionOut.begin())));
+                                interpDownWind(fd::D1_ORDER_4_DOWNWIND,elem,child[faceNeighCnum1[index]],lookUpElementVec,faceNeighCnum2[index],parentEleInterpIn,parentEleInterpOut,OCT_DIR_DOWN,paddWidth,zippedVec,interpOrInjectionOut);
                                 }
                             #endif
 
@@ -8710,10 +8803,10 @@ namespace ot
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
-                            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                                    for(unsigned int j=(m_uiElementOrder-paddWidth);j<(m_uiElementOrder+1);j++)
-                                        unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+(ej*m_uiElementOrder+j-(m_uiElementOrder-paddWidth))*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                            for(unsigned int k=0;k<(eleOrder+1);k++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
+                                    for(unsigned int j=(eleOrder-paddWidth);j<(eleOrder+1);j++)
+                                        unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+(ej*eleOrder+j-(eleOrder-paddWidth))*(lx)+(ei*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.stop();
@@ -8744,16 +8837,16 @@ namespace ot
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_f_c1.start();
                             #endif
-                            assert(paddWidth<(m_uiElementOrder+1));
-                            this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
+                            assert(paddWidth<(eleOrder+1));
+                            this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
-                            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
+                            for(unsigned int k=0;k<(eleOrder+1);k++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
                                     for(unsigned int j=0;j<(paddWidth+1);j++)
-                                        unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+((ej+1)*m_uiElementOrder+paddWidth+j)*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=lookUpElementVec[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                        unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+((ej+1)*eleOrder+paddWidth+j)*(lx)+(ei*eleOrder+i+paddWidth)]=lookUpElementVec[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.stop();
@@ -8780,11 +8873,11 @@ namespace ot
                             
 
                             #ifdef USE_FD_INTERP_FOR_UNZIP
-                            const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_UP,child.data(),fid,cid);
+                            const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_UP,child,fid,cid);
                             if(st > 0)
                             {
                                 const unsigned int NUM_CHILDREN_BY2 = (NUM_CHILDREN>>1u);
-                                this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec.data(), interpolationInput.data(), interpOrInjectionOut.data(), lookUp, fid, cid,child.data());
+                                this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec, interpolationInput, interpOrInjectionOut, lookUp, fid, cid,child);
                                 for(unsigned int w =0; w < NUM_CHILDREN_BY2 ; w++)
                                 {
                                     assert(pNodes[lookUp] == pNodes[m_uiE2EMapping[child[fid[w]]*m_uiNumDirections + OCT_DIR_UP]]);
@@ -8793,7 +8886,7 @@ namespace ot
                                     if(child[fid[w]]<m_uiElementLocalBegin || child[fid[w]]>=m_uiElementLocalEnd)
                                         continue;
 
-                                    this->parent2ChildInterpolation(lookUpElementVec.data(),interpOrInjectionOut.data(),cid[w],m_uiDim);
+                                    this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cid[w],m_uiDim);
 
 
                                     const ot::Block blk_fd = m_uiLocalBlockList[m_uiE2BlkMap[(child[fid[w]] - m_uiElementLocalBegin)]];
@@ -8810,10 +8903,10 @@ namespace ot
                                     const unsigned int ej_fd = (pNodes[child[fid[w]]].getY()-blkNode_fd.getY())>>(m_uiMaxDepth-regL_fd);
                                     const unsigned int ek_fd = (pNodes[child[fid[w]]].getZ()-blkNode_fd.getZ())>>(m_uiMaxDepth-regL_fd);
                                     
-                                    for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                        for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
+                                    for(unsigned int k=0;k<(eleOrder+1);k++)
+                                        for(unsigned int i=0;i<(eleOrder+1);i++)
                                             for(unsigned int j=0;j<(paddWidth+1);j++)
-                                                unzippedVec[offset_fd+(ek_fd*m_uiElementOrder+k+paddWidth)*(ly_fd*lx_fd)+((ej_fd+1)*m_uiElementOrder+paddWidth+j)*(lx_fd)+(ei_fd*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                                unzippedVec[offset_fd+(ek_fd*eleOrder+k+paddWidth)*(ly_fd*lx_fd)+((ej_fd+1)*eleOrder+paddWidth+j)*(lx_fd)+(ei_fd*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
                                 }
 
                                 
@@ -8821,14 +8914,14 @@ namespace ot
 
                             }
                             #else
-                            this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
-                            this->parent2ChildInterpolation(&(*(lookUpElementVec.begin())),&(*(interpOrInjectionOut.begin())),cnum);
+                            this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
+                            this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cnum);
 
-                            assert(paddWidth<(m_uiElementOrder+1));
-                            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
+                            assert(paddWidth<(eleOrder+1));
+                            for(unsigned int k=0;k<(eleOrder+1);k++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
                                     for(unsigned int j=0;j<(paddWidth+1);j++)
-                                        unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+((ej+1)*m_uiElementOrder+paddWidth+j)*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                        unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+((ej+1)*eleOrder+paddWidth+j)*(lx)+(ei*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #endif
 
@@ -8855,7 +8948,7 @@ namespace ot
                             child[5]=m_uiE2EMapping[child[1]*m_uiNumDirections+OCT_DIR_FRONT];
                             assert(child[5]!=LOOK_UP_TABLE_DEFAULT);
 
-                            if(m_uiElementOrder ==4 && paddWidth==3)
+                            if(eleOrder ==4 && paddWidth==3)
                             {
                                 child[2]=m_uiE2EMapping[child[0]*m_uiNumDirections+OCT_DIR_UP];
                                 child[3]=m_uiE2EMapping[child[1]*m_uiNumDirections+OCT_DIR_UP];
@@ -8874,7 +8967,7 @@ namespace ot
                             
 
 
-                            this->child2ParentInjection(zippedVec,interpOrInjectionOut.data(),child.data(),pNodes[lookUp].getLevel());
+                            this->child2ParentInjection(zippedVec,interpOrInjectionOut,child,pNodes[lookUp].getLevel());
 
                             #ifdef DEBUG_UNZIP_OP_3PT
                                 faceNeighCnum1[0]=0;faceNeighCnum1[1]=1;faceNeighCnum1[2]=4;faceNeighCnum1[3]=5;
@@ -8883,17 +8976,17 @@ namespace ot
 
                                 for(unsigned int index=0;index<(NUM_CHILDREN>>1u);index++)
                                 {
-                                interpUpWind(fd::D1_ORDER_4_UPWIND,elem,child[faceNeighCnum1[index]],&(*(lookUpElementVec.begin())),faceNeighCnum2[index],&(*(parentEleInterpIn.begin())),&(*(parentEleInterpOut.begin())),OCT_DIR_UP,paddWidth,zippedVec,&(*(interpOrInjectionOut.begin())));
+                                interpUpWind(fd::D1_ORDER_4_UPWIND,elem,child[faceNeighCnum1[index]],lookUpElementVec,faceNeighCnum2[index],parentEleInterpIn,parentEleInterpOut,OCT_DIR_UP,paddWidth,zippedVec,interpOrInjectionOut);
                                 }
                             #endif
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
-                            for(unsigned int k=0;k<(m_uiElementOrder+1);k++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
+                            for(unsigned int k=0;k<(eleOrder+1);k++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
                                     for(unsigned int j=0;j<(paddWidth+1);j++)
-                                        unzippedVec[offset+(ek*m_uiElementOrder+k+paddWidth)*(ly*lx)+((ej+1)*m_uiElementOrder+paddWidth+j)*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                        unzippedVec[offset+(ek*eleOrder+k+paddWidth)*(ly*lx)+((ej+1)*eleOrder+paddWidth+j)*(lx)+(ei*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
@@ -8929,16 +9022,16 @@ namespace ot
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_f_c1.start();
                             #endif
-                            assert(paddWidth<(m_uiElementOrder+1));
-                            this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
+                            assert(paddWidth<(eleOrder+1));
+                            this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
-                            for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                                    for(unsigned int k=(m_uiElementOrder-paddWidth);k<(m_uiElementOrder+1);k++)
-                                        unzippedVec[offset+(ek*m_uiElementOrder+k-(m_uiElementOrder-paddWidth))*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=lookUpElementVec[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                            for(unsigned int j=0;j<(eleOrder+1);j++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
+                                    for(unsigned int k=(eleOrder-paddWidth);k<(eleOrder+1);k++)
+                                        unzippedVec[offset+(ek*eleOrder+k-(eleOrder-paddWidth))*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i+paddWidth)]=lookUpElementVec[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.stop();
@@ -8958,7 +9051,7 @@ namespace ot
                             //std::cout<<"elem: "<<elem<<" : "<<m_uiAllElements[elem]<<" lookup: "<<m_uiAllElements[lookUp]<<" child: "<<ot::TreeNode(pNodes[elem].getX()-sz,pNodes[elem].getY(),pNodes[elem].getZ(),pNodes[elem].getLevel(),m_uiDim,m_uiMaxDepth)<<" cnum: "<<cnum<<std::endl;
                             
                             //std::cout<<"m_uiActiveRank : "<<m_uiActiveRank<<"parent to child interpolation executed"<<std::endl;
-                            assert(paddWidth<(m_uiElementOrder+1));
+                            assert(paddWidth<(eleOrder+1));
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
@@ -8966,11 +9059,11 @@ namespace ot
                             
 
                             #ifdef USE_FD_INTERP_FOR_UNZIP
-                            const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_BACK,child.data(),fid,cid);
+                            const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_BACK,child,fid,cid);
                             if(st > 0)
                             {
                                 const unsigned int NUM_CHILDREN_BY2 = (NUM_CHILDREN>>1u);
-                                this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec.data(), interpolationInput.data(), interpOrInjectionOut.data(), lookUp, fid, cid,child.data());
+                                this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec, interpolationInput, interpOrInjectionOut, lookUp, fid, cid,child);
                                 for(unsigned int w =0; w < NUM_CHILDREN_BY2 ; w++)
                                 {
                                     assert(pNodes[lookUp] == pNodes[m_uiE2EMapping[child[fid[w]]*m_uiNumDirections + OCT_DIR_BACK]]);
@@ -8979,7 +9072,7 @@ namespace ot
                                     if(child[fid[w]]<m_uiElementLocalBegin || child[fid[w]]>=m_uiElementLocalEnd)
                                         continue;
                                     
-                                    this->parent2ChildInterpolation(lookUpElementVec.data(),interpOrInjectionOut.data(),cid[w],m_uiDim);
+                                    this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cid[w],m_uiDim);
                                     const ot::Block blk_fd = m_uiLocalBlockList[m_uiE2BlkMap[(child[fid[w]] - m_uiElementLocalBegin)]];
                                     const ot::TreeNode blkNode_fd = blk_fd.getBlockNode();
                                     const unsigned int regL_fd = blk_fd.getRegularGridLev();
@@ -8997,10 +9090,10 @@ namespace ot
                                     const unsigned int ek_fd = (pNodes[child[fid[w]]].getZ()-blkNode_fd.getZ())>>(m_uiMaxDepth-regL_fd);
                                     
 
-                                    for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                    for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                                    for(unsigned int k=(m_uiElementOrder-paddWidth);k<(m_uiElementOrder+1);k++)
-                                        unzippedVec[offset_fd+(ek_fd*m_uiElementOrder+k-(m_uiElementOrder-paddWidth))*(ly_fd*lx_fd)+(ej_fd*m_uiElementOrder+j+paddWidth)*(lx_fd)+(ei_fd*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                    for(unsigned int j=0;j<(eleOrder+1);j++)
+                                    for(unsigned int i=0;i<(eleOrder+1);i++)
+                                    for(unsigned int k=(eleOrder-paddWidth);k<(eleOrder+1);k++)
+                                        unzippedVec[offset_fd+(ek_fd*eleOrder+k-(eleOrder-paddWidth))*(ly_fd*lx_fd)+(ej_fd*eleOrder+j+paddWidth)*(lx_fd)+(ei_fd*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
                                 }
 
                                 
@@ -9008,13 +9101,13 @@ namespace ot
 
                             }
                             #else
-                            this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
-                            this->parent2ChildInterpolation(&(*(lookUpElementVec.begin())),&(*(interpOrInjectionOut.begin())),cnum);
+                            this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
+                            this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cnum);
 
-                            for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                                    for(unsigned int k=(m_uiElementOrder-paddWidth);k<(m_uiElementOrder+1);k++)
-                                        unzippedVec[offset+(ek*m_uiElementOrder+k-(m_uiElementOrder-paddWidth))*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                            for(unsigned int j=0;j<(eleOrder+1);j++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
+                                    for(unsigned int k=(eleOrder-paddWidth);k<(eleOrder+1);k++)
+                                        unzippedVec[offset+(ek*eleOrder+k-(eleOrder-paddWidth))*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #endif
                             
@@ -9040,7 +9133,7 @@ namespace ot
                             child[7]=m_uiE2EMapping[child[5]*m_uiNumDirections+OCT_DIR_UP];
                             assert(child[7]!=LOOK_UP_TABLE_DEFAULT);
 
-                            if(m_uiElementOrder ==4 && paddWidth==3)
+                            if(eleOrder ==4 && paddWidth==3)
                             {
                                 child[0]=m_uiE2EMapping[child[4]*m_uiNumDirections+OCT_DIR_BACK];
                                 child[1]=m_uiE2EMapping[child[5]*m_uiNumDirections+OCT_DIR_BACK];
@@ -9057,7 +9150,7 @@ namespace ot
 
                             
 
-                            this->child2ParentInjection(zippedVec,interpOrInjectionOut.data(),child.data(),pNodes[lookUp].getLevel());
+                            this->child2ParentInjection(zippedVec,interpOrInjectionOut,child,pNodes[lookUp].getLevel());
 
 
                             #ifdef DEBUG_UNZIP_OP_3PT
@@ -9067,7 +9160,7 @@ namespace ot
 
                                 for(unsigned int index=0;index<(NUM_CHILDREN>>1u);index++)
                                 {
-                                    interpDownWind(fd::D1_ORDER_4_DOWNWIND,elem,child[faceNeighCnum1[index]],&(*(lookUpElementVec.begin())),faceNeighCnum2[index],&(*(parentEleInterpIn.begin())),&(*(parentEleInterpOut.begin())),OCT_DIR_BACK,paddWidth,zippedVec,&(*(interpOrInjectionOut.begin())));
+                                    interpDownWind(fd::D1_ORDER_4_DOWNWIND,elem,child[faceNeighCnum1[index]],lookUpElementVec,faceNeighCnum2[index],parentEleInterpIn,parentEleInterpOut,OCT_DIR_BACK,paddWidth,zippedVec,interpOrInjectionOut);
                                 }
                             #endif
 
@@ -9077,10 +9170,10 @@ namespace ot
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
-                            for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
-                                    for(unsigned int k=(m_uiElementOrder-paddWidth);k<(m_uiElementOrder+1);k++)
-                                        unzippedVec[offset+(ek*m_uiElementOrder+k-(m_uiElementOrder-paddWidth))*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                            for(unsigned int j=0;j<(eleOrder+1);j++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
+                                    for(unsigned int k=(eleOrder-paddWidth);k<(eleOrder+1);k++)
+                                        unzippedVec[offset+(ek*eleOrder+k-(eleOrder-paddWidth))*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.stop();
                                 dendro::timer::t_unzip_sync_f_c3.stop();
@@ -9111,16 +9204,16 @@ namespace ot
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_f_c1.start();
                             #endif
-                            assert(paddWidth<(m_uiElementOrder+1));
-                            this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
+                            assert(paddWidth<(eleOrder+1));
+                            this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.start();
                             #endif
-                            for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
+                            for(unsigned int j=0;j<(eleOrder+1);j++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
                                     for(unsigned int k=0;k<(paddWidth+1);k++)
-                                        unzippedVec[offset+((ek+1)*m_uiElementOrder+paddWidth+k)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=lookUpElementVec[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                        unzippedVec[offset+((ek+1)*eleOrder+paddWidth+k)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i+paddWidth)]=lookUpElementVec[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.stop();
@@ -9148,11 +9241,11 @@ namespace ot
                             
 
                             #ifdef USE_FD_INTERP_FOR_UNZIP
-                            const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_FRONT,child.data(),fid,cid);
+                            const int st = this->getBlkBdyParentCNums(blk,elem,OCT_DIR_FRONT,child,fid,cid);
                             if(st > 0)
                             {
                                 const unsigned int NUM_CHILDREN_BY2 = (NUM_CHILDREN>>1u);
-                                this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec.data(), interpolationInput.data(), interpOrInjectionOut.data(), lookUp, fid, cid,child.data());
+                                this->getBlkBoundaryParentNodes(zippedVec, lookUpElementVec, interpolationInput, interpOrInjectionOut, lookUp, fid, cid,child);
                                 for(unsigned int w =0; w < NUM_CHILDREN_BY2 ; w++)
                                 {
                                     assert(pNodes[lookUp] == pNodes[m_uiE2EMapping[child[fid[w]]*m_uiNumDirections + OCT_DIR_FRONT]]);
@@ -9161,7 +9254,7 @@ namespace ot
                                     if(child[fid[w]]<m_uiElementLocalBegin || child[fid[w]]>=m_uiElementLocalEnd)
                                         continue;
                                     
-                                    this->parent2ChildInterpolation(lookUpElementVec.data(),interpOrInjectionOut.data(),cid[w],m_uiDim);
+                                    this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cid[w],m_uiDim);
                                     
                                     const ot::Block blk_fd = m_uiLocalBlockList[m_uiE2BlkMap[(child[fid[w]] - m_uiElementLocalBegin)]];
                                     const ot::TreeNode blkNode_fd = blk_fd.getBlockNode();
@@ -9177,24 +9270,24 @@ namespace ot
                                     const unsigned int ej_fd = (pNodes[child[fid[w]]].getY()-blkNode_fd.getY())>>(m_uiMaxDepth-regL_fd);
                                     const unsigned int ek_fd = (pNodes[child[fid[w]]].getZ()-blkNode_fd.getZ())>>(m_uiMaxDepth-regL_fd);
 
-                                    for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                    for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
+                                    for(unsigned int j=0;j<(eleOrder+1);j++)
+                                    for(unsigned int i=0;i<(eleOrder+1);i++)
                                     for(unsigned int k=0;k<(paddWidth+1);k++)
-                                        unzippedVec[offset_fd+((ek_fd+1)*m_uiElementOrder+paddWidth+k)*(ly_fd*lx_fd)+(ej_fd*m_uiElementOrder+j+paddWidth)*(lx_fd)+(ei_fd*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                        unzippedVec[offset_fd+((ek_fd+1)*eleOrder+paddWidth+k)*(ly_fd*lx_fd)+(ej_fd*eleOrder+j+paddWidth)*(lx_fd)+(ei_fd*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                                 }
 
                                 
                             }
                             #else
-                            this->getElementNodalValues(zippedVec,&(*(lookUpElementVec.begin())),lookUp);
-                            this->parent2ChildInterpolation(&(*(lookUpElementVec.begin())),&(*(interpOrInjectionOut.begin())),cnum);
-                            assert(paddWidth<(m_uiElementOrder+1));
+                            this->getElementNodalValues_p<pOrder>(zippedVec,lookUpElementVec,lookUp);
+                            this->parent2ChildInterpolation(lookUpElementVec,interpOrInjectionOut,cnum);
+                            assert(paddWidth<(eleOrder+1));
 
-                            for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
+                            for(unsigned int j=0;j<(eleOrder+1);j++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
                                     for(unsigned int k=0;k<(paddWidth+1);k++)
-                                        unzippedVec[offset+((ek+1)*m_uiElementOrder+paddWidth+k)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                        unzippedVec[offset+((ek+1)*eleOrder+paddWidth+k)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #endif
 
@@ -9219,7 +9312,7 @@ namespace ot
                             child[3]=m_uiE2EMapping[child[1]*m_uiNumDirections+OCT_DIR_UP];
                             assert(child[3]!=LOOK_UP_TABLE_DEFAULT);
 
-                            if(m_uiElementOrder ==4 && paddWidth==3)
+                            if(eleOrder ==4 && paddWidth==3)
                             {
                                 child[4]=m_uiE2EMapping[child[0]*m_uiNumDirections+OCT_DIR_FRONT];
                                 child[5]=m_uiE2EMapping[child[1]*m_uiNumDirections+OCT_DIR_FRONT];
@@ -9235,7 +9328,7 @@ namespace ot
 
                             }
 
-                            this->child2ParentInjection(zippedVec,interpOrInjectionOut.data(),child.data(),pNodes[lookUp].getLevel());
+                            this->child2ParentInjection(zippedVec,interpOrInjectionOut,child,pNodes[lookUp].getLevel());
 
 
                             #ifdef DEBUG_UNZIP_OP_3PT
@@ -9244,17 +9337,17 @@ namespace ot
 
                                 for(unsigned int index=0;index<(NUM_CHILDREN>>1u);index++)
                                 {
-                                interpUpWind(fd::D1_ORDER_4_UPWIND,elem,child[faceNeighCnum1[index]],&(*(lookUpElementVec.begin())),faceNeighCnum2[index],&(*(parentEleInterpIn.begin())),&(*(parentEleInterpOut.begin())),OCT_DIR_FRONT,paddWidth,zippedVec,&(*(interpOrInjectionOut.begin())));
+                                interpUpWind(fd::D1_ORDER_4_UPWIND,elem,child[faceNeighCnum1[index]],lookUpElementVec,faceNeighCnum2[index],parentEleInterpIn,parentEleInterpOut,OCT_DIR_FRONT,paddWidth,zippedVec,interpOrInjectionOut);
                                 }
                             #endif
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                             dendro::timer::t_unzip_sync_cpy.start();
                             #endif
-                            for(unsigned int j=0;j<(m_uiElementOrder+1);j++)
-                                for(unsigned int i=0;i<(m_uiElementOrder+1);i++)
+                            for(unsigned int j=0;j<(eleOrder+1);j++)
+                                for(unsigned int i=0;i<(eleOrder+1);i++)
                                     for(unsigned int k=0;k<(paddWidth+1);k++)
-                                        unzippedVec[offset+((ek+1)*m_uiElementOrder+paddWidth+k)*(ly*lx)+(ej*m_uiElementOrder+j+paddWidth)*(lx)+(ei*m_uiElementOrder+i+paddWidth)]=interpOrInjectionOut[k*(m_uiElementOrder+1)*(m_uiElementOrder+1)+j*(m_uiElementOrder+1)+i];
+                                        unzippedVec[offset+((ek+1)*eleOrder+paddWidth+k)*(ly*lx)+(ej*eleOrder+j+paddWidth)*(lx)+(ei*eleOrder+i+paddWidth)]=interpOrInjectionOut[k*(eleOrder+1)*(eleOrder+1)+j*(eleOrder+1)+i];
 
                             #ifdef ENABLE_DENDRO_PROFILE_COUNTERS
                                 dendro::timer::t_unzip_sync_cpy.stop();
@@ -9296,9 +9389,9 @@ namespace ot
 
         }
 
-        if(m_uiElementOrder ==4 && paddWidth==3)
+        if(eleOrder ==4 && paddWidth==3)
         {
-            //std::cout<<"read spt points : "<<m_uiElementOrder<<" pwidth : "<<paddWidth<<std::endl;
+            //std::cout<<"read spt points : "<<eleOrder<<" pwidth : "<<paddWidth<<std::endl;
             std::vector<T> recv_buf;
             recv_buf.resize(m_uiRecvOffsetRePt[m_uiActiveNpes-1] + m_uiRecvCountRePt[m_uiActiveNpes-1]);
 
@@ -6,6 +6,7 @@
 #define SFCSORTBENCH_OCTUTILS_H
 
 #include "key.h"
+#include "keyCSR.h"
 #include "sfcSearch.h"
 #include "sfcSort.h"
 #include "dendro.h"
@@ -172,6 +173,13 @@ void genEdgeSearchKeys(const T& elem,std::vector<ot::SearchKey>& sKeys);
  * */
 void mergeKeys(std::vector<ot::SearchKey>& sKeys,std::vector<ot::Key>& keys);
 
+/**
+ * @param [in] sKeys: Generated SearchKeys
+ * @param [out] keys; Merged keys, owners stored in CSR form (no per key allocations).
+ *
+ * */
+void mergeKeys(std::vector<ot::SearchKey>& sKeys,ot::KeyCSR& keys);
+
 
 
 /**@brief : Generates the edge keys for each block. */
@@ -211,9 +219,11 @@ void partitionBasedOnSplitters(std::vector<T>& pNodes, const T* splitters, unsig
  * @param[in] in: input octree
  * @param[in] comm1: Number of partitions needed. (or after this method input octree is going to end up in comm1)
  * @para[in] comm2: current communicator.
+ * @param[in] getWeight: octant weight function for the partition (NULL: no weighted partition)
+ * @param[in] getConstraint: octant constraint (level) function, if not NULL the multi-constraint partition (par::partitionWMC) is used instead of the weights.
  * */
 template <typename T>
-void shrinkOrExpandOctree(std::vector<T> & in,const double ld_tol,const unsigned int sf_k,bool isActive,MPI_Comm activeComm, MPI_Comm globalComm,unsigned int (*getWeight)(const ot::TreeNode *)=NULL);
+void shrinkOrExpandOctree(std::vector<T> & in,const double ld_tol,const unsigned int sf_k,bool isActive,MPI_Comm activeComm, MPI_Comm globalComm,unsigned int (*getWeight)(const ot::TreeNode *)=NULL,unsigned int (*getConstraint)(const ot::TreeNode *)=NULL);
 
 
 /**
@@ -263,12 +273,12 @@ void computeSFCBucketSplitters(const T *pNodes, int lev, unsigned int maxDepth,u
         // Special Case when the considering level exceeds the max depth.
 
         for (int ii = 0; ii < NUM_CHILDREN; ii++) {
-            int index = (rotations[2 * NUM_CHILDREN * rot_id + ii] - '0');
+            int index = (SFC::ROT_PERM[rot_id][ii]);
             int nextIndex = 0;
             if (ii == (NUM_CHILDREN-1))
                 nextIndex = ii + 1;
             else
-                nextIndex = (rotations[2 * NUM_CHILDREN * rot_id + ii + 1] - '0');
+                nextIndex = (SFC::ROT_PERM[rot_id][ii + 1]);
 
             if (ii == 0) {
                 splitters[index] = begin;
@@ -311,12 +321,12 @@ void computeSFCBucketSplitters(const T *pNodes, int lev, unsigned int maxDepth,u
     //if(count[1]>0) std::cout<<"For rank: "<<rank<<" count [1]:  "<<count[1]<<std::endl;
 
     for (unsigned int ii = 0; ii < NUM_CHILDREN; ii++) {
-        int index = (rotations[2 * NUM_CHILDREN * rot_id + ii] - '0');
+        int index = (SFC::ROT_PERM[rot_id][ii]);
         int nextIndex = 0;
         if (ii == (NUM_CHILDREN-1))
             nextIndex = ii + 1;
         else
-            nextIndex = (rotations[2 * NUM_CHILDREN * rot_id + ii + 1] - '0');
+            nextIndex = (SFC::ROT_PERM[rot_id][ii + 1]);
 
         if (ii == 0) {
             splitters[index] = begin;
@@ -587,7 +597,7 @@ bool linearSearch(const T * pNodes, const T& key,unsigned int n,unsigned int sWi
 
 
 template <typename T>
-void shrinkOrExpandOctree(std::vector<T> & in,const double ld_tol,const unsigned int sf_k,bool isActive,MPI_Comm activeComm, MPI_Comm globalComm,unsigned int (*getWeight)(const ot::TreeNode *))
+void shrinkOrExpandOctree(std::vector<T> & in,const double ld_tol,const unsigned int sf_k,bool isActive,MPI_Comm activeComm, MPI_Comm globalComm,unsigned int (*getWeight)(const ot::TreeNode *),unsigned int (*getConstraint)(const ot::TreeNode *))
 {
 
     int rank_g,npes_g;
@@ -659,7 +669,9 @@ void shrinkOrExpandOctree(std::vector<T> & in,const double ld_tol,const unsigned
         SFC::parSort::SFC_treeSort(in,recvBuf,recvBuf,recvBuf,ld_tol,m_uiMaxDepth,rootTN,ROOT_ROTATION,1,TS_REMOVE_DUPLICATES,sf_k,activeComm);
         std::swap(in,recvBuf);
         recvBuf.clear();
-        if(getWeight!=NULL ) 
+        if(getConstraint!=NULL)
+            par::partitionWMC(in,getConstraint,m_uiMaxDepth+1,activeComm);
+        else if(getWeight!=NULL ) 
             par::partitionW(in,getWeight,activeComm);
         assert(par::test::isUniqueAndSorted(in,activeComm));
     }
@@ -27,6 +27,11 @@
 #ifndef KWAY
 #define KWAY 128
 #endif
+
+#ifndef NBX_TAG
+// base tag of the sparse dynamic data exchange (two tags are used, NBX_TAG and NBX_TAG+1)
+#define NBX_TAG 32000
+#endif
 /** @brief: data structure to compute parallel rank*/
 template<typename T>
 struct _T{ 
@@ -416,6 +421,38 @@ template <typename T>
 int Mpi_Alltoallv_Kway(T *sbuff_, int *s_cnt_, int *sdisp_,
                        T *rbuff_, int *r_cnt_, int *rdisp_, MPI_Comm c);
 
+/**
+ * @brief returns the tag for the next NBX exchange on comm. Consecutive calls on the same communicator alternate between 
+ * two tags, so that messages of the next exchange are not received by ranks still completing the current one. 
+ * (the call counter is cached as a communicator attribute)
+ */
+int nbxTag(MPI_Comm comm);
+
+/**
+ * @brief Sparse dynamic data exchange (non-blocking consensus, NBX) of Hoefler et al. Only the send counts are needed, 
+ * the senders are discovered with MPI_Issend + MPI_Ibarrier, hence there is no O(p) count exchange. 
+ * @param[in] sendbuf: send buffer
+ * @param[in] sendcnts: send counts (size npes)
+ * @param[in] sdispls: send offsets (size npes)
+ * @param[out] recvbuf: received data ordered by the source rank (resized)
+ * @param[out] recvcnts: recv counts (size npes)
+ * @param[out] rdispls: recv offsets (size npes)
+ * @param[in] comm: communicator
+ */
+template <typename T>
+int Mpi_Alltoallv_NBX(const T *sendbuf, const int *sendcnts, const int *sdispls,
+                      std::vector<T> &recvbuf, int *recvcnts, int *rdispls, MPI_Comm comm);
+
+/**
+ * @brief Alltoall of a single value per rank using NBX, where zero values are not communicated (i.e. the count array of a 
+ * sparse exchange). 
+ * @param[in] sendbuf: send values (size npes)
+ * @param[out] recvbuf: recv values (size npes)
+ * @param[in] comm: communicator
+ */
+template <typename T>
+int Mpi_Alltoall_NBX(const T *sendbuf, T *recvbuf, MPI_Comm comm);
+
 /**
     @brief Re-distributes a STL vector, preserving the relative ordering of the
     elements. 
@@ -466,6 +503,20 @@ template <typename T>
 int partitionW(std::vector<T> &vec,
                unsigned int (*getWeight)(const T *), MPI_Comm comm);
 
+/**
+    @brief A parallel multi-constraint partitioning function. Each element belongs to one of numConstraints 
+    constraints (e.g. the octant level). Each splitter minimizes the sum of the squared imbalances of the 
+    constraints (relative to the average count per proc.), i.e. each constraint is partitioned (as well as possible) 
+    separately while the relative ordering of the elements is preserved. 
+    @param vec the input vector
+    @param getConstraint function pointer which returns the constraint id of an element (< numConstraints)
+    @param numConstraints number of constraints
+    @param comm the communicator
+    */
+template <typename T>
+int partitionWMC(std::vector<T> &vec,
+                 unsigned int (*getConstraint)(const T *), unsigned int numConstraints, MPI_Comm comm);
+
 /**
     @brief A parallel concatenation function. listB is appended (globally)
     to listA and the result is stored in listA. An useful  application
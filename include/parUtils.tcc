@@ -18,6 +18,8 @@
 #include "ompUtils.h"
 #include "TreeNode.h"
 #include <chrono>
+#include <cmath>
+#include <limits>
 #include <assert.h>
 
 #include "treenode2vtk.h"
@@ -401,6 +403,112 @@ int Mpi_Alltoallv_sparse(T *sendbuf, int *sendcnts, int *sdispls,
   PROF_PAR_ALL2ALLV_SPARSE_END
 }
 
+template <typename T>
+int Mpi_Alltoallv_NBX(const T *sendbuf, const int *sendcnts, const int *sdispls,
+                      std::vector<T> &recvbuf, int *recvcnts, int *rdispls, MPI_Comm comm)
+{
+  int npes, rank;
+  MPI_Comm_size(comm, &npes);
+  MPI_Comm_rank(comm, &rank);
+
+  const int tag = par::nbxTag(comm);
+
+  // synchronous sends, completion means the message is matched on the receiver.
+  std::vector<MPI_Request> sendReqs;
+  for (int p = 0; p < npes; p++)
+  {
+    if (p == rank || sendcnts[p] == 0)
+      continue;
+    sendReqs.push_back(MPI_REQUEST_NULL);
+    par::Mpi_Issend<T>((T *)&(sendbuf[sdispls[p]]), sendcnts[p], p, tag, comm, &sendReqs.back());
+  }
+
+  // received messages (source, data) in the arrival order.
+  std::vector<int> recvSrc;
+  std::vector<std::vector<T>> recvData;
+
+  MPI_Request barrier = MPI_REQUEST_NULL;
+  bool isBarrierActive = false;
+  int isDone = 0;
+
+  while (!isDone)
+  {
+    int flag;
+    MPI_Status status;
+    MPI_Iprobe(MPI_ANY_SOURCE, tag, comm, &flag, &status);
+    if (flag)
+    {
+      int count;
+      MPI_Get_count(&status, par::Mpi_datatype<T>::value(), &count);
+      recvSrc.push_back(status.MPI_SOURCE);
+      recvData.push_back(std::vector<T>(count));
+      par::Mpi_Recv<T>(recvData.back().data(), count, status.MPI_SOURCE, tag, comm, MPI_STATUS_IGNORE);
+    }
+
+    if (isBarrierActive)
+    {
+      MPI_Test(&barrier, &isDone, MPI_STATUS_IGNORE);
+    }
+    else
+    {
+      int isSent;
+      MPI_Testall(sendReqs.size(), sendReqs.data(), &isSent, MPI_STATUSES_IGNORE);
+      if (isSent)
+      {
+        MPI_Ibarrier(comm, &barrier);
+        isBarrierActive = true;
+      }
+    }
+  }
+
+  for (int p = 0; p < npes; p++)
+    recvcnts[p] = 0;
+
+  recvcnts[rank] = sendcnts[rank];
+  for (unsigned int i = 0; i < recvSrc.size(); i++)
+    recvcnts[recvSrc[i]] = recvData[i].size();
+
+  rdispls[0] = 0;
+  for (int p = 1; p < npes; p++)
+    rdispls[p] = rdispls[p - 1] + recvcnts[p - 1];
+
+  recvbuf.resize(rdispls[npes - 1] + recvcnts[npes - 1]);
+
+  for (int i = 0; i < sendcnts[rank]; i++)
+    recvbuf[rdispls[rank] + i] = sendbuf[sdispls[rank] + i];
+
+  for (unsigned int i = 0; i < recvSrc.size(); i++)
+    std::copy(recvData[i].begin(), recvData[i].end(), recvbuf.begin() + rdispls[recvSrc[i]]);
+
+  return 0;
+}
+
+template <typename T>
+int Mpi_Alltoall_NBX(const T *sendbuf, T *recvbuf, MPI_Comm comm)
+{
+  int npes, rank;
+  MPI_Comm_size(comm, &npes);
+  MPI_Comm_rank(comm, &rank);
+
+  std::vector<int> sendcnts(npes, 0);
+  std::vector<int> sdispls(npes);
+  for (int p = 0; p < npes; p++)
+  {
+    sendcnts[p] = (sendbuf[p] != T(0)) ? 1 : 0;
+    sdispls[p] = p;
+  }
+
+  std::vector<T> recvVal;
+  std::vector<int> recvcnts(npes);
+  std::vector<int> rdispls(npes);
+  par::Mpi_Alltoallv_NBX(sendbuf, sendcnts.data(), sdispls.data(), recvVal, recvcnts.data(), rdispls.data(), comm);
+
+  for (int p = 0; p < npes; p++)
+    recvbuf[p] = (recvcnts[p]) ? recvVal[rdispls[p]] : T(0);
+
+  return 0;
+}
+
 template <typename T>
 int Mpi_Alltoallv_dense(T *sendbuf, int *sendcnts, int *sdispls,
                         T *recvbuf, int *recvcnts, int *rdispls, MPI_Comm comm)
@@ -1788,6 +1896,201 @@ int partitionW(std::vector<T> &nodeList, unsigned int (*getWeight)(const T *), M
   PROF_PARTW_END
 } //end function
 
+template <typename T>
+int partitionWMC(std::vector<T> &nodeList, unsigned int (*getConstraint)(const T *), unsigned int numConstraints, MPI_Comm comm)
+{
+#ifdef __PROFILE_WITH_BARRIER__
+  MPI_Barrier(comm);
+#endif
+  PROF_PARTW_BEGIN
+
+  int npes, rank;
+  MPI_Comm_size(comm, &npes);
+  MPI_Comm_rank(comm, &rank);
+
+  if (npes == 1 || numConstraints == 0)
+  {
+    PROF_PARTW_END
+  }
+
+  const unsigned int nc = numConstraints;
+  const DendroIntL nlSize = nodeList.size();
+
+  // constraint of each element, local & global counts by constraint.
+  std::vector<unsigned int> cid(nlSize);
+  std::vector<DendroIntL> lCount(nc + 1, 0);
+  std::vector<DendroIntL> cOffset(nc + 1, 0);
+  std::vector<DendroIntL> gCount(nc + 1, 0);
+
+  for (DendroIntL i = 0; i < nlSize; i++)
+  {
+    cid[i] = (*getConstraint)(&(nodeList[i]));
+    assert(cid[i] < nc);
+    lCount[cid[i]]++;
+  }
+
+  // last entry is the element count.
+  lCount[nc] = nlSize;
+  par::Mpi_Scan<DendroIntL>(lCount.data(), cOffset.data(), nc + 1, MPI_SUM, comm);
+  par::Mpi_Allreduce<DendroIntL>(lCount.data(), gCount.data(), nc + 1, MPI_SUM, comm);
+
+  for (unsigned int c = 0; c <= nc; c++)
+    cOffset[c] -= lCount[c];
+
+  // active constraints and their per proc. share (a share below one element is rounded to one).
+  std::vector<unsigned int> cActive;
+  std::vector<double> cShare(nc, 1.0);
+  for (unsigned int c = 0; c < nc; c++)
+  {
+    if (gCount[c] == 0)
+      continue;
+    cActive.push_back(c);
+    cShare[c] = std::max(1.0, (double)gCount[c] / npes);
+  }
+
+  // best splitter (global element index) of each proc, and the imbalance for it.
+  std::vector<double> bestCost(npes, std::numeric_limits<double>::max());
+  std::vector<DendroIntL> bestPos(npes, std::numeric_limits<DendroIntL>::max());
+
+  if (nlSize)
+  {
+    // with u_c = prefix_c / share_c and r_c = (gCount_c / npes) / share_c the imbalance of the splitter k at position p is
+    // sum_c (u_c(p) - k r_c)^2 = A(p) - 2k B(p) + k^2 C, i.e. a line in k for each position. B(p) strictly increases with p,
+    // hence the best position of every k is found on the lower envelope of the lines in O(nlSize nc + npes).
+    struct SplitLine
+    {
+      DendroIntL i;
+      double a;
+      double b;
+    };
+
+    std::vector<double> r(nc, 0.0);
+    for (unsigned int a = 0; a < cActive.size(); a++)
+      r[cActive[a]] = ((double)gCount[cActive[a]] / npes) / cShare[cActive[a]];
+
+    std::vector<SplitLine> hull;
+    std::vector<DendroIntL> prefix(cOffset.begin(), cOffset.begin() + nc);
+    for (DendroIntL i = 0; i <= nlSize; i++)
+    {
+      // splitter before the local element i, (prefix holds the global counts of the elements before it)
+      SplitLine l;
+      l.i = i;
+      l.a = 0;
+      l.b = 0;
+      for (unsigned int a = 0; a < cActive.size(); a++)
+      {
+        const unsigned int c = cActive[a];
+        const double u = prefix[c] / cShare[c];
+        l.a += u * u;
+        l.b += r[c] * u;
+      }
+
+      // the middle line is not on the envelope if the new line crosses the first one before the middle one does.
+      while (hull.size() >= 2)
+      {
+        const SplitLine &l1 = hull[hull.size() - 2];
+        const SplitLine &l2 = hull[hull.size() - 1];
+        if ((l.a - l1.a) * (l2.b - l1.b) <= (l2.a - l1.a) * (l.b - l1.b))
+          hull.pop_back();
+        else
+          break;
+      }
+      hull.push_back(l);
+
+      if (i < nlSize)
+        prefix[cid[i]]++;
+    }
+
+    // queries in increasing k, (ties keep the smaller position)
+    std::vector<std::pair<DendroIntL, int>> kPos;
+    kPos.reserve(npes);
+    unsigned int h = 0;
+    for (int k = 1; k < npes; k++)
+    {
+      while (h + 1 < hull.size() && (hull[h + 1].a - 2.0 * k * hull[h + 1].b) < (hull[h].a - 2.0 * k * hull[h].b))
+        h++;
+      kPos.push_back(std::make_pair(hull[h].i, k));
+    }
+
+    // imbalance of the selected positions from the counts, (same value on every proc for the same position)
+    std::sort(kPos.begin(), kPos.end());
+    std::copy(cOffset.begin(), cOffset.begin() + nc, prefix.begin());
+    DendroIntL i = 0;
+    for (unsigned int q = 0; q < kPos.size(); q++)
+    {
+      for (; i < kPos[q].first; i++)
+        prefix[cid[i]]++;
+
+      const int k = kPos[q].second;
+      double cost = 0;
+      for (unsigned int a = 0; a < cActive.size(); a++)
+      {
+        const unsigned int c = cActive[a];
+        const double d = (prefix[c] - ((double)k * gCount[c]) / npes) / cShare[c];
+        cost += d * d;
+      }
+
+      bestCost[k] = cost;
+      bestPos[k] = cOffset[nc] + kPos[q].first;
+    }
+  }
+
+  // global best, ties are resolved by the smallest splitter.
+  std::vector<double> gBestCost(npes);
+  std::vector<DendroIntL> splitter(npes);
+  par::Mpi_Allreduce<double>(bestCost.data(), gBestCost.data(), npes, MPI_MIN, comm);
+  for (int k = 0; k < npes; k++)
+    if (bestCost[k] != gBestCost[k])
+      bestPos[k] = std::numeric_limits<DendroIntL>::max();
+  par::Mpi_Allreduce<DendroIntL>(bestPos.data(), splitter.data(), npes, MPI_MIN, comm);
+
+  splitter[0] = 0;
+  for (int k = 1; k < npes; k++)
+  {
+    if (splitter[k] > gCount[nc])
+      splitter[k] = gCount[nc];
+    splitter[k] = std::max(splitter[k], splitter[k - 1]);
+  }
+
+  int *sendSz = new int[npes];
+  int *recvSz = new int[npes];
+  int *sendOff = new int[npes];
+  int *recvOff = new int[npes];
+
+  for (int k = 0; k < npes; k++)
+    sendSz[k] = 0;
+
+  for (DendroIntL i = 0; i < nlSize; i++)
+  {
+    const int k = (std::upper_bound(splitter.begin() + 1, splitter.end(), cOffset[nc] + i) - splitter.begin()) - 1;
+    sendSz[k]++;
+  }
+
+  par::Mpi_Alltoall<int>(sendSz, recvSz, 1, comm);
+
+  sendOff[0] = 0;
+  recvOff[0] = 0;
+  omp_par::scan(sendSz, sendOff, npes);
+  omp_par::scan(recvSz, recvOff, npes);
+
+  std::vector<T> newNodes(recvOff[npes - 1] + recvSz[npes - 1]);
+  T *nodeListPtr = nodeList.empty() ? NULL : &(*(nodeList.begin()));
+  T *newNodesPtr = newNodes.empty() ? NULL : &(*(newNodes.begin()));
+
+  par::Mpi_Alltoallv_sparse<T>(nodeListPtr, sendSz, sendOff,
+                               newNodesPtr, recvSz, recvOff, comm);
+
+  swap(nodeList, newNodes);
+  newNodes.clear();
+
+  delete[] sendSz;
+  delete[] sendOff;
+  delete[] recvSz;
+  delete[] recvOff;
+
+  PROF_PARTW_END
+} //end function
+
 /*template<typename T>
   int removeDuplicates(std::vector<T> &vecT, bool isSorted, MPI_Comm comm) {
 #ifdef __PROFILE_WITH_BARRIER__
@@ -21,12 +21,22 @@
 
 #include <omp.h>
 
+/**@brief: max. number of threads with their own start time inside parallel regions, start/stop of the other threads are ignored. */
+#ifndef PROFILER_MAX_THREADS
+    #define PROFILER_MAX_THREADS 256
+#endif
+
 class profiler_t
 {
     public:
         profiler_t ();
         virtual ~profiler_t ();
 
+        /**
+         * @brief: inside a parallel region every thread times its own start/stop pair and the elapsed time is added to the timer, 
+         * i.e. timers of concurrent block kernels report the summed thread time (not the wall time). Flops are not counted inside 
+         * parallel regions. 
+         */
         void start();
         void stop();
         void clear();
@@ -44,6 +54,7 @@ class profiler_t
         protected:
             long double	  _pri_seconds;  // openmp wall time
             long long _pri_p_flpops; // papi floating point operations
+            double _pri_thread_seconds[PROFILER_MAX_THREADS]; // start time of each thread inside parallel regions
 
 };
 
@@ -5,6 +5,9 @@
 #ifndef SFCSORTBENCH_RADIX_H
 #define SFCSORTBENCH_RADIX_H
 
+#include <vector>
+#include <algorithm>
+
 // A utility function to get maximum value in arr[]
 template <typename T>
 inline T getMax(T* arr, int n)
@@ -61,5 +64,68 @@ void radixsort(T* arr, int n)
         countSort(arr, n, exp);
 }
 
+// LSD radix sort of (key,value) pairs, (8 bit digits) of unsigned integer keys (including unsigned __int128).
+// Only the lower numBits of the keys are considered. Sort is stable, and passes where all the keys share the
+// same digit are skipped.
+template <typename K, typename V>
+void radixSortPairs(K* keys, V* vals, long long n, unsigned int numBits)
+{
+    if(n<=1) return;
+
+    const unsigned int RADIX_BITS=8;
+    const unsigned int RADIX=(1u<<RADIX_BITS);
+    const unsigned int numPasses=(numBits+RADIX_BITS-1)/RADIX_BITS;
+
+    std::vector<K> keysTmp(n);
+    std::vector<V> valsTmp(n);
+
+    K* kIn=keys;
+    V* vIn=vals;
+    K* kOut=&(*(keysTmp.begin()));
+    V* vOut=&(*(valsTmp.begin()));
+
+    long long count[RADIX];
+    unsigned int digit;
+
+    for(unsigned int pass=0;pass<numPasses;pass++)
+    {
+        const unsigned int shift=pass*RADIX_BITS;
+        std::fill(count,count+RADIX,0);
+
+        for(long long i=0;i<n;i++)
+            count[(unsigned int)((kIn[i]>>shift) & (RADIX-1))]++;
+
+        // all the keys have the same digit, nothing to do in this pass.
+        if(count[(unsigned int)((kIn[0]>>shift) & (RADIX-1))]==n)
+            continue;
+
+        long long sum=0;
+        for(unsigned int b=0;b<RADIX;b++)
+        {
+            const long long c=count[b];
+            count[b]=sum;
+            sum+=c;
+        }
+
+        for(long long i=0;i<n;i++)
+        {
+            digit=(unsigned int)((kIn[i]>>shift) & (RADIX-1));
+            kOut[count[digit]]=kIn[i];
+            vOut[count[digit]]=vIn[i];
+            count[digit]++;
+        }
+
+        std::swap(kIn,kOut);
+        std::swap(vIn,vOut);
+    }
+
+    if(kIn!=keys)
+    {
+        std::copy(kIn,kIn+n,keys);
+        std::copy(vIn,vIn+n,vals);
+    }
+
+}
+
 
 #endif //SFCSORTBENCH_RADIX_H
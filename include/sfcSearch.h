@@ -17,6 +17,15 @@
 #include "sfcSort.h"
 #include "dendro.h"
 #include "TreeNode.h"
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief number of query keys resolved by a thread with a single merge scan in the batched tree search.
+ * */
+#ifndef SFC_SEARCH_BATCH_CHUNK
+    #define SFC_SEARCH_BATCH_CHUNK 2048
+#endif
 
 
 namespace  SFC
@@ -54,6 +63,59 @@ namespace  SFC
         void SFC_treeSearch(TKey* pKeys , TOctant* pNodes,DendroIntL nKeyBegin,DendroIntL nKeyEnd,DendroIntL nNodeBegin,DendroIntL nNodeEnd,unsigned int pMaxDepthBit,unsigned int pMaxDepth, unsigned int rot_id);
 
 
+        /**
+         * @brief Batched search of pKeys in the octant array pNodes.
+         * Assumptions: pNodes must be sorted, unique and non overlapping (i.e. a linear octree, elements of the mesh). pKeys
+         * are expected to be sorted, in which case each thread resolves a chunk of keys with a single merge scan over the
+         * packed SFC keys of the octants. Unsorted keys are still correct, (the scan falls back to a binary search whenever the
+         * key goes backwards in the SFC order). pKeys are not reordered.
+         * @param[in] pKeys : keys to search
+         * @param[in] nKeys : number of keys
+         * @param[in] pNodes : octants to search in
+         * @param[in] nNodes : number of octants
+         * @param[out] pResult : preallocated array of size nKeys, index of the octant which is equal to or an ancestor of each key, LOOK_UP_TABLE_DEFAULT if the key is not found.
+         * @param[in] pMaxDepth : maximum depth of the tree
+         * */
+        template <typename TKey, typename TOctant>
+        void SFC_treeSearchBatched(const TKey* pKeys, DendroIntL nKeys, const TOctant* pNodes, DendroIntL nNodes, unsigned int* pResult, unsigned int pMaxDepth);
+
+
+        /**
+         * @brief Same as SFC_treeSearch (flags the found keys with OCT_FOUND and sets the search result) but uses the batched
+         * search. pNodes[nNodeBegin:nNodeEnd) must be a linear octree, (unique and non overlapping).
+         * */
+        template <typename TKey, typename TOctant>
+        void SFC_treeSearchBatched(TKey* pKeys , const TOctant* pNodes,DendroIntL nKeyBegin,DendroIntL nKeyEnd,DendroIntL nNodeBegin,DendroIntL nNodeEnd,unsigned int pMaxDepth);
+
+
+        /**
+         * @brief packed SFC keys (SFC_key) of the octants pNodes[0:nNodes). The keys can be computed once and passed to all the
+         * batched searches over the same octants.
+         * @param[in] pNodes : sorted octants
+         * @param[in] nNodes : number of octants
+         * @param[in] pMaxDepth : maximum depth of the tree
+         * @param[out] nodeKeys : SFC keys of the octants
+         * */
+        template <typename TOctant>
+        void SFC_octantKeys(const TOctant* pNodes, DendroIntL nNodes, unsigned int pMaxDepth, std::vector<uint128_t>& nodeKeys);
+
+
+        /**
+         * @brief Batched search with the precomputed SFC keys of the octants (see SFC_octantKeys), nodeKeys[0:nNodes). The cost
+         * is O(nKeys log(nNodes)), hence small key sets (e.g. the keys of a single block) do not pay for the octant keys.
+         * */
+        template <typename TKey>
+        void SFC_treeSearchBatched(const TKey* pKeys, DendroIntL nKeys, const uint128_t* nodeKeys, DendroIntL nNodes, unsigned int* pResult, unsigned int pMaxDepth);
+
+
+        /**
+         * @brief Same as above, but flags the found keys with OCT_FOUND and sets the search result. nodeKeys[i] is the key of
+         * the octant i, the search is restricted to the octants [nNodeBegin, nNodeEnd).
+         * */
+        template <typename TKey>
+        void SFC_treeSearchBatched(TKey* pKeys , const uint128_t* nodeKeys,DendroIntL nKeyBegin,DendroIntL nKeyEnd,DendroIntL nNodeBegin,DendroIntL nNodeEnd,unsigned int pMaxDepth);
+
+
         /** @author Milinda Fernando
          *  @breif Performs sequential tree search oof pKeys in the octree pNodes.
          *  Assumptions: pNodes can be sorted or unsorted, but pNodes must be unique. If some keys were not found they need to be sent to the correst processor using par::treeSort.
@@ -72,8 +134,8 @@ namespace  SFC
             unsigned int hindexN = 0;
             unsigned int index = 0;
 
-            hindex = (rotations[2 * NUM_CHILDREN * rot_id] - '0');
-            hindexN = (rotations[2 * NUM_CHILDREN * rot_id +1] - '0');
+            hindex = (SFC::ROT_PERM[rot_id][0]);
+            hindexN = (SFC::ROT_PERM[rot_id][1]);
 
             SFC::seqSort::SFC_bucketing(pKeys,lev,pMaxDepth,rot_id,nKeyBegin,nKeyEnd,splitterKeys);
             SFC::seqSort::SFC_bucketing(pNodes,lev,pMaxDepth,rot_id,nNodeBegin,nNodeEnd,splitterNodes);
@@ -92,16 +154,16 @@ namespace  SFC
                     }*/
 
                 for (int i = 0; i < NUM_CHILDREN; i++) {
-                    hindex = (rotations[2 * NUM_CHILDREN * rot_id + i] - '0');
+                    hindex = (SFC::ROT_PERM[rot_id][i]);
                     if (i == (NUM_CHILDREN - 1))
                         hindexN = i + 1;
                     else
-                        hindexN = (rotations[2 * NUM_CHILDREN * rot_id + i + 1] - '0');
+                        hindexN = (SFC::ROT_PERM[rot_id][i + 1]);
 
                     assert(splitterKeys[hindex] <= splitterKeys[hindexN]);
                     assert(splitterNodes[hindex] <= splitterNodes[hindexN]);
 
-                    index = HILBERT_TABLE[NUM_CHILDREN * rot_id + hindex];
+                    index = SFC::ROT_NEXT[rot_id][hindex];
                     SFC_treeSearch(pKeys,pNodes,pSearchIndex,splitterKeys[hindex],splitterKeys[hindexN],splitterNodes[hindex],splitterNodes[hindexN],(pMaxDepthBit-1),pMaxDepth,index);
 
                 }
@@ -149,16 +211,16 @@ namespace  SFC
 
 
                 for (int i = 0; i < NUM_CHILDREN; i++) {
-                    hindex = (rotations[2 * NUM_CHILDREN * rot_id + i] - '0');
+                    hindex = (SFC::ROT_PERM[rot_id][i]);
                     if (i == (NUM_CHILDREN - 1))
                         hindexN = i + 1;
                     else
-                        hindexN = (rotations[2 * NUM_CHILDREN * rot_id + i + 1] - '0');
+                        hindexN = (SFC::ROT_PERM[rot_id][i + 1]);
 
                     assert(splitterKeys[hindex] <= splitterKeys[hindexN]);
                     assert(splitterNodes[hindex] <= splitterNodes[hindexN]);
 
-                    index = HILBERT_TABLE[NUM_CHILDREN * rot_id + hindex];
+                    index = SFC::ROT_NEXT[rot_id][hindex];
                     if(splitterNodes[hindex]!=splitterNodes[hindexN]) SFC_treeSearch(pKeys,pNodes,splitterKeys[hindex],splitterKeys[hindexN],splitterNodes[hindex],splitterNodes[hindexN],(pMaxDepthBit-1),pMaxDepth,index);
 
                 }
@@ -216,6 +278,137 @@ namespace  SFC
 
 
 
+        template <typename TOctant>
+        void SFC_octantKeys(const TOctant* pNodes, DendroIntL nNodes, unsigned int pMaxDepth, std::vector<uint128_t>& nodeKeys)
+        {
+            nodeKeys.resize(std::max(nNodes,(DendroIntL)0));
+
+            const bool isThreaded=(nNodes>=SFC_TREESORT_TASK_CUTOFF) && (!omp_in_parallel()) && (omp_get_max_threads()>1);
+
+            // packed SFC keys of the octants (ancestors before descendants, hence same order as pNodes)
+            #pragma omp parallel for schedule(static) if(isThreaded)
+            for(DendroIntL j=0;j<nNodes;j++)
+                nodeKeys[j]=SFC::seqSort::SFC_key(pNodes[j],pMaxDepth);
+
+            assert(std::is_sorted(nodeKeys.begin(),nodeKeys.end()));
+
+        }
+
+
+        template <typename TKey>
+        void SFC_treeSearchBatched(const TKey* pKeys, DendroIntL nKeys, const uint128_t* nodeKeys, DendroIntL nNodes, unsigned int* pResult, unsigned int pMaxDepth)
+        {
+            if(nKeys<=0) return;
+
+            if(nNodes<=0)
+            {
+                for(DendroIntL i=0;i<nKeys;i++)
+                    pResult[i]=LOOK_UP_TABLE_DEFAULT;
+                return;
+            }
+
+            const bool isThreaded=(nKeys>=SFC_TREESORT_TASK_CUTOFF) && (!omp_in_parallel()) && (omp_get_max_threads()>1);
+
+            const uint128_t* nKeyPtr=nodeKeys;
+            const DendroIntL numChunks=(nKeys-1)/SFC_SEARCH_BATCH_CHUNK+1;
+
+            #pragma omp parallel for schedule(dynamic) if(isThreaded)
+            for(DendroIntL c=0;c<numChunks;c++)
+            {
+                const DendroIntL kBegin=c*SFC_SEARCH_BATCH_CHUNK;
+                const DendroIntL kEnd=std::min(kBegin+SFC_SEARCH_BATCH_CHUNK,nKeys);
+
+                uint128_t qKey;
+                uint128_t prevKey=0;
+                unsigned int nLev;
+                unsigned int shift;
+                DendroIntL step;
+                DendroIntL j=-1;
+
+                for(DendroIntL k=kBegin;k<kEnd;k++)
+                {
+                    qKey=SFC::seqSort::SFC_key(pKeys[k],pMaxDepth);
+
+                    if(j<0 || qKey<prevKey)
+                        j=(std::upper_bound(nKeyPtr,nKeyPtr+nNodes,qKey)-nKeyPtr)-1; // last octant <= key
+                    else
+                    {
+                        // gallop forward from the previous result. (sparse keys do not scan the whole octant array)
+                        step=1;
+                        while(((j+step)<nNodes) && (nKeyPtr[j+step]<=qKey)) step<<=1;
+                        j=(std::upper_bound(nKeyPtr+j+(step>>1),nKeyPtr+std::min(j+step,nNodes),qKey)-nKeyPtr)-1;
+                    }
+
+                    prevKey=qKey;
+                    pResult[k]=LOOK_UP_TABLE_DEFAULT;
+                    if(j<0) continue;
+
+                    // the octant contains the key iff it is not finer and the sfc prefix of the octant level matches.
+                    nLev=(unsigned int)(nKeyPtr[j] & ((1u<<SFC_KEY_LEVEL_BITS)-1));
+                    shift=SFC_KEY_LEVEL_BITS+m_uiDim*(pMaxDepth-nLev);
+                    if((nLev<=(unsigned int)(qKey & ((1u<<SFC_KEY_LEVEL_BITS)-1))) && ((nKeyPtr[j]>>shift)==(qKey>>shift)))
+                        pResult[k]=j;
+
+                }
+
+            }
+
+        }
+
+
+        template <typename TKey, typename TOctant>
+        void SFC_treeSearchBatched(const TKey* pKeys, DendroIntL nKeys, const TOctant* pNodes, DendroIntL nNodes, unsigned int* pResult, unsigned int pMaxDepth)
+        {
+            if(nKeys<=0) return;
+
+            std::vector<uint128_t> nodeKeys;
+            SFC_octantKeys(pNodes,nNodes,pMaxDepth,nodeKeys);
+            SFC_treeSearchBatched(pKeys,nKeys,(const uint128_t*)nodeKeys.data(),nNodes,pResult,pMaxDepth);
+
+        }
+
+
+        template <typename TKey>
+        void SFC_treeSearchBatched(TKey* pKeys , const uint128_t* nodeKeys,DendroIntL nKeyBegin,DendroIntL nKeyEnd,DendroIntL nNodeBegin,DendroIntL nNodeEnd,unsigned int pMaxDepth)
+        {
+            if(nKeyEnd<=nKeyBegin) return;
+
+            std::vector<unsigned int> searchResult;
+            searchResult.resize(nKeyEnd-nKeyBegin);
+
+            SFC_treeSearchBatched((const TKey*)(pKeys+nKeyBegin),(nKeyEnd-nKeyBegin),nodeKeys+nNodeBegin,(nNodeEnd-nNodeBegin),searchResult.data(),pMaxDepth);
+
+            for(DendroIntL k=nKeyBegin;k<nKeyEnd;k++)
+            {
+                if(searchResult[k-nKeyBegin]==LOOK_UP_TABLE_DEFAULT) continue;
+                pKeys[k].setFlag((pKeys[k].getFlag() | OCT_FOUND));
+                pKeys[k].setSearchResult(nNodeBegin+searchResult[k-nKeyBegin]);
+            }
+
+        }
+
+
+        template <typename TKey, typename TOctant>
+        void SFC_treeSearchBatched(TKey* pKeys , const TOctant* pNodes,DendroIntL nKeyBegin,DendroIntL nKeyEnd,DendroIntL nNodeBegin,DendroIntL nNodeEnd,unsigned int pMaxDepth)
+        {
+            if(nKeyEnd<=nKeyBegin) return;
+
+            std::vector<unsigned int> searchResult;
+            searchResult.resize(nKeyEnd-nKeyBegin);
+
+            SFC_treeSearchBatched((const TKey*)(pKeys+nKeyBegin),(nKeyEnd-nKeyBegin),pNodes+nNodeBegin,(nNodeEnd-nNodeBegin),searchResult.data(),pMaxDepth);
+
+            for(DendroIntL k=nKeyBegin;k<nKeyEnd;k++)
+            {
+                if(searchResult[k-nKeyBegin]==LOOK_UP_TABLE_DEFAULT) continue;
+                pKeys[k].setFlag((pKeys[k].getFlag() | OCT_FOUND));
+                pKeys[k].setSearchResult(nNodeBegin+searchResult[k-nKeyBegin]);
+            }
+
+        }
+
+
+
     } // namespace seqSearch
 
 
@@ -31,6 +31,7 @@
 #include <chrono>
 #include "dtypes.h"
 #include "parUtils.h"
+#include "radix.h"
 #include <set>
 #include <unordered_set>
 #include "dollar.hpp"
@@ -121,6 +122,27 @@ typedef unsigned __int128 uint128_t;
 #define TS_CONSTRUCT_OCTREE 2
 #define TS_BALANCE_OCTREE 4 // which ensures that balance octree cannote be called without construct octree function.
 
+/**
+ * @brief buckets with at least this many octants are sorted in a separate OpenMP task (child buckets are independent
+ * ranges of the input array). Smaller buckets are sorted by the thread which found them, and the same cutoff is used
+ * to decide whether the bucket counting and the bottom up balance octant creation are worth threading.
+ * */
+#ifndef SFC_TREESORT_TASK_CUTOFF
+    #define SFC_TREESORT_TASK_CUTOFF 8192
+#endif
+
+/**
+ * @brief number of low bits of the packed SFC key which stores the octant level (ancestors before descendants).
+ * */
+#define SFC_KEY_LEVEL_BITS 5
+
+/**
+ * @brief sort only tree sorts with at least this many octants use the SFC key radix sort (if DENDRO_SFC_RADIX_SORT is defined)
+ * */
+#ifndef SFC_RADIX_SORT_MIN
+    #define SFC_RADIX_SORT_MIN 256
+#endif
+
 
 template <typename T>
 struct BucketInfo
@@ -275,6 +297,41 @@ namespace SFC {
         template<typename T>
         void SFC_treeSort(T* pNodes , DendroIntL n ,std::vector<T>& pOutSorted,std::vector<T>& pOutConstruct,std::vector<T>& pOutBalanced, unsigned int pMaxDepthBit,unsigned int pMaxDepth, T& parent, unsigned int rot_id,unsigned int k, unsigned int options);
 
+        /**
+         * @brief Recursive bucketing part of SFC_treeSort (everything except the root level post processing).
+         * @detail When called inside an OpenMP parallel region, child buckets larger than SFC_TREESORT_TASK_CUTOFF are
+         * sorted as OpenMP tasks. Leaf octants of the construct/balance options are gathered per child and appended in
+         * SFC order after the tasks are finished, hence the output is identical to the serial recursion.
+         * */
+        template<typename T>
+        void SFC_treeSortBuckets(T* pNodes , DendroIntL n ,std::vector<T>& pOutConstruct,std::vector<T>& pOutBalanced, unsigned int pMaxDepthBit,unsigned int pMaxDepth, const T& parent, unsigned int rot_id,unsigned int k, unsigned int options);
+
+        /**
+         * @brief threaded version of SFC_bottomUpBalOctantCreation. Auxiliary octants are created level synchronously,
+         * (parents of the current front -> neighbours of unvisited parents -> new front) and the visited sets are kept
+         * as sorted arrays, so the generated octant set is the same as the serial version.
+         * */
+        template<typename T>
+        void SFC_bottomUpBalOctantCreation_omp(std::vector<T> & pNodes);
+
+        /**
+         * @brief packed SFC key of an octant. Comparing keys gives the same order as SFC_treeSort with the same maximum
+         * depth, i.e. the SFC positions of the octant path (coordinate bits below the octant level are ignored) followed
+         * by the level so that ancestors come before descendants.
+         * @param[in] pOct: octant
+         * @param[in] pMaxDepth: maximum depth used in the tree sort (m_uiDim*pMaxDepth+SFC_KEY_LEVEL_BITS <= 128)
+         * */
+        template<typename T>
+        inline uint128_t SFC_key(const T& pOct, unsigned int pMaxDepth);
+
+        /**
+         * @brief sorts the octants by computing the SFC key once for each octant, radix sorting (key,index) pairs and
+         * permuting the array. Equivalent to SFC_treeSort with TS_SORT_ONLY and k=1 (up to the order of identical octants,
+         * which is kept as in the input).
+         * */
+        template<typename T>
+        void SFC_radixSort(T* pNodes, DendroIntL n, unsigned int pMaxDepth);
+
 
         /**
        * @author Milinda Fernando
@@ -327,6 +384,14 @@ namespace SFC {
 
             if(pNodes.empty()){ return; }
 
+#ifndef DIM_2
+            if((pNodes.size()>=SFC_TREESORT_TASK_CUTOFF) && (!omp_in_parallel()) && (omp_get_max_threads()>1))
+            {
+                SFC_bottomUpBalOctantCreation_omp(pNodes);
+                return;
+            }
+#endif
+
             T tmpParent;
             /*std::vector<T> tmpSorted;*/
             T root(m_uiDim,m_uiMaxDepth);
@@ -426,133 +491,187 @@ namespace SFC {
 
 
         template<typename T>
-        void SFC_treeSort(T* pNodes , DendroIntL n ,std::vector<T>& pOutSorted,std::vector<T>& pOutConstruct,std::vector<T>& pOutBalanced, unsigned int pMaxDepthBit,unsigned int pMaxDepth, T& parent, unsigned int rot_id,unsigned int k, unsigned int options)
+        void SFC_bottomUpBalOctantCreation_omp(std::vector<T> & pNodes)
         {
+            if(pNodes.empty()){ return; }
 
-            if(n==0) return;
-            register unsigned int cnum;
-            register unsigned int cnum_prev=0;
-            //register unsigned int n=0;
-            unsigned int rotation=0;
-            DendroIntL count[(NUM_CHILDREN+2)]={};
-            unsigned int lev=pMaxDepth-pMaxDepthBit;
-            pMaxDepthBit--;
-            unsigned int x,y,z;
-            T temp;
-            count[0]=0;
+            const unsigned int neighbourCount=26;
+            OctreeComp<T> comp;
 
-            for (DendroIntL i=0; i< n; ++i) {
+            std::vector<T> auxOct(pNodes);
+            omp_par::merge_sort(auxOct.begin(),auxOct.end(),comp);
+            auxOct.erase(std::unique(auxOct.begin(),auxOct.end()),auxOct.end());
 
-              cnum = (lev < pNodes[i].getLevel())? 1 +( (((pNodes[i].getZ() >> pMaxDepthBit) & 1u) << 2u) | (((pNodes[i].getY() >> pMaxDepthBit) & 1u) << 1u) | ((pNodes[i].getX() >>pMaxDepthBit) & 1u)):0;
-              count[cnum+1]++;
+            std::vector<T> parentAux;
+            std::vector<T> parents;
+            std::vector<T> newParents;
+            std::vector<T> nbh;
+            std::vector<T> newOct;
+            std::vector<T> tmpMerge;
 
-            }
-            //std::cout<<"initial Count finished"<<std::endl;
-            DendroIntL loc[NUM_CHILDREN+1];
-            T unsorted[NUM_CHILDREN+1];
-            unsigned int live = 0;
+            DendroIntL fBegin=0;
+            DendroIntL fEnd=pNodes.size();
+
+            while(fBegin<fEnd)
+            {
+                const DendroIntL nFront=fEnd-fBegin;
+                parents.resize(nFront);
 
+                #pragma omp parallel for schedule(static)
+                for(DendroIntL w=0;w<nFront;w++)
+                    parents[w]=pNodes[fBegin+w].getParent();
 
-            for (unsigned int i=0; i<(NUM_CHILDREN+1); ++i) {
-                if(i==0)
-                {
-                    loc[0]=count[0];
-                    count[1]+=count[0];
-                    unsorted[live] = pNodes[loc[0]];
-                    if (loc[0] < count[1]) {live++; /*std::cout<<i<<" Live: "<<live<<std::endl;*/}
-                }else
+                omp_par::merge_sort(parents.begin(),parents.end(),comp);
+                parents.erase(std::unique(parents.begin(),parents.end()),parents.end());
+
+                newParents.clear();
+                std::set_difference(parents.begin(),parents.end(),parentAux.begin(),parentAux.end(),std::back_inserter(newParents),comp);
+                if(newParents.empty()) break;
+
+                tmpMerge.resize(parentAux.size()+newParents.size());
+                std::merge(parentAux.begin(),parentAux.end(),newParents.begin(),newParents.end(),tmpMerge.begin(),comp);
+                std::swap(parentAux,tmpMerge);
+
+                nbh.resize(newParents.size()*neighbourCount);
+
+                #pragma omp parallel for schedule(static)
+                for(DendroIntL w=0;w<(DendroIntL)newParents.size();w++)
                 {
-                    cnum=(rotations[ROTATION_OFFSET * rot_id+ i-1] - '0');
-                    (i>1) ? cnum_prev = ((rotations[ROTATION_OFFSET * rot_id+i-2] - '0')+2): cnum_prev=1;
-                    loc[cnum+1]=count[cnum_prev];
-                    count[cnum+2] += count[cnum_prev];
-                    //std::cout<<" loc[cnum+1]: "<<loc[cnum+1]<<std::endl;
-                    (loc[cnum+1]==n) ? unsorted[live] = pNodes[loc[cnum+1]-1]: unsorted[live] = pNodes[loc[cnum+1]];
-                    if (loc[cnum+1] < count[cnum+2]) {live++; /*std::cout<<i<<" Live after increment: "<<live<<std::endl;*/}
+                    const T& tmpParent=newParents[w];
+                    T* hint=&(*(nbh.begin()+w*neighbourCount));
+                    hint[0] = tmpParent.getLeft();
+                    hint[1] = tmpParent.getLeftBack();
+                    hint[2] = tmpParent.getLeftFront();
+                    hint[3] = tmpParent.getRight();
+                    hint[4] = tmpParent.getRightBack();
+                    hint[5] = tmpParent.getRightFront();
+                    hint[6] = tmpParent.getBack();
+                    hint[7] = tmpParent.getFront();
+                    hint[8] = tmpParent.getBottom();
+                    hint[9] = tmpParent.getBottomLeft();
+                    hint[10] = tmpParent.getBottomLeftBack();
+                    hint[11] = tmpParent.getBottomLeftFront();
+                    hint[12] = tmpParent.getBottomRight();
+                    hint[13] = tmpParent.getBottomRightBack();
+                    hint[14] = tmpParent.getBottomRightFront();
+                    hint[15] = tmpParent.getBottomBack();
+                    hint[16] = tmpParent.getBottomFront();
+                    hint[17] = tmpParent.getTop();
+                    hint[18] = tmpParent.getTopLeft();
+                    hint[19] = tmpParent.getTopLeftBack();
+                    hint[20] = tmpParent.getTopLeftFront();
+                    hint[21] = tmpParent.getTopRight();
+                    hint[22] = tmpParent.getTopRightBack();
+                    hint[23] = tmpParent.getTopRightFront();
+                    hint[24] = tmpParent.getTopBack();
+                    hint[25] = tmpParent.getTopFront();
                 }
 
-            }
-            //std::cout<<"second pass finished "<<std::endl;
+                omp_par::merge_sort(nbh.begin(),nbh.end(),comp);
+                nbh.erase(std::unique(nbh.begin(),nbh.end()),nbh.end());
 
-            if(live>0)
-            {
+                newOct.clear();
+                std::set_difference(nbh.begin(),nbh.end(),auxOct.begin(),auxOct.end(),std::back_inserter(newOct),comp);
 
-                live--;
-
-                for (DendroIntL i=0; i < n ; ++i) {
+                tmpMerge.resize(auxOct.size()+newOct.size());
+                std::merge(auxOct.begin(),auxOct.end(),newOct.begin(),newOct.end(),tmpMerge.begin(),comp);
+                std::swap(auxOct,tmpMerge);
 
+                // newly created octants are the next front (their parents might not have been visited yet).
+                fBegin=pNodes.size();
+                pNodes.insert(pNodes.end(),newOct.begin(),newOct.end());
+                fEnd=pNodes.size();
 
-                    cnum = (lev < unsorted[live].getLevel()) ? ((((unsorted[live].getZ() >> pMaxDepthBit) & 1u) << 2u) | (((unsorted[live].getY() >> pMaxDepthBit) & 1u) << 1u) | ((unsorted[live].getX() >> pMaxDepthBit) & 1u))+ 1: 0 ;
+            }
 
-                    pNodes[loc[(cnum )]++] = unsorted[live];
-                    (loc[cnum]==n) ? unsorted[live] = pNodes[loc[cnum]-1] : unsorted[live] = pNodes[loc[cnum]];
-                    if ((loc[cnum] == count[cnum + 1])) {
-                     /* if(i<(n-1)) assert(live>0);
-                        if(live==0) assert(i==(n-1));*/
-                          live--;
+        }
 
-                    }
 
+        template<typename T>
+        inline uint128_t SFC_key(const T& pOct, unsigned int pMaxDepth)
+        {
+            const unsigned int lev=std::min(pOct.getLevel(),pMaxDepth);
+            const unsigned int x=pOct.getX();
+            const unsigned int y=pOct.getY();
+            const unsigned int z=pOct.getZ();
 
+            uint128_t key=0;
+            if(pMaxDepth<=SFC_MAX_ENCODE_LEVELS)
+            {
+                key=SFC::sfcEncode(x,y,z,lev,pMaxDepth);
+            }else
+            {
+                unsigned int cnum;
+                unsigned int mid_bit;
+                unsigned int rot_id=0;
+                for(unsigned int l=0;l<lev;l++)
+                {
+                    mid_bit=pMaxDepth-l-1;
+                    cnum=((((z >> mid_bit) & 1u) << 2u) | (((y >> mid_bit) & 1u) << 1u) | ((x >> mid_bit) & 1u));
+                    key=(key<<m_uiDim) | (uint128_t)(SFC::ROT_INDEX[rot_id][cnum]);
+                    rot_id=SFC::ROT_NEXT[rot_id][cnum];
                 }
             }
 
-            if((options==TS_SORT_ONLY) || (options==TS_REMOVE_DUPLICATES))
-            {
-                if (pMaxDepthBit > 0) {
+            key<<=(m_uiDim*(pMaxDepth-lev));
+            return ((key<<SFC_KEY_LEVEL_BITS) | (uint128_t)lev);
+        }
 
-                    DendroIntL numElements=0;
-                    for (unsigned int i=1; i<(NUM_CHILDREN+1); i++) {
-                        cnum=(rotations[ROTATION_OFFSET*rot_id+i-1]-'0');
-                        (i>1)? cnum_prev = ((rotations[ROTATION_OFFSET * rot_id+i-2] - '0')+2) : cnum_prev=1;
-                        numElements = count[cnum+2] - count[cnum_prev];
-                        if (numElements > k) {
-                            rotation=HILBERT_TABLE[NUM_CHILDREN * rot_id + cnum];
-                            if(numElements)SFC_treeSort(pNodes+count[cnum_prev],numElements,pOutSorted,pOutConstruct,pOutBalanced,(pMaxDepthBit),pMaxDepth,temp,rotation,k,options);
-                        }
 
-                    }
-                }
+        template<typename T>
+        void SFC_radixSort(T* pNodes, DendroIntL n, unsigned int pMaxDepth)
+        {
+            if(n<=1) return;
 
-            }else
+            std::vector<uint128_t> keys(n);
+            std::vector<DendroIntL> index(n);
+
+            #pragma omp parallel for schedule(static) if(n>=SFC_TREESORT_TASK_CUTOFF)
+            for(DendroIntL i=0;i<n;i++)
             {
-                if (pMaxDepthBit > MAXDEAPTH_LEVEL_DIFF) {
+                keys[i]=SFC_key(pNodes[i],pMaxDepth);
+                index[i]=i;
+            }
 
-                    DendroIntL numElements=0;
-                    for (unsigned int i=1; i<(NUM_CHILDREN+1); i++) {
-                        cnum=(rotations[ROTATION_OFFSET*rot_id+i-1]-'0');
-                        (i>1)? cnum_prev = ((rotations[ROTATION_OFFSET * rot_id+i-2] - '0')+2) : cnum_prev=1;
-                        numElements = count[cnum+2] - count[cnum_prev];
-                        if((options & TS_CONSTRUCT_OCTREE) | (options & TS_BALANCE_OCTREE))
-                        {
-                            x=parent.getX() +(((int)((bool)(cnum & 1u)))<<(pMaxDepthBit));
-                            y=parent.getY() +(((int)((bool)(cnum & 2u)))<<(pMaxDepthBit));
-                            z=parent.getZ() +(((int)((bool)(cnum & 4u)))<<(pMaxDepthBit));
-                            temp=T(x,y,z,(lev+1),parent.getDim(),pMaxDepth);
+            radixSortPairs(&(*(keys.begin())),&(*(index.begin())),(long long)n,m_uiDim*pMaxDepth+SFC_KEY_LEVEL_BITS);
+            keys.clear();
+            keys.shrink_to_fit();
 
-                        }
-                        if (numElements > k) {
-                            rotation=HILBERT_TABLE[NUM_CHILDREN * rot_id + cnum];
-                            SFC_treeSort(pNodes+count[cnum_prev],numElements,pOutSorted,pOutConstruct,pOutBalanced,(pMaxDepthBit),pMaxDepth,temp,rotation,k,options);
-                        }else if((options & TS_CONSTRUCT_OCTREE) | (options & TS_BALANCE_OCTREE))
-                        {
-                            if(options & TS_CONSTRUCT_OCTREE) {
-                                pOutConstruct.push_back(temp);
-                            }
+            std::vector<T> tmpNodes(n);
 
-                            if (options & TS_BALANCE_OCTREE) {
-                                //generate all the neighbours and add them to unordered map. use pOutBalaced to push balanced octree.
-                                pOutBalanced.push_back(temp);
+            #pragma omp parallel for schedule(static) if(n>=SFC_TREESORT_TASK_CUTOFF)
+            for(DendroIntL i=0;i<n;i++)
+                tmpNodes[i]=pNodes[index[i]];
 
+            std::copy(tmpNodes.begin(),tmpNodes.end(),pNodes);
 
-                            }
+        }
 
-                        }
 
-                    }
-                }
+        template<typename T>
+        void SFC_treeSort(T* pNodes , DendroIntL n ,std::vector<T>& pOutSorted,std::vector<T>& pOutConstruct,std::vector<T>& pOutBalanced, unsigned int pMaxDepthBit,unsigned int pMaxDepth, T& parent, unsigned int rot_id,unsigned int k, unsigned int options)
+        {
 
-            }
+            if(n==0) return;
+            unsigned int lev=pMaxDepth-pMaxDepthBit;
+
+#ifdef DENDRO_SFC_RADIX_SORT
+            if((lev==0) && (k<=1) && ((options==TS_SORT_ONLY) || (options==TS_REMOVE_DUPLICATES)) && (n>=SFC_RADIX_SORT_MIN))
+            {
+                // pure sorts don't need the bucket recursion.
+                SFC_radixSort(pNodes,n,pMaxDepth);
+            }else
+#endif
+            if((lev==0) && (n>=SFC_TREESORT_TASK_CUTOFF) && (!omp_in_parallel()) && (omp_get_max_threads()>1))
+            {
+                // one thread team for the whole recursion, large child buckets are sorted as tasks.
+                #pragma omp parallel
+                {
+                    #pragma omp single
+                    SFC_treeSortBuckets(pNodes,n,pOutConstruct,pOutBalanced,pMaxDepthBit,pMaxDepth,parent,rot_id,k,options);
+                }
+            }else
+                SFC_treeSortBuckets(pNodes,n,pOutConstruct,pOutBalanced,pMaxDepthBit,pMaxDepth,parent,rot_id,k,options);
 
 
 
@@ -576,9 +695,8 @@ namespace SFC {
                         tmpPtr[0] = pNodes[0];
 
                         unsigned int tmpSize = 1;
-                        unsigned int vecTsz = static_cast<unsigned int>(n);
 
-                        for (unsigned int i = 1; i < n; i++) {
+                        for (DendroIntL i = 1; i < n; i++) {
                             if ( /*(!tmpPtr[tmpSize-1].isAncestor(pNodes[i])) &*/  (tmpPtr[tmpSize - 1] != pNodes[i])) { // It is efficient to do this rather than marking all the elements in sorting. (Which will cause a performance degradation. )
                                 tmpPtr[tmpSize] = pNodes[i];
                                 tmpSize++;
@@ -651,6 +769,189 @@ namespace SFC {
         } // end of function SFC_treeSort
 
 
+        template<typename T>
+        void SFC_treeSortBuckets(T* pNodes , DendroIntL n ,std::vector<T>& pOutConstruct,std::vector<T>& pOutBalanced, unsigned int pMaxDepthBit,unsigned int pMaxDepth, const T& parent, unsigned int rot_id,unsigned int k, unsigned int options)
+        {
+
+            if(n==0) return;
+            register unsigned int cnum;
+            register unsigned int cnum_prev=0;
+            //register unsigned int n=0;
+            unsigned int rotation=0;
+            DendroIntL count[(NUM_CHILDREN+2)]={};
+            unsigned int lev=pMaxDepth-pMaxDepthBit;
+            pMaxDepthBit--;
+            unsigned int x,y,z;
+            T temp;
+            count[0]=0;
+
+            for (DendroIntL i=0; i< n; ++i) {
+
+              cnum = (lev < pNodes[i].getLevel())? 1 +( (((pNodes[i].getZ() >> pMaxDepthBit) & 1u) << 2u) | (((pNodes[i].getY() >> pMaxDepthBit) & 1u) << 1u) | ((pNodes[i].getX() >>pMaxDepthBit) & 1u)):0;
+              count[cnum+1]++;
+
+            }
+            //std::cout<<"initial Count finished"<<std::endl;
+            DendroIntL loc[NUM_CHILDREN+1];
+            T unsorted[NUM_CHILDREN+1];
+            unsigned int live = 0;
+
+
+            for (unsigned int i=0; i<(NUM_CHILDREN+1); ++i) {
+                if(i==0)
+                {
+                    loc[0]=count[0];
+                    count[1]+=count[0];
+                    unsorted[live] = pNodes[loc[0]];
+                    if (loc[0] < count[1]) {live++; /*std::cout<<i<<" Live: "<<live<<std::endl;*/}
+                }else
+                {
+                    cnum=(SFC::ROT_PERM[rot_id][i - 1]);
+                    (i>1) ? cnum_prev = ((SFC::ROT_PERM[rot_id][i - 2])+2): cnum_prev=1;
+                    loc[cnum+1]=count[cnum_prev];
+                    count[cnum+2] += count[cnum_prev];
+                    //std::cout<<" loc[cnum+1]: "<<loc[cnum+1]<<std::endl;
+                    (loc[cnum+1]==n) ? unsorted[live] = pNodes[loc[cnum+1]-1]: unsorted[live] = pNodes[loc[cnum+1]];
+                    if (loc[cnum+1] < count[cnum+2]) {live++; /*std::cout<<i<<" Live after increment: "<<live<<std::endl;*/}
+                }
+
+            }
+            //std::cout<<"second pass finished "<<std::endl;
+
+            if(live>0)
+            {
+
+                live--;
+
+                for (DendroIntL i=0; i < n ; ++i) {
+
+
+                    cnum = (lev < unsorted[live].getLevel()) ? ((((unsorted[live].getZ() >> pMaxDepthBit) & 1u) << 2u) | (((unsorted[live].getY() >> pMaxDepthBit) & 1u) << 1u) | ((unsorted[live].getX() >> pMaxDepthBit) & 1u))+ 1: 0 ;
+
+                    pNodes[loc[(cnum )]++] = unsorted[live];
+                    (loc[cnum]==n) ? unsorted[live] = pNodes[loc[cnum]-1] : unsorted[live] = pNodes[loc[cnum]];
+                    if ((loc[cnum] == count[cnum + 1])) {
+                     /* if(i<(n-1)) assert(live>0);
+                        if(live==0) assert(i==(n-1));*/
+                          live--;
+
+                    }
+
+
+                }
+            }
+
+            // child buckets are disjoint ranges of pNodes, large ones are sorted as tasks if we are inside a thread team.
+            const bool spawnTasks = (n>=SFC_TREESORT_TASK_CUTOFF) && omp_in_parallel();
+
+            if((options==TS_SORT_ONLY) || (options==TS_REMOVE_DUPLICATES))
+            {
+                if (pMaxDepthBit > 0) {
+
+                    std::vector<T>* outConstruct=&pOutConstruct;
+                    std::vector<T>* outBalanced=&pOutBalanced;
+
+                    DendroIntL numElements=0;
+                    for (unsigned int i=1; i<(NUM_CHILDREN+1); i++) {
+                        cnum=(SFC::ROT_PERM[rot_id][i - 1]);
+                        (i>1)? cnum_prev = ((SFC::ROT_PERM[rot_id][i - 2])+2) : cnum_prev=1;
+                        numElements = count[cnum+2] - count[cnum_prev];
+                        if (numElements > k) {
+                            rotation=SFC::ROT_NEXT[rot_id][cnum];
+                            if(spawnTasks && (numElements>=SFC_TREESORT_TASK_CUTOFF))
+                            {
+                                // temp is not modified in the sort only case, the tasks share it.
+                                T* cNodes=pNodes+count[cnum_prev];
+                                const T* cParent=&temp;
+                                #pragma omp task default(none) firstprivate(cNodes,numElements,pMaxDepthBit,pMaxDepth,cParent,rotation,k,options,outConstruct,outBalanced)
+                                SFC_treeSortBuckets(cNodes,numElements,*outConstruct,*outBalanced,(pMaxDepthBit),pMaxDepth,*cParent,rotation,k,options);
+                            }else
+                                SFC_treeSortBuckets(pNodes+count[cnum_prev],numElements,pOutConstruct,pOutBalanced,(pMaxDepthBit),pMaxDepth,temp,rotation,k,options);
+                        }
+
+                    }
+
+                    if(spawnTasks)
+                    {
+                        #pragma omp taskwait
+                    }
+                }
+
+            }else
+            {
+                if (pMaxDepthBit > MAXDEAPTH_LEVEL_DIFF) {
+
+                    const bool isAliased = (&pOutConstruct == &pOutBalanced);
+                    std::vector<T> childConstruct[NUM_CHILDREN];
+                    std::vector<T> childBalanced[NUM_CHILDREN];
+                    T childParent[NUM_CHILDREN];
+
+                    DendroIntL numElements=0;
+                    for (unsigned int i=1; i<(NUM_CHILDREN+1); i++) {
+                        cnum=(SFC::ROT_PERM[rot_id][i - 1]);
+                        (i>1)? cnum_prev = ((SFC::ROT_PERM[rot_id][i - 2])+2) : cnum_prev=1;
+                        numElements = count[cnum+2] - count[cnum_prev];
+                        if((options & TS_CONSTRUCT_OCTREE) | (options & TS_BALANCE_OCTREE))
+                        {
+                            x=parent.getX() +(((int)((bool)(cnum & 1u)))<<(pMaxDepthBit));
+                            y=parent.getY() +(((int)((bool)(cnum & 2u)))<<(pMaxDepthBit));
+                            z=parent.getZ() +(((int)((bool)(cnum & 4u)))<<(pMaxDepthBit));
+                            temp=T(x,y,z,(lev+1),parent.getDim(),pMaxDepth);
+
+                        }
+                        // with tasks every child writes to its own buffers (same aliasing as the output vectors), so that the
+                        // outputs can be appended in SFC order once all the child tasks are finished.
+                        std::vector<T>& cConstruct = (spawnTasks) ? childConstruct[i-1] : pOutConstruct;
+                        std::vector<T>& cBalanced  = (spawnTasks) ? ((isAliased) ? childConstruct[i-1] : childBalanced[i-1]) : pOutBalanced;
+                        if (numElements > k) {
+                            rotation=SFC::ROT_NEXT[rot_id][cnum];
+                            if(spawnTasks && (numElements>=SFC_TREESORT_TASK_CUTOFF))
+                            {
+                                // temp is overwritten by the next child, the task reads its own copy of the parent.
+                                childParent[i-1]=temp;
+                                T* cNodes=pNodes+count[cnum_prev];
+                                const T* cParent=&childParent[i-1];
+                                std::vector<T>* outConstruct=&cConstruct;
+                                std::vector<T>* outBalanced=&cBalanced;
+                                #pragma omp task default(none) firstprivate(cNodes,numElements,pMaxDepthBit,pMaxDepth,cParent,rotation,k,options,outConstruct,outBalanced)
+                                SFC_treeSortBuckets(cNodes,numElements,*outConstruct,*outBalanced,(pMaxDepthBit),pMaxDepth,*cParent,rotation,k,options);
+                            }else
+                                SFC_treeSortBuckets(pNodes+count[cnum_prev],numElements,cConstruct,cBalanced,(pMaxDepthBit),pMaxDepth,temp,rotation,k,options);
+                        }else if((options & TS_CONSTRUCT_OCTREE) | (options & TS_BALANCE_OCTREE))
+                        {
+                            if(options & TS_CONSTRUCT_OCTREE) {
+                                cConstruct.push_back(temp);
+                            }
+
+                            if (options & TS_BALANCE_OCTREE) {
+                                //generate all the neighbours and add them to unordered map. use pOutBalaced to push balanced octree.
+                                cBalanced.push_back(temp);
+
+
+                            }
+
+                        }
+
+                    }
+
+                    if(spawnTasks)
+                    {
+                        #pragma omp taskwait
+
+                        for(unsigned int c=0;c<NUM_CHILDREN;c++)
+                        {
+                            pOutConstruct.insert(pOutConstruct.end(),childConstruct[c].begin(),childConstruct[c].end());
+                            if(!isAliased) pOutBalanced.insert(pOutBalanced.end(),childBalanced[c].begin(),childBalanced[c].end());
+                        }
+                    }
+                }
+
+            }
+
+        } // end of function SFC_treeSortBuckets
+
+
+
         template<typename T>
         inline void SFC_bucketing(T *pNodes, int lev, unsigned int maxDepth,unsigned char rot_id,DendroIntL &begin, DendroIntL &end, DendroIntL *splitters)
         {
@@ -670,12 +971,12 @@ namespace SFC {
                 // Special Case when the considering level exceeds the max depth.
 
                 for (int ii = 0; ii < NUM_CHILDREN; ii++) {
-                    int index = (rotations[2 * NUM_CHILDREN * rot_id + ii] - '0');
+                    int index = (SFC::ROT_PERM[rot_id][ii]);
                     int nextIndex = 0;
                     if (ii == (NUM_CHILDREN-1))
                         nextIndex = ii + 1;
                     else
-                        nextIndex = (rotations[2 * NUM_CHILDREN * rot_id + ii + 1] - '0');
+                        nextIndex = (SFC::ROT_PERM[rot_id][ii + 1]);
 
                     if (ii == 0) {
                         splitters[index] = begin;
@@ -698,6 +999,27 @@ namespace SFC {
             //pMaxDepth--;
             unsigned int mid_bit = maxDepth - lev - 1;
             count[0]=begin;
+            if(((end-begin)>=SFC_TREESORT_TASK_CUTOFF) && (!omp_in_parallel()) && (omp_get_max_threads()>1))
+            {
+                // threaded counting pass, (integer counts hence the splitters are independent of the thread count)
+                #pragma omp parallel
+                {
+                    unsigned int lcnum;
+                    DendroIntL lcount[(NUM_CHILDREN+2)]={};
+                    #pragma omp for schedule(static) nowait
+                    for (DendroIntL i=begin; i<end; ++i) {
+                        lcnum = (lev < (int)pNodes[i].getLevel())? 1 +( (((pNodes[i].getZ() >> mid_bit) & 1u) << 2u) | (((pNodes[i].getY() >> mid_bit) & 1u) << 1u) | ((pNodes[i].getX() >>mid_bit) & 1u)):0;
+                        lcount[lcnum+1]++;
+                    }
+
+                    #pragma omp critical
+                    {
+                        for(unsigned int c=1;c<(NUM_CHILDREN+2);c++)
+                            count[c]+=lcount[c];
+                    }
+                }
+
+            }else
             for (DendroIntL i=begin; i<end; ++i) {
 
                 /*cnum = (lev < pNodes[i].getLevel())? 1 +(((((pNodes[i].getZ() & (1u << mid_bit)) >> mid_bit) << 2u) |
@@ -718,12 +1040,12 @@ namespace SFC {
             //if(count[1]>0) std::cout<<"For rank: "<<rank<<" count [1]:  "<<count[1]<<std::endl;
 
             for (unsigned int ii = 0; ii < NUM_CHILDREN; ii++) {
-                int index = (rotations[2 * NUM_CHILDREN * rot_id + ii] - '0');
+                int index = (SFC::ROT_PERM[rot_id][ii]);
                 int nextIndex = 0;
                 if (ii == (NUM_CHILDREN-1))
                     nextIndex = ii + 1;
                 else
-                    nextIndex = (rotations[2 * NUM_CHILDREN * rot_id + ii + 1] - '0');
+                    nextIndex = (SFC::ROT_PERM[rot_id][ii + 1]);
 
                 if (ii == 0) {
                     splitters[index] = begin;
@@ -746,8 +1068,8 @@ namespace SFC {
                     if (loc[0] < count[1]) {live++; /*std::cout<<" level buck Live ++ : "<<live<<std::endl;*/}
                 }else {
 
-                    cnum = (rotations[ROTATION_OFFSET * rot_id + i-1] - '0');
-                    (i > 1) ? cnum_prev = ((rotations[ROTATION_OFFSET * rot_id + i - 2] - '0') + 2) : cnum_prev = 1;
+                    cnum = (SFC::ROT_PERM[rot_id][i - 1]);
+                    (i > 1) ? cnum_prev = ((SFC::ROT_PERM[rot_id][i - 2]) + 2) : cnum_prev = 1;
 
                     loc[cnum+1] = count[cnum_prev];
                     count[cnum + 2] += count[cnum_prev];
@@ -817,9 +1139,9 @@ namespace SFC {
             if( (pMaxDepthBit) && ((nNodeEnd-nNodeBegin)>1)) {
 
                 SFC::seqSort::SFC_bucketing(pNodes,lev,pMaxDepth,rot_id,nNodeBegin,nNodeEnd,splitterNodes);
-                hindex = (rotations[2 * NUM_CHILDREN * rot_id + bucketIndex] - '0');
-                index=HILBERT_TABLE[NUM_CHILDREN * rot_id + bucketIndex];
-                (bucketIndex == (NUM_CHILDREN - 1)) ? hindexN = bucketIndex + 1: hindexN = (rotations[2 * NUM_CHILDREN * rot_id + bucketIndex + 1] - '0');
+                hindex = (SFC::ROT_PERM[rot_id][bucketIndex]);
+                index=SFC::ROT_NEXT[rot_id][bucketIndex];
+                (bucketIndex == (NUM_CHILDREN - 1)) ? hindexN = bucketIndex + 1: hindexN = (SFC::ROT_PERM[rot_id][bucketIndex + 1]);
 
                 assert(splitterNodes[hindex] <= splitterNodes[hindexN]);
                 if(splitterNodes[hindex]!=splitterNodes[hindexN]) SFC_treeSortLocalOptimal(pNodes+splitterNodes[hindex],(splitterNodes[hindexN]-splitterNodes[hindex]),(pMaxDepthBit-1),pMaxDepth,parent,index,minimum,optimal);
@@ -856,8 +1178,8 @@ namespace SFC {
             unsigned int min_b=0,max_b=NUM_CHILDREN-1;
             for(unsigned int i=0;i<NUM_CHILDREN;i++)
             {
-                hindex = (rotations[2 * NUM_CHILDREN * rot_id + min_b] - '0');
-                (min_b == (NUM_CHILDREN - 1)) ? hindexN = min_b + 1: hindexN = (rotations[2 * NUM_CHILDREN * rot_id + min_b + 1] - '0');
+                hindex = (SFC::ROT_PERM[rot_id][min_b]);
+                (min_b == (NUM_CHILDREN - 1)) ? hindexN = min_b + 1: hindexN = (SFC::ROT_PERM[rot_id][min_b + 1]);
                 if(splitterNodes[hindex]!=splitterNodes[hindexN])break;
                 min_b++;
 
@@ -866,23 +1188,23 @@ namespace SFC {
 
             for(unsigned int i=0;i<(NUM_CHILDREN);i++)
             {
-                hindex = (rotations[2 * NUM_CHILDREN * rot_id + max_b] - '0');
-                (max_b == (NUM_CHILDREN - 1)) ? hindexN = max_b + 1: hindexN = (rotations[2 * NUM_CHILDREN * rot_id + max_b + 1] - '0');
+                hindex = (SFC::ROT_PERM[rot_id][max_b]);
+                (max_b == (NUM_CHILDREN - 1)) ? hindexN = max_b + 1: hindexN = (SFC::ROT_PERM[rot_id][max_b + 1]);
                 if(splitterNodes[hindex]!=splitterNodes[hindexN])break;
                 max_b--;
             }
 
 
-            hindex = (rotations[2 * NUM_CHILDREN * rot_id + min_b] - '0');
-            (min_b == (NUM_CHILDREN - 1)) ? hindexN = min_b + 1: hindexN = (rotations[2 * NUM_CHILDREN * rot_id + min_b + 1] - '0');
-            index=HILBERT_TABLE[NUM_CHILDREN * rot_id + min_b];
+            hindex = (SFC::ROT_PERM[rot_id][min_b]);
+            (min_b == (NUM_CHILDREN - 1)) ? hindexN = min_b + 1: hindexN = (SFC::ROT_PERM[rot_id][min_b + 1]);
+            index=SFC::ROT_NEXT[rot_id][min_b];
             DendroIntL numElem=splitterNodes[hindexN]-splitterNodes[hindex];
             SFC::seqSort::SFC_treeSortLocalOptimal(&pNodes[splitterNodes[hindex]],numElem,pMaxDepthBit-1,pMaxDepth,parent,index,true,min);
             //SFC::seqSort::SFC_treeSortLocalOptimal(pNodes,n,pMaxDepthBit,pMaxDepth,parent,rot_id,true,min);
 
-            hindex = (rotations[2 * NUM_CHILDREN * rot_id + max_b] - '0');
-            (max_b == (NUM_CHILDREN - 1)) ? hindexN = max_b + 1: hindexN = (rotations[2 * NUM_CHILDREN * rot_id + max_b + 1] - '0');
-            index=HILBERT_TABLE[NUM_CHILDREN * rot_id + max_b];
+            hindex = (SFC::ROT_PERM[rot_id][max_b]);
+            (max_b == (NUM_CHILDREN - 1)) ? hindexN = max_b + 1: hindexN = (SFC::ROT_PERM[rot_id][max_b + 1]);
+            index=SFC::ROT_NEXT[rot_id][max_b];
             numElem=splitterNodes[hindexN]-splitterNodes[hindex];
             SFC::seqSort::SFC_treeSortLocalOptimal(&pNodes[splitterNodes[hindex]],numElem,pMaxDepthBit-1,pMaxDepth,parent,index,false,max);
             //SFC::seqSort::SFC_treeSortLocalOptimal(pNodes,n,pMaxDepthBit,pMaxDepth,parent,rot_id,false,max);
@@ -1015,13 +1337,13 @@ namespace SFC
                                                 tmp.end, spliterstemp);
 
                     for (int i = 0; i < NUM_CHILDREN; i++) {
-                        hindex = (rotations[2 * NUM_CHILDREN * tmp.rot_id + i] - '0');
+                        hindex = (SFC::ROT_PERM[tmp.rot_id][i]);
                         if (i == (NUM_CHILDREN - 1))
                             hindexN = i + 1;
                         else
-                            hindexN = (rotations[2 * NUM_CHILDREN * tmp.rot_id + i + 1] - '0');
+                            hindexN = (SFC::ROT_PERM[tmp.rot_id][i + 1]);
                         assert(spliterstemp[hindex] <= spliterstemp[hindexN]);
-                        index = HILBERT_TABLE[NUM_CHILDREN * tmp.rot_id + hindex];
+                        index = SFC::ROT_NEXT[tmp.rot_id][hindex];
 
                         BucketInfo<T> child(index, (tmp.lev + 1), spliterstemp[hindex], spliterstemp[hindexN]);
                         nodeStack.push_back(child);
@@ -1167,16 +1489,16 @@ namespace SFC
 
 
                             for (int i = 0; i < NUM_CHILDREN; i++) {
-                                hindex = (rotations[2 * NUM_CHILDREN * tmp.rot_id + i] - '0');
+                                hindex = (SFC::ROT_PERM[tmp.rot_id][i]);
                                 if (i == (NUM_CHILDREN - 1))
                                     hindexN = i + 1;
                                 else
-                                    hindexN = (rotations[2 * NUM_CHILDREN * tmp.rot_id + i + 1] - '0');
+                                    hindexN = (SFC::ROT_PERM[tmp.rot_id][i + 1]);
 
                                 //newBucketCounts[NUM_CHILDREN * k + i] = (splitterTemp[hindexN] - splitterTemp[hindex]);
                                 newBucketCounts.push_back((splitterTemp[hindexN] - splitterTemp[hindex]));
 
-                                index = HILBERT_TABLE[NUM_CHILDREN * tmp.rot_id + hindex];
+                                index = SFC::ROT_NEXT[tmp.rot_id][hindex];
                                 BucketInfo<T> bucket(index, (tmp.lev + 1), splitterTemp[hindex], splitterTemp[hindexN]);
                                 //                          newBucketInfo[NUM_CHILDREN * k + i] = bucket;
                                 //                          newBucketSplitters[NUM_CHILDREN * k + i] = splitterTemp[hindex];
@@ -1668,13 +1990,13 @@ namespace SFC
 
 
                 for (int i = 0; i < NUM_CHILDREN; i++) {
-                    hindex = (rotations[2 * NUM_CHILDREN * tmp.rot_id + i] - '0');
+                    hindex = (SFC::ROT_PERM[tmp.rot_id][i]);
                     if (i == (NUM_CHILDREN-1))
                         hindexN = i + 1;
                     else
-                        hindexN = (rotations[2 * NUM_CHILDREN * tmp.rot_id + i + 1] - '0');
+                        hindexN = (SFC::ROT_PERM[tmp.rot_id][i + 1]);
                     assert(spliterstemp[hindex] <= spliterstemp[hindexN]);
-                    index = HILBERT_TABLE[NUM_CHILDREN * tmp.rot_id + hindex];
+                    index = SFC::ROT_NEXT[tmp.rot_id][hindex];
 
                     BucketInfo<T> child(index, (tmp.lev + 1), spliterstemp[hindex], spliterstemp[hindexN]);
                     nodeStack.push_back(child);
@@ -1844,16 +2166,16 @@ namespace SFC
 
 
                         for (int i = 0; i < NUM_CHILDREN; i++) {
-                            hindex = (rotations[2 * NUM_CHILDREN * tmp.rot_id + i] - '0');
+                            hindex = (SFC::ROT_PERM[tmp.rot_id][i]);
                             if (i == (NUM_CHILDREN-1))
                                 hindexN = i + 1;
                             else
-                                hindexN = (rotations[2 * NUM_CHILDREN * tmp.rot_id + i + 1] - '0');
+                                hindexN = (SFC::ROT_PERM[tmp.rot_id][i + 1]);
 
                             //newBucketCounts[NUM_CHILDREN * k + i] = (splitterTemp[hindexN] - splitterTemp[hindex]);
                             newBucketCounts.push_back((splitterTemp[hindexN] - splitterTemp[hindex]));
 
-                            index = HILBERT_TABLE[NUM_CHILDREN * tmp.rot_id + hindex];
+                            index = SFC::ROT_NEXT[tmp.rot_id][hindex];
                             BucketInfo<T> bucket(index, (tmp.lev + 1), splitterTemp[hindex], splitterTemp[hindexN]);
 //                          newBucketInfo[NUM_CHILDREN * k + i] = bucket;
 //                          newBucketSplitters[NUM_CHILDREN * k + i] = splitterTemp[hindex];
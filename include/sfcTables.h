@@ -0,0 +1,278 @@
+/**
+ * @brief Compile time SFC rotation tables and Morton/Hilbert encode and decode utilities.
+ * @detail The tables are the same as the ones generated by _InitializeHcurve (hcurvedata.cpp) but stored as constexpr
+ * numeric arrays, (no ASCII offset decoding and no indirection through the heap allocated char tables). The dimension
+ * and the ordering are selected by DIM_2 and HILBERT_ORDERING. Morton interleaving uses BMI2 pdep/pext when the
+ * compiler targets BMI2 (__BMI2__, e.g. -mbmi2 or -march=native), otherwise the portable magic bits version.
+ * */
+
+#ifndef DENDRO_SFCTABLES_H
+#define DENDRO_SFCTABLES_H
+
+#include <stdint.h>
+
+#if defined(__BMI2__)
+    #include <immintrin.h>
+#endif
+
+#ifdef DIM_2
+    #define SFC_DIM_BITS 2
+    #define SFC_NUM_CHILDREN 4
+#else
+    #define SFC_DIM_BITS 3
+    #define SFC_NUM_CHILDREN 8
+#endif
+
+#if defined(HILBERT_ORDERING) && defined(DIM_2)
+    #define SFC_NUM_ROTATIONS 4
+#elif defined(HILBERT_ORDERING)
+    #define SFC_NUM_ROTATIONS 24
+#else
+    #define SFC_NUM_ROTATIONS 1
+#endif
+
+/**@brief maximum number of levels that fits in a 64 bit Morton/Hilbert index. */
+#define SFC_MAX_ENCODE_LEVELS 21
+
+namespace SFC
+{
+
+    /**@brief SFC position -> child number (x | y<<1 | z<<2) of each rotation. (rotations[ROTATION_OFFSET*rot+i]-'0') */
+    static constexpr unsigned char ROT_PERM[SFC_NUM_ROTATIONS][SFC_NUM_CHILDREN]={
+#if defined(HILBERT_ORDERING) && defined(DIM_2)
+        {0,1,2,3},
+        {0,3,2,1},
+        {2,1,0,3},
+        {2,3,0,1}
+#elif defined(HILBERT_ORDERING)
+        {0,2,3,1,5,7,6,4},
+        {0,4,5,1,3,7,6,2},
+        {0,2,6,4,5,7,3,1},
+        {6,2,0,4,5,1,3,7},
+        {3,7,5,1,0,4,6,2},
+        {5,7,3,1,0,2,6,4},
+        {6,2,3,7,5,1,0,4},
+        {0,4,6,2,3,7,5,1},
+        {6,4,0,2,3,1,5,7},
+        {6,4,5,7,3,1,0,2},
+        {0,1,5,4,6,7,3,2},
+        {3,2,0,1,5,4,6,7},
+        {6,7,5,4,0,1,3,2},
+        {5,7,6,4,0,2,3,1},
+        {3,2,6,7,5,4,0,1},
+        {5,1,0,4,6,2,3,7},
+        {3,7,6,2,0,4,5,1},
+        {6,7,3,2,0,1,5,4},
+        {5,4,0,1,3,2,6,7},
+        {3,1,5,7,6,4,0,2},
+        {5,1,3,7,6,2,0,4},
+        {0,1,3,2,6,7,5,4},
+        {5,4,6,7,3,2,0,1},
+        {3,1,0,2,6,4,5,7}
+#elif defined(DIM_2)
+        {0,1,2,3}
+#else
+        {0,1,2,3,4,5,6,7}
+#endif
+    };
+
+    /**@brief child number -> SFC position of each rotation. (rotations[ROTATION_OFFSET*rot+NUM_CHILDREN+cnum]-'0') */
+    static constexpr unsigned char ROT_INDEX[SFC_NUM_ROTATIONS][SFC_NUM_CHILDREN]={
+#if defined(HILBERT_ORDERING) && defined(DIM_2)
+        {0,1,2,3},
+        {0,3,2,1},
+        {2,1,0,3},
+        {2,3,0,1}
+#elif defined(HILBERT_ORDERING)
+        {0,3,1,2,7,4,6,5},
+        {0,3,7,4,1,2,6,5},
+        {0,7,1,6,3,4,2,5},
+        {2,5,1,6,3,4,0,7},
+        {4,3,7,0,5,2,6,1},
+        {4,3,5,2,7,0,6,1},
+        {6,5,1,2,7,4,0,3},
+        {0,7,3,4,1,6,2,5},
+        {2,5,3,4,1,6,0,7},
+        {6,5,7,4,1,2,0,3},
+        {0,1,7,6,3,2,4,5},
+        {2,3,1,0,5,4,6,7},
+        {4,5,7,6,3,2,0,1},
+        {4,7,5,6,3,0,2,1},
+        {6,7,1,0,5,4,2,3},
+        {2,1,5,6,3,0,4,7},
+        {4,7,3,0,5,6,2,1},
+        {4,5,3,2,7,6,0,1},
+        {2,3,5,4,1,0,6,7},
+        {6,1,7,0,5,2,4,3},
+        {6,1,5,2,7,0,4,3},
+        {0,1,3,2,7,6,4,5},
+        {6,7,5,4,1,0,2,3},
+        {2,1,3,0,5,6,4,7}
+#elif defined(DIM_2)
+        {0,1,2,3}
+#else
+        {0,1,2,3,4,5,6,7}
+#endif
+    };
+
+    /**@brief rotation of the child octant indexed by child number. (HILBERT_TABLE[NUM_CHILDREN*rot+cnum]) */
+    static constexpr unsigned char ROT_NEXT[SFC_NUM_ROTATIONS][SFC_NUM_CHILDREN]={
+#if defined(HILBERT_ORDERING) && defined(DIM_2)
+        {1,0,0,2},
+        {0,3,1,1},
+        {2,2,3,0},
+        {3,1,2,3}
+#elif defined(HILBERT_ORDERING)
+        {1,3,2,0,6,4,5,0},
+        {0,8,9,5,7,1,4,1},
+        {10,14,0,13,11,12,2,2},
+        {3,3,6,15,14,10,12,11},
+        {18,17,12,11,4,4,1,16},
+        {11,12,5,5,17,18,0,13},
+        {20,6,3,6,0,19,9,2},
+        {21,22,18,17,1,16,7,7},
+        {8,8,22,21,9,23,17,18},
+        {19,9,1,20,8,9,6,7},
+        {2,21,19,12,23,10,13,10},
+        {11,6,14,4,11,1,18,3},
+        {15,12,4,10,16,12,3,17},
+        {3,16,13,2,4,15,13,5},
+        {22,2,11,19,14,9,14,0},
+        {15,20,15,3,19,13,2,23},
+        {8,13,5,23,16,7,16,4},
+        {23,17,13,17,5,21,8,12},
+        {18,9,18,0,22,5,11,8},
+        {9,23,10,14,19,19,22,21},
+        {6,15,20,20,21,22,14,10},
+        {7,10,15,21,20,17,16,21},
+        {14,7,22,6,18,20,22,1},
+        {23,19,20,16,23,8,7,15}
+#elif defined(DIM_2)
+        {0,0,0,0}
+#else
+        {0,0,0,0,0,0,0,0}
+#endif
+    };
+
+    /**@brief bit masks of the x, y, z bits of a 3D Morton code (21 bits each) */
+    static constexpr uint64_t MORTON_MASK_X=0x1249249249249249ull;
+    static constexpr uint64_t MORTON_MASK_Y=(MORTON_MASK_X<<1u);
+    static constexpr uint64_t MORTON_MASK_Z=(MORTON_MASK_X<<2u);
+
+    /**@brief spreads the lower 21 bits of a, to every third bit. */
+    inline uint64_t mortonSplitBy3(unsigned int a)
+    {
+#if defined(__BMI2__)
+        return _pdep_u64(a,MORTON_MASK_X);
+#else
+        uint64_t x=a & 0x1fffff;
+        x = (x | (x << 32)) & 0x1f00000000ffffull;
+        x = (x | (x << 16)) & 0x1f0000ff0000ffull;
+        x = (x | (x << 8))  & 0x100f00f00f00f00full;
+        x = (x | (x << 4))  & 0x10c30c30c30c30c3ull;
+        x = (x | (x << 2))  & MORTON_MASK_X;
+        return x;
+#endif
+    }
+
+    /**@brief inverse of mortonSplitBy3, gathers every third bit of m (starting from bit 0). */
+    inline unsigned int mortonCompactBy3(uint64_t m)
+    {
+#if defined(__BMI2__)
+        return (unsigned int)_pext_u64(m,MORTON_MASK_X);
+#else
+        uint64_t x = m & MORTON_MASK_X;
+        x = (x ^ (x >> 2))  & 0x10c30c30c30c30c3ull;
+        x = (x ^ (x >> 4))  & 0x100f00f00f00f00full;
+        x = (x ^ (x >> 8))  & 0x1f0000ff0000ffull;
+        x = (x ^ (x >> 16)) & 0x1f00000000ffffull;
+        x = (x ^ (x >> 32)) & 0x1fffff;
+        return (unsigned int)x;
+#endif
+    }
+
+    /**@brief Morton code of (x,y,z), (child number ordering x | y<<1 | z<<2), coordinates must fit in 21 bits. */
+    inline uint64_t mortonEncode(unsigned int x, unsigned int y, unsigned int z)
+    {
+#if defined(__BMI2__)
+        return _pdep_u64(x,MORTON_MASK_X) | _pdep_u64(y,MORTON_MASK_Y) | _pdep_u64(z,MORTON_MASK_Z);
+#else
+        return mortonSplitBy3(x) | (mortonSplitBy3(y) << 1u) | (mortonSplitBy3(z) << 2u);
+#endif
+    }
+
+    /**@brief decodes a Morton code computed by mortonEncode */
+    inline void mortonDecode(uint64_t m, unsigned int& x, unsigned int& y, unsigned int& z)
+    {
+#if defined(__BMI2__)
+        x=(unsigned int)_pext_u64(m,MORTON_MASK_X);
+        y=(unsigned int)_pext_u64(m,MORTON_MASK_Y);
+        z=(unsigned int)_pext_u64(m,MORTON_MASK_Z);
+#else
+        x=mortonCompactBy3(m);
+        y=mortonCompactBy3(m>>1u);
+        z=mortonCompactBy3(m>>2u);
+#endif
+    }
+
+    /**
+     * @brief SFC index of the octant path (SFC positions of the ancestors, root first) of the octant anchored at (x,y,z)
+     * with level lev. Coordinate bits below the level are ignored.
+     * @param[in] x,y,z: anchor coordinates
+     * @param[in] lev: level of the octant (lev <= SFC_MAX_ENCODE_LEVELS)
+     * @param[in] maxDepth: maximum depth (number of coordinate bits)
+     * */
+    inline uint64_t sfcEncode(unsigned int x, unsigned int y, unsigned int z, unsigned int lev, unsigned int maxDepth)
+    {
+#if defined(HILBERT_ORDERING) || defined(DIM_2)
+        uint64_t key=0;
+        unsigned int rot=0;
+        unsigned int cnum;
+        unsigned int mid_bit;
+        for(unsigned int l=0;l<lev;l++)
+        {
+            mid_bit=maxDepth-l-1;
+            cnum=((((z >> mid_bit) & 1u) << 2u) | (((y >> mid_bit) & 1u) << 1u) | ((x >> mid_bit) & 1u));
+            key=(key<<SFC_DIM_BITS) | ROT_INDEX[rot][cnum];
+            rot=ROT_NEXT[rot][cnum];
+        }
+        return key;
+#else
+        const unsigned int shift=maxDepth-lev;
+        return mortonEncode(x>>shift,y>>shift,z>>shift);
+#endif
+    }
+
+    /**
+     * @brief inverse of sfcEncode, computes the anchor of the octant from its SFC index.
+     * @param[in] key: SFC index computed by sfcEncode
+     * @param[in] lev: level of the octant
+     * @param[in] maxDepth: maximum depth
+     * @param[out] x,y,z: anchor coordinates
+     * */
+    inline void sfcDecode(uint64_t key, unsigned int lev, unsigned int maxDepth, unsigned int& x, unsigned int& y, unsigned int& z)
+    {
+#if defined(HILBERT_ORDERING) || defined(DIM_2)
+        unsigned int rot=0;
+        unsigned int cnum;
+        unsigned int mid_bit;
+        x=0; y=0; z=0;
+        for(unsigned int l=0;l<lev;l++)
+        {
+            mid_bit=maxDepth-l-1;
+            cnum=ROT_PERM[rot][(key >> (SFC_DIM_BITS*(lev-l-1))) & (SFC_NUM_CHILDREN-1)];
+            x|=((cnum & 1u) << mid_bit);
+            y|=(((cnum >> 1u) & 1u) << mid_bit);
+            z|=(((cnum >> 2u) & 1u) << mid_bit);
+            rot=ROT_NEXT[rot][cnum];
+        }
+#else
+        const unsigned int shift=maxDepth-lev;
+        mortonDecode(key,x,y,z);
+        x<<=shift; y<<=shift; z<<=shift;
+#endif
+    }
+
+}
+
+#endif //DENDRO_SFCTABLES_H
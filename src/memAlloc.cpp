@@ -0,0 +1,196 @@
+/**
+ * @file memAlloc.cpp
+ * @brief Pluggable allocator for the large field buffers.
+ * @version 0.1
+ *
+ * School of Computing, University of Utah.
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include "memAlloc.h"
+#include "mpi.h"
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#ifdef __linux__
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+#endif
+
+// mempolicy modes and flags (linux/mempolicy.h), defined here to avoid the dependency on the kernel headers.
+#define DENDRO_MPOL_PREFERRED 1
+#define DENDRO_MPOL_INTERLEAVE 3
+#define DENDRO_MPOL_F_MEMS_ALLOWED (1<<2)
+
+// max. number of NUMA nodes in the node masks.
+#define DENDRO_MEM_MAX_NODES 1024
+
+namespace mem
+{
+    static unsigned int default_policy()
+    {
+        unsigned int policy = MEM_POLICY_DEFAULT;
+        #ifdef DENDRO_MEM_THP
+            policy |= MEM_POLICY_THP;
+        #endif
+        #ifdef DENDRO_MEM_NUMA_LOCAL
+            policy |= MEM_POLICY_NUMA_LOCAL;
+        #endif
+        return policy;
+    }
+
+    static Allocator* m_pAllocator = NULL;
+
+    PolicyAllocator* get_default_allocator()
+    {
+        static PolicyAllocator defaultAlloc(default_policy());
+        return &defaultAlloc;
+    }
+
+    Allocator* get_allocator()
+    {
+        return (m_pAllocator!=NULL) ? m_pAllocator : get_default_allocator();
+    }
+
+    void set_allocator(Allocator* alloc)
+    {
+        m_pAllocator = alloc;
+    }
+
+    static bool read_thp_enabled()
+    {
+        bool isEnabled = false;
+        FILE* f = fopen("/sys/kernel/mm/transparent_hugepage/enabled","r");
+        if(f!=NULL)
+        {
+            char buf[128] = {0};
+            if(fgets(buf,sizeof(buf),f)!=NULL)
+                isEnabled = (strstr(buf,"[never]")==NULL);
+            fclose(f);
+        }
+        return isEnabled;
+    }
+
+    bool is_thp_enabled()
+    {
+        static const bool isEnabled = read_thp_enabled();
+        return isEnabled;
+    }
+
+    int get_numa_node()
+    {
+        #if defined(__linux__) && defined(SYS_getcpu)
+            unsigned int cpu = 0, node = 0;
+            if(syscall(SYS_getcpu, &cpu, &node, NULL)==0)
+                return node;
+        #endif
+        return 0;
+    }
+
+    int set_thread_local_policy()
+    {
+        #if defined(__linux__) && defined(SYS_set_mempolicy)
+            const int node = get_numa_node();
+            unsigned long mask[DENDRO_MEM_MAX_NODES/(8*sizeof(unsigned long))] = {0};
+            mask[node/(8*sizeof(unsigned long))] |= (1ul << (node % (8*sizeof(unsigned long))));
+            return syscall(SYS_set_mempolicy, DENDRO_MPOL_PREFERRED, mask, DENDRO_MEM_MAX_NODES);
+        #else
+            return -1;
+        #endif
+    }
+
+    PolicyAllocator::PolicyAllocator(unsigned int policy, size_t threshold)
+    {
+        m_uiPolicy = policy;
+        m_uiThreshold = threshold;
+    }
+
+    size_t PolicyAllocator::alignment(size_t bytes) const
+    {
+        if(bytes >= m_uiThreshold && (m_uiPolicy & MEM_POLICY_THP) && is_thp_enabled())
+            return DENDRO_MEM_HUGE_PAGE_SZ;
+
+        return DENDRO_MEM_ALIGN;
+    }
+
+    void* PolicyAllocator::allocate(size_t bytes, size_t align, unsigned int flags)
+    {
+        if(bytes==0)
+            return NULL;
+
+        align = std::max(std::max(align, this->alignment(bytes)), sizeof(void*));
+
+        // huge page aligned buffers are padded to full pages, so the advice does not leak to other allocations.
+        size_t sz = bytes;
+        if(align >= DENDRO_MEM_HUGE_PAGE_SZ)
+            sz = ((bytes + DENDRO_MEM_HUGE_PAGE_SZ -1)/DENDRO_MEM_HUGE_PAGE_SZ)*DENDRO_MEM_HUGE_PAGE_SZ;
+
+        void* p = NULL;
+        if(posix_memalign(&p, align, sz))
+        {
+            printf("[mem Error]: %s failed to allocate %zu bytes \n", __func__, sz);
+            int isMPIInit = 0;
+            MPI_Initialized(&isMPIInit);
+            if(isMPIInit)
+                MPI_Abort(MPI_COMM_WORLD, 1);
+            exit(EXIT_FAILURE);
+        }
+
+        this->advise(p, sz, flags);
+        return p;
+    }
+
+    void PolicyAllocator::deallocate(void* p, size_t bytes)
+    {
+        free(p);
+    }
+
+    void PolicyAllocator::advise(void* p, size_t bytes, unsigned int flags)
+    {
+        if(p==NULL || bytes < m_uiThreshold || m_uiPolicy==MEM_POLICY_DEFAULT)
+            return;
+
+        #ifdef __linux__
+            // only the pages fully inside the buffer are advised.
+            const size_t pgSz = sysconf(_SC_PAGESIZE);
+            const size_t b = ((((size_t)p) + pgSz -1)/pgSz)*pgSz;
+            const size_t e = ((((size_t)p) + bytes)/pgSz)*pgSz;
+            if(e <= b)
+                return;
+
+            #ifdef MADV_HUGEPAGE
+                if(m_uiPolicy & MEM_POLICY_THP)
+                    madvise((void*)b, e-b, MADV_HUGEPAGE);
+            #endif
+
+            #ifdef SYS_mbind
+                unsigned long mask[DENDRO_MEM_MAX_NODES/(8*sizeof(unsigned long))] = {0};
+                if(m_uiPolicy & MEM_POLICY_NUMA_LOCAL)
+                {
+                    // buffers first touched by all the threads keep the default (first touch) placement, binding them to the 
+                    // node of the allocating thread would undo it. 
+                    if(!(flags & MEM_ALLOC_PARALLEL_TOUCH))
+                    {
+                        const int node = get_numa_node();
+                        mask[node/(8*sizeof(unsigned long))] |= (1ul << (node % (8*sizeof(unsigned long))));
+                        syscall(SYS_mbind, b, e-b, DENDRO_MPOL_PREFERRED, mask, DENDRO_MEM_MAX_NODES, 0);
+                    }
+
+                }else if(m_uiPolicy & MEM_POLICY_NUMA_INTERLEAVE)
+                {
+                    #ifdef SYS_get_mempolicy
+                        if(syscall(SYS_get_mempolicy, NULL, mask, DENDRO_MEM_MAX_NODES, NULL, DENDRO_MPOL_F_MEMS_ALLOWED)==0)
+                            syscall(SYS_mbind, b, e-b, DENDRO_MPOL_INTERLEAVE, mask, DENDRO_MEM_MAX_NODES, 0);
+                    #endif
+                }
+            #endif
+
+        #endif
+
+        return;
+    }
+
+}// end of namespace mem
@@ -27,55 +27,188 @@
 #include "memory_pool.h"
 
 #include <cstdlib>
+#include <iostream>
+#include <cassert>
 
-memory_pool::memory_pool(unsigned int pad, unsigned int align) {
-  m_uiPadding = pad;
-  m_uiAlignment = align;
+// marks the header of the pool blocks
+#define MEM_POOL_MAGIC 0xD5B10C4Bu
+
+memory_pool::memory_pool(unsigned int align, unsigned int numThreads, unsigned int tcacheSz) {
+  // constructs the default allocator before the pool, so it outlives the static pools (purge in the destructor).
+  mem::get_allocator();
+
+  m_uiAlignment = DENDRO_MEM_ALIGN;
+  while (m_uiAlignment < align)
+    m_uiAlignment <<= 1;
+
+  m_uiTCacheSz = tcacheSz;
+
+  if (numThreads == 0)
+    numThreads = omp_get_max_threads();
+
+  m_vecThreadCache.resize(numThreads);
+  m_sharedCounters.allocs = 0;
+  m_sharedCounters.hits = 0;
+  m_sharedCounters.frees = 0;
+  m_sharedCounters.shared = 0;
+
+  m_ulCount = 0;
+  m_ulReserved = 0;
+  reset_stats();
 }
 
 memory_pool::~memory_pool() {
-  
+  purge();
+}
+
+unsigned int
+memory_pool::size_class(size_t bytes, size_t& csz) const {
+  // padded size, then the smallest class (4 classes per power of 2) that fits.
+  const size_t s = ((bytes + m_uiAlignment - 1) / m_uiAlignment) * m_uiAlignment;
+  const unsigned int e = 63 - __builtin_clzl(s);
+  const size_t q = 1ul << (e - 2);
+  const size_t m = (s + q - 1) / q;
+
+  csz = m * q;
+  return (e - 2) * 4 + (m - 4);
+}
+
+size_t
+memory_pool::class_size(unsigned int c) {
+  return ((size_t)(4 + (c & 3u))) << (c >> 2);
 }
 
-// basic ops. block based only. of size (sz +2*pad)^3 
-double* 
-memory_pool::allocate(unsigned int sz) {
-  // 1. find if a free block of size exists.
-  for (auto x: m_vecBlocks) {
-    if (x.size == sz && x.free) {
-      x.free = false;
-      return x.data;
+memory_pool::thread_cache*
+memory_pool::get_thread_cache() {
+  // the cache of the thread in the (only) active team, threads of nested active teams use the shared lists.
+  const int level = omp_get_level();
+  int tid = 0;
+  bool isActive = false;
+  for (int l = 1; l <= level; l++) {
+    if (omp_get_team_size(l) > 1) {
+      if (isActive)
+        return NULL;
+      isActive = true;
+      tid = omp_get_ancestor_thread_num(l);
     }
   }
-  // 2. did not find a free block, create a new one.
-  mem_blk blk(sz);
-  double *buf; 
-  unsigned long len = (sz+m_uiPadding)*(sz+m_uiPadding)*(sz+m_uiPadding);
-  
-  // todo @hari allocate properly to be aligned in 3d
-  posix_memalign((void **)&buf, m_uiAlignment, (len)*sizeof(double)); 
-  
-  blk.data = buf;
-  blk.free = false;
-  
-  m_vecBlocks.push_back(blk);
-  
-  m_ulCount += len*sizeof(double);
-  
-  return buf;
+
+  if (tid >= (int)m_vecThreadCache.size())
+    return NULL;
+
+  return &m_vecThreadCache[tid];
 }
 
-void    
-memory_pool::free(double* buf) {
-  for (auto x: m_vecBlocks) {
-    if (x.data == buf) {
-      x.free = true;
-      unsigned long len = (x.size+m_uiPadding)*(x.size+m_uiPadding)*(x.size+m_uiPadding);
-      m_ulCount -= len*sizeof(double);
-      return;
+void
+memory_pool::update_used(long bytes) {
+  unsigned long u;
+  #pragma omp atomic capture
+  { m_ulCount += bytes; u = m_ulCount; }
+
+  unsigned long hw;
+  #pragma omp atomic read
+  hw = m_ulHighWater;
+
+  if (bytes > 0 && u > hw) {
+    #pragma omp critical (mem_pool_high_water)
+    { if (u > m_ulHighWater) m_ulHighWater = u; }
+  }
+}
+
+void
+memory_pool::update_reserved(long bytes) {
+  unsigned long u;
+  #pragma omp atomic capture
+  { m_ulReserved += bytes; u = m_ulReserved; }
+
+  unsigned long hw;
+  #pragma omp atomic read
+  hw = m_ulHighWaterReserved;
+
+  if (bytes > 0 && u > hw) {
+    #pragma omp critical (mem_pool_high_water)
+    { if (u > m_ulHighWaterReserved) m_ulHighWaterReserved = u; }
+  }
+}
+
+void*
+memory_pool::allocate(size_t bytes) {
+  if (bytes == 0)
+    return NULL;
+
+  size_t csz;
+  const unsigned int c = size_class(bytes, csz);
+  assert(c < MEM_POOL_NUM_CLASSES);
+
+  void* buf = NULL;
+  thread_cache* tc = get_thread_cache();
+
+  // 1. thread cache
+  if (tc != NULL) {
+    tc->allocs++;
+    if (!tc->blocks[c].empty()) {
+      buf = tc->blocks[c].back();
+      tc->blocks[c].pop_back();
+      tc->hits++;
     }
   }
-  std::cout << "memory_pool error: trying to free block not allocated by mempool."
+
+  // 2. shared free list of the class
+  if (buf == NULL) {
+    #pragma omp critical (mem_pool_shared)
+    {
+      if (tc == NULL)
+        m_sharedCounters.allocs++;
+      (tc != NULL) ? tc->shared++ : m_sharedCounters.shared++;
+
+      if (!m_vecBlocks[c].empty()) {
+        buf = m_vecBlocks[c].back();
+        m_vecBlocks[c].pop_back();
+        (tc != NULL) ? tc->hits++ : m_sharedCounters.hits++;
+      }
+    }
+  }
+
+  // 3. new block, the header (one alignment unit) stores the size class.
+  if (buf == NULL) {
+    char* base = mem::alloc<char>(csz + m_uiAlignment, m_uiAlignment);
+    ((unsigned int*)base)[0] = c;
+    ((unsigned int*)base)[1] = MEM_POOL_MAGIC;
+    buf = base + m_uiAlignment;
+    update_reserved(csz);
+  }
+
+  update_used(csz);
+  return buf;
+}
+
+void
+memory_pool::free(void* buf) {
+  if (buf == NULL)
+    return;
+
+  const unsigned int* header = (const unsigned int*)((char*)buf - m_uiAlignment);
+  if (header[1] != MEM_POOL_MAGIC) {
+    std::cout << "memory_pool error: trying to free block not allocated by mempool." << std::endl;
+    return;
+  }
+
+  const unsigned int c = header[0];
+  update_used(-(long)class_size(c));
+
+  thread_cache* tc = get_thread_cache();
+  if (tc != NULL && tc->blocks[c].size() < m_uiTCacheSz) {
+    tc->blocks[c].push_back(buf);
+    tc->frees++;
+    return;
+  }
+
+  #pragma omp critical (mem_pool_shared)
+  {
+    m_vecBlocks[c].push_back(buf);
+    (tc != NULL) ? tc->frees++ : m_sharedCounters.frees++;
+    (tc != NULL) ? tc->shared++ : m_sharedCounters.shared++;
+  }
 }
 
 // how much memory is currently used by the pool
@@ -84,14 +217,65 @@ memory_pool::used() {
   return m_ulCount;
 }
 
-// delete all allocated blocks.
+mem_pool_stats
+memory_pool::get_stats() {
+  mem_pool_stats st;
+  st.allocs = m_sharedCounters.allocs;
+  st.hits = m_sharedCounters.hits;
+  st.frees = m_sharedCounters.frees;
+  st.shared = m_sharedCounters.shared;
+  for (unsigned int t = 0; t < m_vecThreadCache.size(); t++) {
+    st.allocs += m_vecThreadCache[t].allocs;
+    st.hits += m_vecThreadCache[t].hits;
+    st.frees += m_vecThreadCache[t].frees;
+    st.shared += m_vecThreadCache[t].shared;
+  }
+
+  st.used = m_ulCount;
+  st.reserved = m_ulReserved;
+  st.high_water = m_ulHighWater;
+  st.high_water_reserved = m_ulHighWaterReserved;
+  return st;
+}
+
+void
+memory_pool::reset_stats() {
+  for (unsigned int t = 0; t < m_vecThreadCache.size(); t++) {
+    m_vecThreadCache[t].allocs = 0;
+    m_vecThreadCache[t].hits = 0;
+    m_vecThreadCache[t].frees = 0;
+    m_vecThreadCache[t].shared = 0;
+  }
+  m_sharedCounters.allocs = 0;
+  m_sharedCounters.hits = 0;
+  m_sharedCounters.frees = 0;
+  m_sharedCounters.shared = 0;
+
+  m_ulHighWater = m_ulCount;
+  m_ulHighWaterReserved = m_ulReserved;
+}
+
+// delete all the free blocks.
 void 
 memory_pool::purge() {
-  for (auto x: m_vecBlocks) {
-    if (x.data != NULL) {
-      delete [] x.data;
-      x.data = NULL;
+  for (unsigned int t = 0; t <= m_vecThreadCache.size(); t++) {
+    std::vector<void*>* blocks = (t < m_vecThreadCache.size()) ? m_vecThreadCache[t].blocks : m_vecBlocks;
+    for (unsigned int c = 0; c < MEM_POOL_NUM_CLASSES; c++) {
+      const size_t csz = class_size(c);
+      for (unsigned int k = 0; k < blocks[c].size(); k++) {
+        mem::dealloc((char*)blocks[c][k] - m_uiAlignment, csz + m_uiAlignment);
+        update_reserved(-(long)csz);
+      }
+      blocks[c].clear();
+      blocks[c].shrink_to_fit();
     }
   }
-  m_vecBlocks.clear();
+}
+
+namespace mem
+{
+  memory_pool* get_pool() {
+    static memory_pool pool;
+    return &pool;
+  }
 }
@@ -148,7 +148,10 @@ namespace ot {
             t_e2e = t_e2e_end - t_e2e_begin;
 
             if(smType == SM_TYPE::E2E_ONLY)
+            {
+                std::vector<uint128_t>().swap(m_uiAllElementKeys);
                 return;
+            }
 
             double t_e2n_begin = MPI_Wtime();
             if(smType==SM_TYPE::FDM)
@@ -196,6 +199,9 @@ namespace ot {
                 performBlocksSetup();
                 computeSMSpecialPts();
             }
+
+            // element keys are only needed during the construction.
+            std::vector<uint128_t>().swap(m_uiAllElementKeys);
                 
             double t_blk_end = MPI_Wtime();
             t_blk = t_blk_end - t_blk_begin;
@@ -280,7 +286,7 @@ namespace ot {
     }
 
 
-    Mesh::Mesh(std::vector<ot::TreeNode> &in, unsigned int k_s, unsigned int pOrder,MPI_Comm comm,bool pBlockSetup, SM_TYPE smType, unsigned int grainSz,double ld_tol,unsigned int sf_k,unsigned int (*getWeight)(const ot::TreeNode *), unsigned int coarsetBlkLev)
+    Mesh::Mesh(std::vector<ot::TreeNode> &in, unsigned int k_s, unsigned int pOrder,MPI_Comm comm,bool pBlockSetup, SM_TYPE smType, unsigned int grainSz,double ld_tol,unsigned int sf_k,unsigned int (*getWeight)(const ot::TreeNode *), unsigned int coarsetBlkLev, unsigned int (*getConstraint)(const ot::TreeNode *))
     {
 
         m_uiCommGlobal=comm;
@@ -319,7 +325,7 @@ namespace ot {
             par::splitComm2way(m_uiIsActive,&m_uiCommActive,m_uiCommGlobal);
         }
 
-        shrinkOrExpandOctree(in,ld_tol,sf_k,m_uiIsActive,m_uiCommActive,m_uiCommGlobal,getWeight);
+        shrinkOrExpandOctree(in,ld_tol,sf_k,m_uiIsActive,m_uiCommActive,m_uiCommGlobal,getWeight,getConstraint);
 
         m_uiMeshDomain_min=0;
         m_uiMeshDomain_max=(1u<<(m_uiMaxDepth));
@@ -409,7 +415,10 @@ namespace ot {
             t_e2e=t_e2e_end-t_e2e_begin;
 
             if(smType == SM_TYPE::E2E_ONLY)
+            {
+                std::vector<uint128_t>().swap(m_uiAllElementKeys);
                 return;
+            }
 
             double t_e2n_begin=MPI_Wtime();
             
@@ -458,6 +467,9 @@ namespace ot {
                 performBlocksSetup();
                 computeSMSpecialPts();
             }
+
+            // element keys are only needed during the construction.
+            std::vector<uint128_t>().swap(m_uiAllElementKeys);
                 
 
             double t_blk_end=MPI_Wtime();
@@ -582,12 +594,218 @@ namespace ot {
         m_uiRecvProcList.clear();
         m_uiE2BlkMap.clear();
 
+        if(m_uiIsShmSetup)
+            freeShmGhostExchange();
+
         MPI_Comm_free(&m_uiCommActive);
 
 
     }
 
 
+    void Mesh::setupShmGhostExchange()
+    {
+        m_uiIsShmSetup=true;
+        const unsigned int npes=m_uiActiveNpes;
+
+        MPI_Comm_split_type(m_uiCommActive,MPI_COMM_TYPE_SHARED,m_uiActiveRank,MPI_INFO_NULL,&m_uiCommNodeShm);
+
+        // active rank -> node local rank.
+        MPI_Group activeGroup, nodeGroup;
+        MPI_Comm_group(m_uiCommActive,&activeGroup);
+        MPI_Comm_group(m_uiCommNodeShm,&nodeGroup);
+
+        std::vector<int> activeRanks(npes);
+        for(unsigned int p=0;p<npes;p++)
+            activeRanks[p]=p;
+
+        m_uiShmNodeRank.resize(npes);
+        MPI_Group_translate_ranks(activeGroup,npes,activeRanks.data(),nodeGroup,m_uiShmNodeRank.data());
+        MPI_Group_free(&activeGroup);
+        MPI_Group_free(&nodeGroup);
+
+        // layout of one ring unit, on node send nodes ordered by the send proc list.
+        m_uiShmSendOffset.resize(npes,0);
+        m_uiShmSendTotal=0;
+        for(unsigned int i=0;i<m_uiSendProcList.size();i++)
+        {
+            const unsigned int p=m_uiSendProcList[i];
+            if(m_uiShmNodeRank[p]==MPI_UNDEFINED) continue;
+            m_uiShmSendOffset[p]=m_uiShmSendTotal;
+            m_uiShmSendTotal+=m_uiSendNodeCount[p];
+        }
+
+        // on node senders need to tell us where our data lives in their ring.
+        const int setupTag=1;
+        std::vector<unsigned int> sendInfo(2*m_uiSendProcList.size());
+        std::vector<unsigned int> recvInfo(2*m_uiRecvProcList.size());
+        std::vector<MPI_Request> reqs;
+        reqs.reserve(m_uiSendProcList.size()+m_uiRecvProcList.size());
+
+        for(unsigned int i=0;i<m_uiRecvProcList.size();i++)
+        {
+            const unsigned int p=m_uiRecvProcList[i];
+            if(m_uiShmNodeRank[p]==MPI_UNDEFINED) continue;
+            reqs.push_back(MPI_REQUEST_NULL);
+            MPI_Irecv(&recvInfo[2*i],2,MPI_UNSIGNED,m_uiShmNodeRank[p],setupTag,m_uiCommNodeShm,&reqs.back());
+        }
+
+        for(unsigned int i=0;i<m_uiSendProcList.size();i++)
+        {
+            const unsigned int p=m_uiSendProcList[i];
+            if(m_uiShmNodeRank[p]==MPI_UNDEFINED) continue;
+            sendInfo[2*i]=m_uiShmSendOffset[p];
+            sendInfo[2*i+1]=m_uiShmSendTotal;
+            reqs.push_back(MPI_REQUEST_NULL);
+            MPI_Isend(&sendInfo[2*i],2,MPI_UNSIGNED,m_uiShmNodeRank[p],setupTag,m_uiCommNodeShm,&reqs.back());
+        }
+
+        // ranks are placed in separate pages, so that each rank's ring is first touched by its owner.
+        MPI_Info info;
+        MPI_Info_create(&info);
+        MPI_Info_set(info,"alloc_shared_noncontig","true");
+        const MPI_Aint winBytes=(MPI_Aint)DENDRO_SHM_GHOST_NUM_SLOTS*m_uiShmSendTotal*sizeof(double);
+        MPI_Win_allocate_shared(winBytes,1,info,m_uiCommNodeShm,&m_uiShmBase,&m_uiShmWin);
+        MPI_Info_free(&info);
+
+        MPI_Waitall(reqs.size(),reqs.data(),MPI_STATUSES_IGNORE);
+
+        m_uiShmRecvBase.resize(npes,NULL);
+        m_uiShmRecvUnitBytes.resize(npes,0);
+        m_uiShmRecvOffset.resize(npes,0);
+
+        for(unsigned int i=0;i<m_uiRecvProcList.size();i++)
+        {
+            const unsigned int p=m_uiRecvProcList[i];
+            if(m_uiShmNodeRank[p]==MPI_UNDEFINED) continue;
+
+            MPI_Aint sz;
+            int dispUnit;
+            char* base;
+            MPI_Win_shared_query(m_uiShmWin,m_uiShmNodeRank[p],&sz,&dispUnit,&base);
+
+            m_uiShmRecvBase[p]=base;
+            m_uiShmRecvOffset[p]=recvInfo[2*i];
+            m_uiShmRecvUnitBytes[p]=recvInfo[2*i+1]*sizeof(double);
+        }
+
+        // passive target epoch for the lifetime of the mesh, synchronization is done with MPI_Win_sync + notifications.
+        MPI_Win_lock_all(MPI_MODE_NOCHECK,m_uiShmWin);
+
+        m_uiShmRingPos=0;
+        m_uiShmSeq=0;
+        m_uiShmSlots.clear();
+
+    }
+
+    void Mesh::freeShmGhostExchange()
+    {
+        // wait until the on node receivers are done with the ring.
+        for(unsigned int i=0;i<m_uiShmSlots.size();i++)
+            MPI_Waitall(m_uiShmSlots[i].ackRequests.size(),m_uiShmSlots[i].ackRequests.data(),MPI_STATUSES_IGNORE);
+
+        m_uiShmSlots.clear();
+
+        MPI_Win_unlock_all(m_uiShmWin);
+        MPI_Win_free(&m_uiShmWin);
+        MPI_Comm_free(&m_uiCommNodeShm);
+
+        m_uiShmBase=NULL;
+        m_uiIsShmSetup=false;
+    }
+
+    bool Mesh::acquireShmRingSlot(unsigned int units, unsigned int& unit, unsigned int& seq)
+    {
+        // note: notifications (sender -> receiver) use the tag 2*seq and the acknowledgements (receiver -> sender) 2*seq+1
+    #ifndef DENDRO_SHM_GHOST_EXCHANGE
+        return false;
+    #else
+        if(!m_uiIsShmSetup)
+            setupShmGhostExchange();
+
+        if(units > DENDRO_SHM_GHOST_NUM_SLOTS)
+            return false;
+
+        const unsigned int uBegin = ((m_uiShmRingPos+units) > DENDRO_SHM_GHOST_NUM_SLOTS) ? 0 : m_uiShmRingPos;
+        const unsigned int uEnd = uBegin + units;
+
+        // ring units still in use by an exchange that is not ended (too many exchanges in flight).
+        for(unsigned int i=0;i<m_uiShmSlots.size();i++)
+            if(!m_uiShmSlots[i].isEnded && m_uiShmSlots[i].begin < uEnd && uBegin < m_uiShmSlots[i].end)
+                return false;
+
+        // ended exchanges overlapping the units, wait for the on node receivers to finish reading them.
+        for(unsigned int i=0;i<m_uiShmSlots.size();)
+        {
+            if(m_uiShmSlots[i].begin < uEnd && uBegin < m_uiShmSlots[i].end)
+            {
+                MPI_Waitall(m_uiShmSlots[i].ackRequests.size(),m_uiShmSlots[i].ackRequests.data(),MPI_STATUSES_IGNORE);
+                m_uiShmSlots.erase(m_uiShmSlots.begin()+i);
+            }else
+                i++;
+        }
+
+        unit=uBegin;
+        seq=m_uiShmSeq;
+        m_uiShmRingPos=uEnd;
+        m_uiShmSeq=(m_uiShmSeq+1)%(1u<<14);
+
+        ShmRingSlot slot;
+        slot.seq=seq;
+        slot.begin=uBegin;
+        slot.end=uEnd;
+        slot.isEnded=false;
+
+        for(unsigned int i=0;i<m_uiSendProcList.size();i++)
+        {
+            const unsigned int p=m_uiSendProcList[i];
+            if(m_uiShmNodeRank[p]==MPI_UNDEFINED) continue;
+            slot.ackRequests.push_back(MPI_REQUEST_NULL);
+            MPI_Irecv(NULL,0,MPI_BYTE,m_uiShmNodeRank[p],2*seq+1,m_uiCommNodeShm,&slot.ackRequests.back());
+        }
+
+        m_uiShmSlots.push_back(slot);
+
+        // make sure the ring reads of the receivers are complete before we overwrite. 
+        MPI_Win_sync(m_uiShmWin);
+        return true;
+    #endif
+    }
+
+    void Mesh::releaseShmRingSlot(unsigned int seq)
+    {
+        // order the ring reads before the acknowledgement.
+        MPI_Win_sync(m_uiShmWin);
+
+        std::vector<MPI_Request> reqs;
+        reqs.reserve(m_uiRecvProcList.size());
+        for(unsigned int i=0;i<m_uiRecvProcList.size();i++)
+        {
+            const unsigned int p=m_uiRecvProcList[i];
+            if(m_uiShmNodeRank[p]==MPI_UNDEFINED) continue;
+            reqs.push_back(MPI_REQUEST_NULL);
+            MPI_Isend(NULL,0,MPI_BYTE,m_uiShmNodeRank[p],2*seq+1,m_uiCommNodeShm,&reqs.back());
+        }
+
+        // the matching receives are posted when the sender acquired the slot.
+        MPI_Waitall(reqs.size(),reqs.data(),MPI_STATUSES_IGNORE);
+
+        for(unsigned int i=0;i<m_uiShmSlots.size();i++)
+        {
+            if(m_uiShmSlots[i].seq==seq)
+            {
+                m_uiShmSlots[i].isEnded=true;
+                break;
+            }
+        }
+
+    }
+
+    void Mesh::computeAllElementKeys()
+    {
+        SFC::seqSearch::SFC_octantKeys(m_uiAllElements.data(),m_uiAllElements.size(),m_uiMaxDepth,m_uiAllElementKeys);
+    }
+
     void Mesh::generateSearchKeys()
     {
         // should not be called if the mesh is not active
@@ -679,35 +897,8 @@ namespace ot {
             }
         }
 
-       SearchKey rootSkey(m_uiDim,m_uiMaxDepth);
-       std::vector<SearchKey> tmpSKeys;
-       SFC::seqSort::SFC_treeSort(&(*(skeys.begin())),skeys.size(),tmpSKeys,tmpSKeys,tmpSKeys,m_uiMaxDepth,m_uiMaxDepth,rootSkey,ROOT_ROTATION,1,TS_SORT_ONLY);
-       assert(seq::test::isSorted(skeys));
-
-       Key tmpKey;
-       unsigned int skip=0;
-       for(unsigned int e=0;e<(skeys.size());e++)
-       {
-           tmpKey=Key(skeys[e].getX(),skeys[e].getY(),skeys[e].getZ(),skeys[e].getLevel(),m_uiDim,m_uiMaxDepth);
-           if(skeys[e].getOwner()>=0){
-               tmpKey.addOwner(skeys[e].getOwner());
-               tmpKey.addStencilIndexAndDirection(K-1,skeys[e].getStencilIndexDirectionList());
-           }
-
-           skip=1;
-           while(((e+skip)<skeys.size()) && (skeys[e]==skeys[e+skip]))
-           {
-               if(skeys[e+skip].getOwner()>=0){
-                   tmpKey.addOwner(skeys[e+skip].getOwner());
-                   tmpKey.addStencilIndexAndDirection(K-1,skeys[e+skip].getStencilIndexDirectionList());
-               }
-               skip++;
-           }
-
-           m_uiKeys.push_back(tmpKey);
-           e+=(skip-1);
-
-       }
+       // sort and merge the duplicate keys, owners are stored in CSR form.
+       mergeKeys(skeys,m_uiKeys);
 
 
        skeys.clear();
@@ -887,38 +1078,10 @@ namespace ot {
         }
 
 
-        SearchKey rootSkey(m_uiDim,m_uiMaxDepth);
-        std::vector<SearchKey> tmpSKeys;
-        SFC::seqSort::SFC_treeSort(&(*(skeys.begin())),skeys.size(),tmpSKeys,tmpSKeys,tmpSKeys,m_uiMaxDepth,m_uiMaxDepth,rootSkey,ROOT_ROTATION,1,TS_SORT_ONLY);
-        assert(seq::test::isSorted(skeys));
-
 
         //std::cout<<"rank: "<<m_uiActiveRank<<" skeys: "<<skeys.size()<<" pre local post: "<<m_uiElementPreGhostEnd<<" "<<m_uiElementLocalEnd<<" "<<m_uiElementPostGhostEnd<<std::endl;
-
-        Key tmpKey;
-        unsigned int skip=0;
-        for(unsigned int e=0;e<(skeys.size());e++)
-        {
-            tmpKey=Key(skeys[e].getX(),skeys[e].getY(),skeys[e].getZ(),skeys[e].getLevel(),m_uiDim,m_uiMaxDepth);
-            if(skeys[e].getOwner()>=0){
-                tmpKey.addOwner(skeys[e].getOwner());
-                tmpKey.addStencilIndexAndDirection(K-1,skeys[e].getStencilIndexDirectionList());
-            }
-
-            skip=1;
-            while(((e+skip)<skeys.size()) && (skeys[e]==skeys[e+skip]))
-            {
-                if(skeys[e+skip].getOwner()>=0){
-                    tmpKey.addOwner(skeys[e+skip].getOwner());
-                    tmpKey.addStencilIndexAndDirection(K-1,skeys[e+skip].getStencilIndexDirectionList());
-                }
-                skip++;
-            }
-
-            m_uiGhostKeys.push_back(tmpKey);
-            e+=(skip-1);
-
-        }
+        // sort and merge the duplicate keys, owners are stored in CSR form.
+        mergeKeys(skeys,m_uiGhostKeys);
 
 
 
@@ -1412,35 +1575,8 @@ namespace ot {
            }
        }
 
-        SearchKey rootSkey(m_uiDim,m_uiMaxDepth);
-        std::vector<SearchKey> tmpSKeys;
-        SFC::seqSort::SFC_treeSort(&(*(skeys.begin())),skeys.size(),tmpSKeys,tmpSKeys,tmpSKeys,m_uiMaxDepth,m_uiMaxDepth,rootSkey,ROOT_ROTATION,1,TS_SORT_ONLY);
-        assert(seq::test::isSorted(skeys));
-
-        Key tmpKey;
-        unsigned int skip=0;
-        for(unsigned int e=0;e<(skeys.size());e++)
-        {
-            tmpKey=Key(skeys[e].getX(),skeys[e].getY(),skeys[e].getZ(),skeys[e].getLevel(),m_uiDim,m_uiMaxDepth);
-            if(skeys[e].getOwner()>=0){
-                tmpKey.addOwner(skeys[e].getOwner());
-                tmpKey.addStencilIndexAndDirection(K-1,skeys[e].getStencilIndexDirectionList());
-            }
-
-            skip=1;
-            while(((e+skip)<skeys.size()) && (skeys[e]==skeys[e+skip]))
-            {
-                if(skeys[e+skip].getOwner()>=0){
-                    tmpKey.addOwner(skeys[e+skip].getOwner());
-                    tmpKey.addStencilIndexAndDirection(K-1,skeys[e+skip].getStencilIndexDirectionList());
-                }
-                skip++;
-            }
-
-            m_uiKeysDiag.push_back(tmpKey);
-            e+=(skip-1);
-
-        }
+        // sort and merge the duplicate keys, owners are stored in CSR form.
+        mergeKeys(skeys,m_uiKeysDiag);
 
 
        skeys.clear();
@@ -1462,11 +1598,9 @@ namespace ot {
         std::swap(m_uiEmbeddedOctree, in);
         in.clear();
 
-        // Below Key vector and ot::TreeNode vector is being use for sorting Keys and treeNodes repeatedly. So make sure you clear them after using them in SFC_TreeSort.
-        std::vector<Key> tmpKeys;
+        // Below ot::TreeNode vector is being use for sorting treeNodes repeatedly. So make sure you clear them after using them in SFC_TreeSort.
         std::vector<ot::TreeNode> tmpNodes;
 
-        Key rootKey(0, 0, 0, (OCT_KEY_NONE | 0), m_uiDim, m_uiMaxDepth);
         ot::TreeNode rootNode(0,0,0,0,m_uiDim,m_uiMaxDepth);
 
         assert(m_uiEmbeddedOctree.size()>1); // m_uiEmbedded octree cannot be empty.  (Remove this assertion once we handle this case. )
@@ -1517,13 +1651,15 @@ namespace ot {
 
         //4- Compute Face Neighbors (By sending owners of the key to the correct proc. )===================================================================================================================================================
 
-        SFC::seqSort::SFC_treeSort(&(*(m_uiKeys.begin())), m_uiKeys.size(), tmpKeys, tmpKeys, tmpKeys, m_uiMaxDepth,m_uiMaxDepth, rootKey, 0, 1, TS_SORT_ONLY);
-        tmpKeys.clear();
-        assert(seq::test::isUniqueAndSorted(m_uiKeys));
+        // keys are sorted and unique after mergeKeys (owner rows are positional, so they should not be re-sorted).
+        assert(seq::test::isUniqueAndSorted(m_uiKeys.keys()));
 
 
         #ifdef DEBUG_MESH_GENERATION
-                treeNodesTovtk(m_uiKeys,rank,"m_uiKeys",false);
+            {
+                std::vector<ot::FlatKey> keys_vec=m_uiKeys.keys();
+                treeNodesTovtk(keys_vec,rank,"m_uiKeys",false);
+            }
         #endif
 
 
@@ -1540,7 +1676,7 @@ namespace ot {
         m_uiSendOctOffsetRound1 = new unsigned int[npes];
         m_uiRecvOctOffsetRound1 = new unsigned int[npes];
 
-        Key * m_uiKeysPtr=&(*(m_uiKeys.begin()));
+        ot::KeyCSR * m_uiKeysPtr=&m_uiKeys;
 
 
         std::vector<Key> splitterElements;
@@ -1552,7 +1688,7 @@ namespace ot {
 
 
         // search element splitters in the keys, to determine who owns the keys.
-        SFC::seqSearch::SFC_treeSearch(&(*(splitterElements.begin())),&(*(m_uiKeys.begin())),0,splitterElements.size(),0,m_uiKeys.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+        SFC::seqSearch::SFC_treeSearch(&(*(splitterElements.begin())),m_uiKeys.data(),0,splitterElements.size(),0,m_uiKeys.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
 
 
         // send owners of the keys to the key owner. (R1-a ghost exchange.)
@@ -1574,10 +1710,10 @@ namespace ot {
             if(p!=m_uiActiveRank)
             for(unsigned int k=sBegin;k<sEnd;k++)
             {
-                for (unsigned int w = 0; w < m_uiKeysPtr[k].getOwnerList()->size(); w++)
-                    m_uiGhostElementIDsToBeSent.push_back((*(m_uiKeysPtr[k].getOwnerList()))[w]);
+                for (unsigned int w = 0; w < m_uiKeysPtr->getOwnerListSize(k); w++)
+                    m_uiGhostElementIDsToBeSent.push_back(m_uiKeysPtr->getOwnerList(k)[w]);
 
-                 m_uiSendKeyCount[p]+=m_uiKeysPtr[k].getOwnerList()->size();
+                 m_uiSendKeyCount[p]+=m_uiKeysPtr->getOwnerListSize(k);
 
             }
 
@@ -1585,7 +1721,7 @@ namespace ot {
         }
 
 
-        par::Mpi_Alltoall(m_uiSendKeyCount,m_uiRecvKeyCount,1,comm);
+        par::Mpi_Alltoall_NBX(m_uiSendKeyCount,m_uiRecvKeyCount,comm);
 
         m_uiSendKeyOffset[0]=0;
         m_uiRecvKeyOffset[0]=0;
@@ -1627,24 +1763,17 @@ namespace ot {
                 }
         #endif
 
-        par::Mpi_Alltoall(m_uiSendOctCountRound1,m_uiRecvOctCountRound1,1,comm);
-
         m_uiSendOctOffsetRound1[0]=0;
-        m_uiRecvOctOffsetRound1[0]=0;
-
         omp_par::scan(m_uiSendOctCountRound1,m_uiSendOctOffsetRound1,npes);
-        omp_par::scan(m_uiRecvOctCountRound1,m_uiRecvOctOffsetRound1,npes);
 
 
         for(unsigned int p=0;p<npes;p++)
             for(unsigned int k=0;k<scatterMapSend_R1[p].size();k++)
                 m_uiSendBufferElement.push_back(m_uiEmbeddedOctree[scatterMapSend_R1[p][k]]);
 
-
-        m_uiGhostOctants.resize(m_uiRecvOctOffsetRound1[npes - 1] + m_uiRecvOctCountRound1[npes - 1]);
-
-        par::Mpi_Alltoallv(&(*(m_uiSendBufferElement.begin())), (int *) m_uiSendOctCountRound1, (int *) m_uiSendOctOffsetRound1,
-                           &(*(m_uiGhostOctants.begin())), (int *) m_uiRecvOctCountRound1, (int *) m_uiRecvOctOffsetRound1, comm);
+        // recv counts are discovered by the sparse exchange (no count alltoall).
+        par::Mpi_Alltoallv_NBX(m_uiSendBufferElement.data(), (int *) m_uiSendOctCountRound1, (int *) m_uiSendOctOffsetRound1,
+                               m_uiGhostOctants, (int *) m_uiRecvOctCountRound1, (int *) m_uiRecvOctOffsetRound1, comm);
 
 
 
@@ -1656,6 +1785,7 @@ namespace ot {
         SFC::seqSort::SFC_treeSort(&(*(m_uiAllElements.begin())), m_uiAllElements.size(), tmpNodes, tmpNodes, tmpNodes, m_uiMaxDepth,m_uiMaxDepth, rootNode, 0, 1, TS_REMOVE_DUPLICATES);
         std::swap(m_uiAllElements, tmpNodes);
         tmpNodes.clear();
+        computeAllElementKeys();
 
         assert(seq::test::isUniqueAndSorted(m_uiAllElements));
 
@@ -1697,15 +1827,16 @@ namespace ot {
 
         // E2E Mapping for the Round 1 Ghost Exchange. Later we will perform another round of ghost exchange, (for the ghost elements that are hanging ) and build the correct complete E2E mapping.
 
-        SFC::seqSearch::SFC_treeSearch(&(*(m_uiKeys.begin())), &(*(m_uiAllElements.begin())), 0, m_uiKeys.size(), 0,m_uiAllElements.size(), m_uiMaxDepth, m_uiMaxDepth, 0);
+        SFC::seqSearch::SFC_treeSearchBatched(m_uiKeys.data(),m_uiAllElementKeys.data(),0,m_uiKeys.size(),0,m_uiAllElementKeys.size(),m_uiMaxDepth);
 
 
-        std::vector<unsigned int> *ownerList;
-        std::vector<unsigned int> *stencilIndexDirection;
+        const unsigned int *ownerList;
+        const unsigned int *stencilIndexDirection;
+        unsigned int numOwners;
         unsigned int result;
         unsigned int direction;
 
-        m_uiKeysPtr=&(*(m_uiKeys.begin()));
+        m_uiKeysPtr=&m_uiKeys;
         m_uiE2EMapping.resize(m_uiAllElements.size()*m_uiNumDirections,LOOK_UP_TABLE_DEFAULT);
 
         /**Neighbour list is made from
@@ -1714,15 +1845,16 @@ namespace ot {
         *  third z axis. (back to front)**/
 
         for (unsigned int k = 0; k < m_uiKeys.size(); k++) {
-            ownerList = m_uiKeysPtr[k].getOwnerList();
-            if(!(OCT_FOUND & m_uiKeysPtr[k].getFlag())) continue;// Note that some keys might not be found due to absence of diagonal keys at this stage. (but all the keys should be found after diagonal neighbour exchange. )
-            stencilIndexDirection = m_uiKeysPtr[k].getStencilIndexDirectionList();
-            result = m_uiKeysPtr[k].getSearchResult();
-            if(ownerList->size()) assert(m_uiAllElements[result].isAncestor(m_uiKeys[k]) || m_uiAllElements[result]==m_uiKeys[k]); // To check the result found in the treeSearch is correct or not.
+            ownerList = m_uiKeysPtr->getOwnerList(k);
+            numOwners = m_uiKeysPtr->getOwnerListSize(k);
+            if(!(OCT_FOUND & (*m_uiKeysPtr)[k].getFlag())) continue;// Note that some keys might not be found due to absence of diagonal keys at this stage. (but all the keys should be found after diagonal neighbour exchange. )
+            stencilIndexDirection = m_uiKeysPtr->getStencilIndexDirectionList(k);
+            result = (*m_uiKeysPtr)[k].getSearchResult();
+            if(numOwners) assert(m_uiAllElements[result].isAncestor(m_uiKeys[k]) || m_uiAllElements[result]==m_uiKeys[k]); // To check the result found in the treeSearch is correct or not.
 
-            for (unsigned int w = 0; w < ownerList->size(); w++) {
-                direction = ((*stencilIndexDirection)[w]) & KEY_DIR_OFFSET;
-                m_uiE2EMapping[(((*ownerList)[w]) + m_uiElementLocalBegin)*m_uiNumDirections+direction] = result;
+            for (unsigned int w = 0; w < numOwners; w++) {
+                direction = (stencilIndexDirection[w]) & KEY_DIR_OFFSET;
+                m_uiE2EMapping[((ownerList[w]) + m_uiElementLocalBegin)*m_uiNumDirections+direction] = result;
             }
 
         }
@@ -1732,23 +1864,24 @@ namespace ot {
         generateGhostElementSearchKeys();
 
 
-        SFC::seqSearch::SFC_treeSearch(&(*(m_uiGhostKeys.begin())),&(*(m_uiAllElements.begin())),0,m_uiGhostKeys.size(),0,m_uiAllElements.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+        SFC::seqSearch::SFC_treeSearchBatched(m_uiGhostKeys.data(),m_uiAllElementKeys.data(),0,m_uiGhostKeys.size(),0,m_uiAllElementKeys.size(),m_uiMaxDepth);
 
 
-        m_uiKeysPtr=&(*(m_uiGhostKeys.begin()));
+        m_uiKeysPtr=&m_uiGhostKeys;
         // Note : Since the ghost elements are not complete it is not required to find all the keys in the ghost.
         for (unsigned int k = 0; k < m_uiGhostKeys.size(); k++) {
-            ownerList = m_uiKeysPtr[k].getOwnerList();
+            ownerList = m_uiKeysPtr->getOwnerList(k);
+            numOwners = m_uiKeysPtr->getOwnerListSize(k);
 
-            if((OCT_FOUND & m_uiKeysPtr[k].getFlag())) {
+            if((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag())) {
 
-                stencilIndexDirection = m_uiKeysPtr[k].getStencilIndexDirectionList();
-                result = m_uiKeysPtr[k].getSearchResult();
-                if (ownerList->size()) assert(m_uiAllElements[result].isAncestor(m_uiGhostKeys[k]) || m_uiAllElements[result] ==  m_uiGhostKeys[k]); // To check the result found in the treeSearch is correct or not.
+                stencilIndexDirection = m_uiKeysPtr->getStencilIndexDirectionList(k);
+                result = (*m_uiKeysPtr)[k].getSearchResult();
+                if (numOwners) assert(m_uiAllElements[result].isAncestor(m_uiGhostKeys[k]) || m_uiAllElements[result] ==  m_uiGhostKeys[k]); // To check the result found in the treeSearch is correct or not.
 
-                for (unsigned int w = 0; w < ownerList->size(); w++) {
-                    direction = ((*stencilIndexDirection)[w]) & KEY_DIR_OFFSET;
-                    m_uiE2EMapping[(((*ownerList)[w])) * m_uiNumDirections + direction] = result;
+                for (unsigned int w = 0; w < numOwners; w++) {
+                    direction = (stencilIndexDirection[w]) & KEY_DIR_OFFSET;
+                    m_uiE2EMapping[((ownerList[w])) * m_uiNumDirections + direction] = result;
                 }
 
             }
@@ -1841,21 +1974,14 @@ namespace ot {
 
         elementOwner.clear();
 
-        par::Mpi_Alltoall(m_uiSendOctCountRound1,m_uiRecvOctCountRound1,1,comm);
-
         m_uiSendOctOffsetRound1[0]=0;
-        m_uiRecvOctOffsetRound1[0]=0;
-
         omp_par::scan(m_uiSendOctCountRound1,m_uiSendOctOffsetRound1,npes);
-        omp_par::scan(m_uiRecvOctCountRound1,m_uiRecvOctOffsetRound1,npes);
-
 
         m_uiGhostOctants.clear();
-        m_uiGhostOctants.resize(m_uiRecvOctOffsetRound1[npes - 1] + m_uiRecvOctCountRound1[npes - 1]);
 
         // exchange missed keys.
-        par::Mpi_Alltoallv(&(*(m_uiSendBufferElement.begin())), (int *) m_uiSendOctCountRound1, (int *) m_uiSendOctOffsetRound1,
-                           &(*(m_uiGhostOctants.begin())), (int *) m_uiRecvOctCountRound1, (int *) m_uiRecvOctOffsetRound1, comm);
+        par::Mpi_Alltoallv_NBX(m_uiSendBufferElement.data(), (int *) m_uiSendOctCountRound1, (int *) m_uiSendOctOffsetRound1,
+                               m_uiGhostOctants, (int *) m_uiRecvOctCountRound1, (int *) m_uiRecvOctOffsetRound1, comm);
 
 
         m_uiAllElements.insert(m_uiAllElements.end(), m_uiGhostOctants.begin(), m_uiGhostOctants.end());
@@ -1863,6 +1989,7 @@ namespace ot {
         SFC::seqSort::SFC_treeSort(&(*(m_uiAllElements.begin())), m_uiAllElements.size(), tmpNodes, tmpNodes, tmpNodes, m_uiMaxDepth,m_uiMaxDepth, rootNode, 0, 1, TS_REMOVE_DUPLICATES);
         std::swap(m_uiAllElements, tmpNodes);
         tmpNodes.clear();
+        computeAllElementKeys();
 
         assert(seq::test::isUniqueAndSorted(m_uiAllElements));
 
@@ -1917,9 +2044,9 @@ namespace ot {
 
         // E2E Mapping for the Round face-1 & face-2 face ghost exchange.
 
-        SFC::seqSearch::SFC_treeSearch(&(*(m_uiKeys.begin())), &(*(m_uiAllElements.begin())), 0, m_uiKeys.size(), 0,m_uiAllElements.size(), m_uiMaxDepth, m_uiMaxDepth, 0);
+        SFC::seqSearch::SFC_treeSearchBatched(m_uiKeys.data(),m_uiAllElementKeys.data(),0,m_uiKeys.size(),0,m_uiAllElementKeys.size(),m_uiMaxDepth);
 
-        m_uiKeysPtr=&(*(m_uiKeys.begin()));
+        m_uiKeysPtr=&m_uiKeys;
         m_uiE2EMapping.resize(m_uiAllElements.size()*m_uiNumDirections,LOOK_UP_TABLE_DEFAULT);
 
         /**Neighbour list is made from
@@ -1928,19 +2055,20 @@ namespace ot {
         *  third z axis. (back to front)**/
 
         for (unsigned int k = 0; k < m_uiKeys.size(); k++) {
-            ownerList = m_uiKeysPtr[k].getOwnerList();
-            if(ownerList->size() && (!((OCT_FOUND & m_uiKeysPtr[k].getFlag())))) {
-                std::cout<<"rank: "<<m_uiActiveRank<<"[E2E Error]: Local  face key missing after R1 face-1 & face-2 ghost exchange: "<<m_uiKeysPtr[k]<<std::endl;
+            ownerList = m_uiKeysPtr->getOwnerList(k);
+            numOwners = m_uiKeysPtr->getOwnerListSize(k);
+            if(numOwners && (!((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag())))) {
+                std::cout<<"rank: "<<m_uiActiveRank<<"[E2E Error]: Local  face key missing after R1 face-1 & face-2 ghost exchange: "<<(*m_uiKeysPtr)[k]<<std::endl;
                 exit(0);
             }
 
-            stencilIndexDirection = m_uiKeysPtr[k].getStencilIndexDirectionList();
-            result = m_uiKeysPtr[k].getSearchResult();
-            if(ownerList->size()) assert(m_uiAllElements[result].isAncestor(m_uiKeys[k]) || m_uiAllElements[result]==m_uiKeys[k]); // To check the result found in the treeSearch is correct or not.
+            stencilIndexDirection = m_uiKeysPtr->getStencilIndexDirectionList(k);
+            result = (*m_uiKeysPtr)[k].getSearchResult();
+            if(numOwners) assert(m_uiAllElements[result].isAncestor(m_uiKeys[k]) || m_uiAllElements[result]==m_uiKeys[k]); // To check the result found in the treeSearch is correct or not.
 
-            for (unsigned int w = 0; w < ownerList->size(); w++) {
-                direction = ((*stencilIndexDirection)[w]) & KEY_DIR_OFFSET;
-                m_uiE2EMapping[(((*ownerList)[w]) + m_uiElementLocalBegin)*m_uiNumDirections+direction] = result;
+            for (unsigned int w = 0; w < numOwners; w++) {
+                direction = (stencilIndexDirection[w]) & KEY_DIR_OFFSET;
+                m_uiE2EMapping[((ownerList[w]) + m_uiElementLocalBegin)*m_uiNumDirections+direction] = result;
             }
 
         }
@@ -1948,22 +2076,23 @@ namespace ot {
         m_uiGhostKeys.clear();
         generateGhostElementSearchKeys();
 
-        SFC::seqSearch::SFC_treeSearch(&(*(m_uiGhostKeys.begin())),&(*(m_uiAllElements.begin())),0,m_uiGhostKeys.size(),0,m_uiAllElements.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+        SFC::seqSearch::SFC_treeSearchBatched(m_uiGhostKeys.data(),m_uiAllElementKeys.data(),0,m_uiGhostKeys.size(),0,m_uiAllElementKeys.size(),m_uiMaxDepth);
 
 
-        m_uiKeysPtr=&(*(m_uiGhostKeys.begin()));
+        m_uiKeysPtr=&m_uiGhostKeys;
         // Note : Since the ghost elements are not complete it is not required to find all the keys in the ghost.
         for (unsigned int k = 0; k < m_uiGhostKeys.size(); k++) {
-            ownerList = m_uiKeysPtr[k].getOwnerList();
+            ownerList = m_uiKeysPtr->getOwnerList(k);
+            numOwners = m_uiKeysPtr->getOwnerListSize(k);
 
-            if((OCT_FOUND & m_uiKeysPtr[k].getFlag())) {
-                stencilIndexDirection = m_uiKeysPtr[k].getStencilIndexDirectionList();
-                result = m_uiKeysPtr[k].getSearchResult();
-                if (ownerList->size()) assert(m_uiAllElements[result].isAncestor(m_uiGhostKeys[k]) || m_uiAllElements[result] ==  m_uiGhostKeys[k]); // To check the result found in the treeSearch is correct or not.
+            if((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag())) {
+                stencilIndexDirection = m_uiKeysPtr->getStencilIndexDirectionList(k);
+                result = (*m_uiKeysPtr)[k].getSearchResult();
+                if (numOwners) assert(m_uiAllElements[result].isAncestor(m_uiGhostKeys[k]) || m_uiAllElements[result] ==  m_uiGhostKeys[k]); // To check the result found in the treeSearch is correct or not.
 
-                for (unsigned int w = 0; w < ownerList->size(); w++) {
-                    direction = ((*stencilIndexDirection)[w]) & KEY_DIR_OFFSET;
-                    m_uiE2EMapping[(((*ownerList)[w])) * m_uiNumDirections + direction] = result;
+                for (unsigned int w = 0; w < numOwners; w++) {
+                    direction = (stencilIndexDirection[w]) & KEY_DIR_OFFSET;
+                    m_uiE2EMapping[((ownerList[w])) * m_uiNumDirections + direction] = result;
                     // Note : Following is done to enforce that the local elements that points to ghost elements has the inverse mapping.
                 }
 
@@ -1982,24 +2111,25 @@ namespace ot {
         generateBdyElementDiagonalSearchKeys();
 
         #ifdef DEBUG_MESH_GENERATION
-            treeNodesTovtk(m_uiKeysDiag,rank,"m_uiKeyDiag");
+            {
+                std::vector<ot::FlatKey> keys_vec=m_uiKeysDiag.keys();
+                treeNodesTovtk(keys_vec,rank,"m_uiKeyDiag");
+            }
         #endif
 
 
-
-        tmpKeys.clear();
-        SFC::seqSort::SFC_treeSort(&(*(m_uiKeysDiag.begin())),m_uiKeysDiag.size(),tmpKeys,tmpKeys,tmpKeys,m_uiMaxDepth,m_uiMaxDepth,rootKey,ROOT_ROTATION,1,TS_SORT_ONLY);
-        tmpKeys.clear();
+        // diagonal keys are already sorted by mergeKeys.
+        assert(seq::test::isUniqueAndSorted(m_uiKeysDiag.keys()));
 
         for(unsigned int i=0;i<2*npes;i++)
             splitterElements[i]=ot::Key(m_uiLocalSplitterElements[i]);
 
         assert(seq::test::isUniqueAndSorted(splitterElements));
 
-        SFC::seqSearch::SFC_treeSearch(&(*(splitterElements.begin())),&(*(m_uiKeysDiag.begin())),0,splitterElements.size(),0,m_uiKeysDiag.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+        SFC::seqSearch::SFC_treeSearch(&(*(splitterElements.begin())),m_uiKeysDiag.data(),0,splitterElements.size(),0,m_uiKeysDiag.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
 
 
-        m_uiKeysPtr=&(*(m_uiKeysDiag.begin()));
+        m_uiKeysPtr=&m_uiKeysDiag;
         m_uiGhostElementIDsToBeSent.clear();
         m_uiSendBufferElement.clear();
 
@@ -2036,7 +2166,7 @@ namespace ot {
             if(p!=m_uiActiveRank)
             for(unsigned int i=sBegin;i<sEnd;i++)
             {
-               if(m_uiKeysDiag[i].getOwnerList()->size())
+               if(m_uiKeysDiag.getOwnerListSize(i))
                {
                    m_uiSendBufferElement.push_back(m_uiKeysDiag[i]);
                    m_uiSendKeyDiagCount[p]++;
@@ -2048,20 +2178,13 @@ namespace ot {
         }
 
 
-        par::Mpi_Alltoall(m_uiSendKeyDiagCount,m_uiRecvKeyDiagCount,1,comm);
-
         m_uiSendKeyDiagOffset[0]=0;
-        m_uiRecvKeyDiagOffset[0]=0;
-
         omp_par::scan(m_uiSendKeyDiagCount,m_uiSendKeyDiagOffset,npes);
-        omp_par::scan(m_uiRecvKeyDiagCount,m_uiRecvKeyDiagOffset,npes);
 
 
         std::vector<ot::TreeNode> recvDiagKeyOct;
-        recvDiagKeyOct.resize(m_uiRecvKeyDiagOffset[npes-1]+m_uiRecvKeyDiagCount[npes-1]);
-
-        par::Mpi_Alltoallv(&(*(m_uiSendBufferElement.begin())), (int *) m_uiSendKeyDiagCount, (int *) m_uiSendKeyDiagOffset,
-                           &(*(recvDiagKeyOct.begin())), (int *) m_uiRecvKeyDiagCount, (int *) m_uiRecvKeyDiagOffset, comm);
+        par::Mpi_Alltoallv_NBX(m_uiSendBufferElement.data(), (int *) m_uiSendKeyDiagCount, (int *) m_uiSendKeyDiagOffset,
+                               recvDiagKeyOct, (int *) m_uiRecvKeyDiagCount, (int *) m_uiRecvKeyDiagOffset, comm);
 
 
         #ifdef DEBUG_MESH_GENERATION
@@ -2094,11 +2217,12 @@ namespace ot {
             if(!(recvDiagKey_keys[e].getFlag() & OCT_FOUND))
                 continue;
 
-            ownerList=recvDiagKey_keys[e].getOwnerList();
+            ownerList=recvDiagKey_keys[e].getOwnerList()->data();
+            numOwners=recvDiagKey_keys[e].getOwnerListSize();
             result=recvDiagKey_keys[e].getSearchResult();
-            for (unsigned int w = 0; w < ownerList->size(); w++)
+            for (unsigned int w = 0; w < numOwners; w++)
             {
-                missedSendID[(*ownerList)[w]].push_back(result-m_uiElementLocalBegin);
+                missedSendID[ownerList[w]].push_back(result-m_uiElementLocalBegin);
             }
 
         }
@@ -2123,19 +2247,12 @@ namespace ot {
 
         delete [] missedSendID;
 
-        par::Mpi_Alltoall(m_uiSendOctCountRound1Diag,m_uiRecvOctCountRound1Diag,1,comm);
-
         m_uiSendOctOffsetRound1Diag[0]=0;
-        m_uiRecvOctOffsetRound1Diag[0]=0;
-
         omp_par::scan(m_uiSendOctCountRound1Diag,m_uiSendOctOffsetRound1Diag,npes);
-        omp_par::scan(m_uiRecvOctCountRound1Diag,m_uiRecvOctOffsetRound1Diag,npes);
 
         m_uiGhostOctants.clear();
-
-        m_uiGhostOctants.resize(m_uiRecvOctOffsetRound1Diag[npes - 1] + m_uiRecvOctCountRound1Diag[npes - 1]);
-        par::Mpi_Alltoallv(&(*(m_uiSendBufferElement.begin())), (int *) m_uiSendOctCountRound1Diag, (int *) m_uiSendOctOffsetRound1Diag,
-                           &(*(m_uiGhostOctants.begin())), (int *) m_uiRecvOctCountRound1Diag, (int *) m_uiRecvOctOffsetRound1Diag, comm);
+        par::Mpi_Alltoallv_NBX(m_uiSendBufferElement.data(), (int *) m_uiSendOctCountRound1Diag, (int *) m_uiSendOctOffsetRound1Diag,
+                               m_uiGhostOctants, (int *) m_uiRecvOctCountRound1Diag, (int *) m_uiRecvOctOffsetRound1Diag, comm);
 
 
 
@@ -2152,6 +2269,7 @@ namespace ot {
         SFC::seqSort::SFC_treeSort(&(*(m_uiAllElements.begin())), m_uiAllElements.size(), tmpNodes, tmpNodes, tmpNodes, m_uiMaxDepth,m_uiMaxDepth, rootNode, 0, 1, TS_REMOVE_DUPLICATES);
         std::swap(m_uiAllElements, tmpNodes);
         tmpNodes.clear();
+        computeAllElementKeys();
 
         assert(seq::test::isUniqueAndSorted(m_uiAllElements));
 
@@ -2191,10 +2309,10 @@ namespace ot {
 
         // E2E Mapping for the Round 1 Ghost Exchange. Later we will perform another round of ghost exchange, (for the ghost elements that are hanging ) and build the correct complete E2E mapping.
 
-        SFC::seqSearch::SFC_treeSearch(&(*(m_uiKeys.begin())), &(*(m_uiAllElements.begin())), 0, m_uiKeys.size(), 0,m_uiAllElements.size(), m_uiMaxDepth, m_uiMaxDepth, 0);
+        SFC::seqSearch::SFC_treeSearchBatched(m_uiKeys.data(),m_uiAllElementKeys.data(),0,m_uiKeys.size(),0,m_uiAllElementKeys.size(),m_uiMaxDepth);
 
 
-        m_uiKeysPtr=&(*(m_uiKeys.begin()));
+        m_uiKeysPtr=&m_uiKeys;
         m_uiE2EMapping.resize(m_uiAllElements.size()*m_uiNumDirections,LOOK_UP_TABLE_DEFAULT);
 
         /**Neighbour list is made from
@@ -2203,20 +2321,21 @@ namespace ot {
         *  third z axis. (back to front)**/
 
         for (unsigned int k = 0; k < m_uiKeys.size(); k++) {
-            ownerList = m_uiKeysPtr[k].getOwnerList();
+            ownerList = m_uiKeysPtr->getOwnerList(k);
+            numOwners = m_uiKeysPtr->getOwnerListSize(k);
 
-            if(ownerList->size() && (!((OCT_FOUND & m_uiKeysPtr[k].getFlag())))) {
-                std::cout<<"rank: "<<m_uiActiveRank<<"[E2E Error]: Local  face key missing after R1 (face edge vertex) ghost exchange: "<<m_uiKeysPtr[k]<<std::endl;
+            if(numOwners && (!((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag())))) {
+                std::cout<<"rank: "<<m_uiActiveRank<<"[E2E Error]: Local  face key missing after R1 (face edge vertex) ghost exchange: "<<(*m_uiKeysPtr)[k]<<std::endl;
                 exit(0); 
             }
 
-            if(ownerList->size()) assert((OCT_FOUND & m_uiKeysPtr[k].getFlag()));// Note that all the keys should be found locally due to the fact that we have exchanged ghost elements.
-            stencilIndexDirection = m_uiKeysPtr[k].getStencilIndexDirectionList();
-            result = m_uiKeysPtr[k].getSearchResult();
-            if(ownerList->size()) assert(m_uiAllElements[result].isAncestor(m_uiKeys[k]) || m_uiAllElements[result]==m_uiKeys[k]); // To check the result found in the treeSearch is correct or not.
-            for (unsigned int w = 0; w < ownerList->size(); w++) {
-                direction = ((*stencilIndexDirection)[w]) & KEY_DIR_OFFSET;
-                m_uiE2EMapping[(((*ownerList)[w]) + m_uiElementLocalBegin)*m_uiNumDirections+direction] = result;
+            if(numOwners) assert((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag()));// Note that all the keys should be found locally due to the fact that we have exchanged ghost elements.
+            stencilIndexDirection = m_uiKeysPtr->getStencilIndexDirectionList(k);
+            result = (*m_uiKeysPtr)[k].getSearchResult();
+            if(numOwners) assert(m_uiAllElements[result].isAncestor(m_uiKeys[k]) || m_uiAllElements[result]==m_uiKeys[k]); // To check the result found in the treeSearch is correct or not.
+            for (unsigned int w = 0; w < numOwners; w++) {
+                direction = (stencilIndexDirection[w]) & KEY_DIR_OFFSET;
+                m_uiE2EMapping[((ownerList[w]) + m_uiElementLocalBegin)*m_uiNumDirections+direction] = result;
 
             }
 
@@ -2225,22 +2344,23 @@ namespace ot {
         m_uiGhostKeys.clear();
         generateGhostElementSearchKeys();
 
-        SFC::seqSearch::SFC_treeSearch(&(*(m_uiGhostKeys.begin())),&(*(m_uiAllElements.begin())),0,m_uiGhostKeys.size(),0,m_uiAllElements.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+        SFC::seqSearch::SFC_treeSearchBatched(m_uiGhostKeys.data(),m_uiAllElementKeys.data(),0,m_uiGhostKeys.size(),0,m_uiAllElementKeys.size(),m_uiMaxDepth);
 
 
-        m_uiKeysPtr=&(*(m_uiGhostKeys.begin()));
+        m_uiKeysPtr=&m_uiGhostKeys;
         // Note : Since the ghost elements are not complete it is not required to find all the keys in the ghost.
         for (unsigned int k = 0; k < m_uiGhostKeys.size(); k++) {
-            ownerList = m_uiKeysPtr[k].getOwnerList();
+            ownerList = m_uiKeysPtr->getOwnerList(k);
+            numOwners = m_uiKeysPtr->getOwnerListSize(k);
 
-            if((OCT_FOUND & m_uiKeysPtr[k].getFlag())) {
-                stencilIndexDirection = m_uiKeysPtr[k].getStencilIndexDirectionList();
-                result = m_uiKeysPtr[k].getSearchResult();
-                if (ownerList->size()) assert(m_uiAllElements[result].isAncestor(m_uiGhostKeys[k]) || m_uiAllElements[result] ==  m_uiGhostKeys[k]); // To check the result found in the treeSearch is correct or not.
+            if((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag())) {
+                stencilIndexDirection = m_uiKeysPtr->getStencilIndexDirectionList(k);
+                result = (*m_uiKeysPtr)[k].getSearchResult();
+                if (numOwners) assert(m_uiAllElements[result].isAncestor(m_uiGhostKeys[k]) || m_uiAllElements[result] ==  m_uiGhostKeys[k]); // To check the result found in the treeSearch is correct or not.
 
-                for (unsigned int w = 0; w < ownerList->size(); w++) {
-                    direction = ((*stencilIndexDirection)[w]) & KEY_DIR_OFFSET;
-                    m_uiE2EMapping[(((*ownerList)[w])) * m_uiNumDirections + direction] = result;
+                for (unsigned int w = 0; w < numOwners; w++) {
+                    direction = (stencilIndexDirection[w]) & KEY_DIR_OFFSET;
+                    m_uiE2EMapping[((ownerList[w])) * m_uiNumDirections + direction] = result;
                     // Note : Following is done to enforce that the local elements that points to ghost elements has the inverse mapping.
                 }
 
@@ -2250,14 +2370,15 @@ namespace ot {
 
 
 
-        SFC::seqSearch::SFC_treeSearch(&(*(m_uiKeysDiag.begin())),&(*(m_uiAllElements.begin())),0,m_uiKeysDiag.size(),0,m_uiAllElements.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+        SFC::seqSearch::SFC_treeSearchBatched(m_uiKeysDiag.data(),m_uiAllElementKeys.data(),0,m_uiKeysDiag.size(),0,m_uiAllElementKeys.size(),m_uiMaxDepth);
 
-        m_uiKeysPtr=&(*(m_uiKeysDiag.begin()));
+        m_uiKeysPtr=&m_uiKeysDiag;
         for (unsigned int k = 0; k < m_uiKeysDiag.size(); k++) {
-            ownerList = m_uiKeysPtr[k].getOwnerList();
+            ownerList = m_uiKeysPtr->getOwnerList(k);
+            numOwners = m_uiKeysPtr->getOwnerListSize(k);
 
-            if(ownerList->size() && (!((OCT_FOUND & m_uiKeysPtr[k].getFlag())))) {
-                std::cout<<"rank: "<<m_uiActiveRank<<"[E2E Error]: Local edge or vertex key missing after R1 (face edge vertex) ghost exchange: "<<m_uiKeysPtr[k]<<std::endl;
+            if(numOwners && (!((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag())))) {
+                std::cout<<"rank: "<<m_uiActiveRank<<"[E2E Error]: Local edge or vertex key missing after R1 (face edge vertex) ghost exchange: "<<(*m_uiKeysPtr)[k]<<std::endl;
                 exit(0); // no point in continuing if this fails E2N fails for sure :)
             }
 
@@ -2290,7 +2411,7 @@ namespace ot {
 
         // finalized round 1 ghost exchange elements including face, edge and vertex. 
 
-        par::Mpi_Alltoall(m_uiSendEleCount.data(),m_uiRecvEleCount.data(),1,m_uiCommActive);
+        par::Mpi_Alltoall_NBX(m_uiSendEleCount.data(),m_uiRecvEleCount.data(),m_uiCommActive);
         m_uiSendEleOffset[0]=0;
         m_uiRecvEleOffset[0]=0;
 
@@ -2461,18 +2582,13 @@ namespace ot {
         delete[] tmpSendEleIdR2;
 
 
-            par::Mpi_Alltoall(m_uiSendOctCountRound2, m_uiRecvOctCountRound2, 1, comm);
             m_uiSendOctOffsetRound2[0] = 0;
-            m_uiRecvOctOffsetRound2[0] = 0;
-
             omp_par::scan(m_uiSendOctCountRound2,m_uiSendOctOffsetRound2,npes);
-            omp_par::scan(m_uiRecvOctCountRound2,m_uiRecvOctOffsetRound2,npes);
 
 
             m_uiGhostOctants.clear();
-            m_uiGhostOctants.resize(m_uiRecvOctOffsetRound2[npes-1]+m_uiRecvOctCountRound2[npes-1]);
             assert(m_uiSendBufferElement.size()==(m_uiSendOctOffsetRound2[npes-1]+m_uiSendOctCountRound2[npes-1]));
-            par::Mpi_Alltoallv(&(*(m_uiSendBufferElement.begin())),(int *)m_uiSendOctCountRound2,(int *)m_uiSendOctOffsetRound2,&(*(m_uiGhostOctants.begin())),(int *)m_uiRecvOctCountRound2,(int *)m_uiRecvOctOffsetRound2,comm);
+            par::Mpi_Alltoallv_NBX(m_uiSendBufferElement.data(),(int *)m_uiSendOctCountRound2,(int *)m_uiSendOctOffsetRound2,m_uiGhostOctants,(int *)m_uiRecvOctCountRound2,(int *)m_uiRecvOctOffsetRound2,comm);
 
 
 
@@ -2488,6 +2604,7 @@ namespace ot {
             SFC::seqSort::SFC_treeSort(&(*(m_uiAllElements.begin())), m_uiAllElements.size(), tmpNodes, tmpNodes, tmpNodes, m_uiMaxDepth,m_uiMaxDepth, rootNode, 0, 1, TS_REMOVE_DUPLICATES);
             std::swap(m_uiAllElements, tmpNodes);
             tmpNodes.clear();
+            computeAllElementKeys();
 
             assert(seq::test::isUniqueAndSorted(m_uiAllElements));
             m_uiGhostOctants.clear();
@@ -2524,10 +2641,10 @@ namespace ot {
 
             // E2E Mapping for the Round 2 Ghost Exchange. (Final E2E Mapping )
 
-            SFC::seqSearch::SFC_treeSearch(&(*(m_uiKeys.begin())), &(*(m_uiAllElements.begin())), 0, m_uiKeys.size(), 0,m_uiAllElements.size(), m_uiMaxDepth, m_uiMaxDepth, 0);
+            SFC::seqSearch::SFC_treeSearchBatched(m_uiKeys.data(),m_uiAllElementKeys.data(),0,m_uiKeys.size(),0,m_uiAllElementKeys.size(),m_uiMaxDepth);
 
 
-            m_uiKeysPtr=&(*(m_uiKeys.begin()));
+            m_uiKeysPtr=&m_uiKeys;
             m_uiE2EMapping.clear();
             m_uiE2EMapping.resize(m_uiAllElements.size()*m_uiNumDirections,LOOK_UP_TABLE_DEFAULT);
 
@@ -2537,18 +2654,19 @@ namespace ot {
             // *  third z axis. (back to front)
 
             for (unsigned int k = 0; k < m_uiKeys.size(); k++) {
-                ownerList = m_uiKeysPtr[k].getOwnerList();
-
-                if(ownerList->size()) assert((OCT_FOUND & m_uiKeysPtr[k].getFlag()));// Note that all the keys should be found locally due to the fact that we have exchanged ghost elements.
-                stencilIndexDirection = m_uiKeysPtr[k].getStencilIndexDirectionList();
-                result = m_uiKeysPtr[k].getSearchResult();
-                if(ownerList->size()) assert(m_uiAllElements[result].isAncestor(m_uiKeys[k]) || m_uiAllElements[result]==m_uiKeys[k]); // To check the result found in the treeSearch is correct or not.
-                for (unsigned int w = 0; w < ownerList->size(); w++) {
-                    direction = ((*stencilIndexDirection)[w]) & KEY_DIR_OFFSET;
-                    m_uiE2EMapping[(((*ownerList)[w]) + m_uiElementLocalBegin)*m_uiNumDirections+direction] = result;
+                ownerList = m_uiKeysPtr->getOwnerList(k);
+                numOwners = m_uiKeysPtr->getOwnerListSize(k);
+
+                if(numOwners) assert((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag()));// Note that all the keys should be found locally due to the fact that we have exchanged ghost elements.
+                stencilIndexDirection = m_uiKeysPtr->getStencilIndexDirectionList(k);
+                result = (*m_uiKeysPtr)[k].getSearchResult();
+                if(numOwners) assert(m_uiAllElements[result].isAncestor(m_uiKeys[k]) || m_uiAllElements[result]==m_uiKeys[k]); // To check the result found in the treeSearch is correct or not.
+                for (unsigned int w = 0; w < numOwners; w++) {
+                    direction = (stencilIndexDirection[w]) & KEY_DIR_OFFSET;
+                    m_uiE2EMapping[((ownerList[w]) + m_uiElementLocalBegin)*m_uiNumDirections+direction] = result;
                     // Note : Following is done to enforce that the local elements that points to ghost elements has the inverse mapping.
                     if(result<m_uiElementLocalBegin || result>=m_uiElementLocalEnd)
-                        m_uiE2EMapping[result*m_uiNumDirections+ (1u^direction)]=(((*ownerList)[w]) + m_uiElementLocalBegin); // Note This depends on the OCT_DIR numbering.
+                        m_uiE2EMapping[result*m_uiNumDirections+ (1u^direction)]=((ownerList[w]) + m_uiElementLocalBegin); // Note This depends on the OCT_DIR numbering.
 
 
                 }
@@ -2566,21 +2684,22 @@ namespace ot {
         m_uiGhostKeys.clear();
         generateGhostElementSearchKeys();
 
-        SFC::seqSearch::SFC_treeSearch(&(*(m_uiGhostKeys.begin())),&(*(m_uiAllElements.begin())),0,m_uiGhostKeys.size(),0,m_uiAllElements.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+        SFC::seqSearch::SFC_treeSearchBatched(m_uiGhostKeys.data(),m_uiAllElementKeys.data(),0,m_uiGhostKeys.size(),0,m_uiAllElementKeys.size(),m_uiMaxDepth);
 
 
-        m_uiKeysPtr=&(*(m_uiGhostKeys.begin()));
+        m_uiKeysPtr=&m_uiGhostKeys;
         // Note : Since the ghost elements are not complete it is not required to find all the keys in the ghost.
         for (unsigned int k = 0; k < m_uiGhostKeys.size(); k++) {
-            ownerList = m_uiKeysPtr[k].getOwnerList();
-            if((OCT_FOUND & m_uiKeysPtr[k].getFlag())) {
-                stencilIndexDirection = m_uiKeysPtr[k].getStencilIndexDirectionList();
-                result = m_uiKeysPtr[k].getSearchResult();
-                if (ownerList->size()) assert(m_uiAllElements[result].isAncestor(m_uiGhostKeys[k]) || m_uiAllElements[result] ==  m_uiGhostKeys[k]); // To check the result found in the treeSearch is correct or not.
-
-                for (unsigned int w = 0; w < ownerList->size(); w++) {
-                    direction = ((*stencilIndexDirection)[w]) & KEY_DIR_OFFSET;
-                    m_uiE2EMapping[(((*ownerList)[w])) * m_uiNumDirections + direction] = result;
+            ownerList = m_uiKeysPtr->getOwnerList(k);
+            numOwners = m_uiKeysPtr->getOwnerListSize(k);
+            if((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag())) {
+                stencilIndexDirection = m_uiKeysPtr->getStencilIndexDirectionList(k);
+                result = (*m_uiKeysPtr)[k].getSearchResult();
+                if (numOwners) assert(m_uiAllElements[result].isAncestor(m_uiGhostKeys[k]) || m_uiAllElements[result] ==  m_uiGhostKeys[k]); // To check the result found in the treeSearch is correct or not.
+
+                for (unsigned int w = 0; w < numOwners; w++) {
+                    direction = (stencilIndexDirection[w]) & KEY_DIR_OFFSET;
+                    m_uiE2EMapping[((ownerList[w])) * m_uiNumDirections + direction] = result;
                     // Note : Following is done to enforce that the local elements that points to ghost elements has the inverse mapping.
                 }
 
@@ -2709,22 +2828,23 @@ namespace ot {
         // KEEPING THIS IF WE NEEDED A QUICK FIX. AGAIN DO NOT ENABLE THE BELOW CODE. !!!!
         /*
         //m_uiGhostElementRound1Index.clear();
-        SFC::seqSearch::SFC_treeSearch(&(*(m_uiKeys.begin())),&(*(m_uiAllElements.begin())),0,m_uiKeys.size(),0,m_uiAllElements.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
-        SFC::seqSearch::SFC_treeSearch(&(*(m_uiKeysDiag.begin())),&(*(m_uiAllElements.begin())),0,m_uiKeysDiag.size(),0,m_uiAllElements.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+        SFC::seqSearch::SFC_treeSearch(m_uiKeys.data(),&(*(m_uiAllElements.begin())),0,m_uiKeys.size(),0,m_uiAllElements.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+        SFC::seqSearch::SFC_treeSearch(m_uiKeysDiag.data(),&(*(m_uiAllElements.begin())),0,m_uiKeysDiag.size(),0,m_uiAllElements.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
 
 
-        m_uiKeysPtr=&(*(m_uiKeys.begin()));
+        m_uiKeysPtr=&m_uiKeys;
         for (unsigned int k = 0; k < m_uiKeys.size(); k++) {
-            ownerList = m_uiKeysPtr[k].getOwnerList();
+            ownerList = m_uiKeysPtr->getOwnerList(k);
+            numOwners = m_uiKeysPtr->getOwnerListSize(k);
 
-            if(ownerList->size() && (!((OCT_FOUND & m_uiKeysPtr[k].getFlag())))) {
-                std::cout<<"rank: "<<m_uiActiveRank<<"[E2E Error]: Local key missing after R1 & R1 Diag & R2  ghost exchange: "<<m_uiKeysPtr[k]<<std::endl;
+            if(numOwners && (!((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag())))) {
+                std::cout<<"rank: "<<m_uiActiveRank<<"[E2E Error]: Local key missing after R1 & R1 Diag & R2  ghost exchange: "<<(*m_uiKeysPtr)[k]<<std::endl;
                 exit(0); // no point in continuing if this fails E2N fails for sure :)
             }
 
-            if(ownerList->size())
+            if(numOwners)
             {
-                result=m_uiKeysPtr[k].getSearchResult();
+                result=(*m_uiKeysPtr)[k].getSearchResult();
                 if((result<m_uiElementLocalBegin) || (result>=m_uiElementLocalEnd))
                     m_uiGhostElementRound1Index.push_back(result);
             }
@@ -2732,18 +2852,19 @@ namespace ot {
 
         }
 
-        m_uiKeysPtr=&(*(m_uiKeysDiag.begin()));
+        m_uiKeysPtr=&m_uiKeysDiag;
         for (unsigned int k = 0; k < m_uiKeysDiag.size(); k++) {
-            ownerList = m_uiKeysPtr[k].getOwnerList();
+            ownerList = m_uiKeysPtr->getOwnerList(k);
+            numOwners = m_uiKeysPtr->getOwnerListSize(k);
 
-            if(ownerList->size() && (!((OCT_FOUND & m_uiKeysPtr[k].getFlag())))) {
-                std::cout<<"rank: "<<m_uiActiveRank<<"[E2E Error]: Local Diag and corner key missing after R1 & R1 Diag & R2  ghost exchange: "<<m_uiKeysPtr[k]<<std::endl;
+            if(numOwners && (!((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag())))) {
+                std::cout<<"rank: "<<m_uiActiveRank<<"[E2E Error]: Local Diag and corner key missing after R1 & R1 Diag & R2  ghost exchange: "<<(*m_uiKeysPtr)[k]<<std::endl;
                 exit(0); // no point in continuing if this fails E2N fails for sure :)
             }
 
-            if(ownerList->size())
+            if(numOwners)
             {
-                result=m_uiKeysPtr[k].getSearchResult();
+                result=(*m_uiKeysPtr)[k].getSearchResult();
                 if((result<m_uiElementLocalBegin) || (result>=m_uiElementLocalEnd))
                     m_uiGhostElementRound1Index.push_back(result);
             }
@@ -2808,6 +2929,7 @@ namespace ot {
 
         std::swap(m_uiAllElements,m_uiEmbeddedOctree);
         m_uiEmbeddedOctree.clear();
+        computeAllElementKeys();
 
         //update the loop counters.
         m_uiElementPreGhostBegin=0;
@@ -2831,14 +2953,15 @@ namespace ot {
 
         //1b - allocate  & initialize E2E mapping.
         m_uiE2EMapping.resize(m_uiAllElements.size()*m_uiNumDirections,LOOK_UP_TABLE_DEFAULT);
-        SFC::seqSearch::SFC_treeSearch(&(*(m_uiKeys.begin())), &(*(m_uiAllElements.begin())), 0, m_uiKeys.size(), 0, m_uiAllElements.size(), m_uiMaxDepth, m_uiMaxDepth, 0);
+        SFC::seqSearch::SFC_treeSearchBatched(m_uiKeys.data(),m_uiAllElementKeys.data(),0,m_uiKeys.size(),0,m_uiAllElementKeys.size(),m_uiMaxDepth);
 
-        std::vector<unsigned int> *ownerList;
-        std::vector<unsigned int> *stencilIndexDirection;
+        const unsigned int *ownerList;
+        const unsigned int *stencilIndexDirection;
+        unsigned int numOwners;
         unsigned int result;
         unsigned int dir;
         //unsigned int stencilIndex;
-        Key *m_uiKeysPtr=&(*(m_uiKeys.begin()));
+        ot::KeyCSR *m_uiKeysPtr=&m_uiKeys;
 
         m_uiE2EMapping.resize(m_uiAllElements.size()*m_uiNumDirections,LOOK_UP_TABLE_DEFAULT);
 
@@ -2848,20 +2971,21 @@ namespace ot {
         *  third z axis. (back to front)**/
 
         for (unsigned int k = 0; k < m_uiKeys.size(); k++) {
-            if(!(OCT_FOUND & m_uiKeysPtr[k].getFlag())) std::cout<<"key: "<<m_uiKeysPtr[k]<<" not found: "<<std::endl;
-            assert((OCT_FOUND & m_uiKeysPtr[k].getFlag()));// Note that all the keys should be found locally due to the fact that we have exchanged ghost elements.
-            ownerList = m_uiKeysPtr[k].getOwnerList();
-            stencilIndexDirection = m_uiKeysPtr[k].getStencilIndexDirectionList();
-            result = m_uiKeysPtr[k].getSearchResult();
+            if(!(OCT_FOUND & (*m_uiKeysPtr)[k].getFlag())) std::cout<<"key: "<<(*m_uiKeysPtr)[k]<<" not found: "<<std::endl;
+            assert((OCT_FOUND & (*m_uiKeysPtr)[k].getFlag()));// Note that all the keys should be found locally due to the fact that we have exchanged ghost elements.
+            ownerList = m_uiKeysPtr->getOwnerList(k);
+            numOwners = m_uiKeysPtr->getOwnerListSize(k);
+            stencilIndexDirection = m_uiKeysPtr->getStencilIndexDirectionList(k);
+            result = (*m_uiKeysPtr)[k].getSearchResult();
             assert(m_uiAllElements[result].isAncestor(m_uiKeys[k]) || m_uiAllElements[result]==m_uiKeys[k]); // To check the result found in the treeSearch is correct or not.
-            for (unsigned int w = 0; w < ownerList->size(); w++) {
-                dir = ((*stencilIndexDirection)[w]) & KEY_DIR_OFFSET;
-                //stencilIndex = (((*stencilIndexDirection)[w]) & (KS_MAX << 3u)) >> 3u;
-                //std::cout<<"dir: "<<dir<<" stencil Index: "<<stencilIndex<<"owner index: "<<(*ownerList)[w]<<std::endl;
-                m_uiE2EMapping[(((*ownerList)[w]) + m_uiElementLocalBegin)*m_uiNumDirections+dir] = result;
+            for (unsigned int w = 0; w < numOwners; w++) {
+                dir = (stencilIndexDirection[w]) & KEY_DIR_OFFSET;
+                //stencilIndex = ((stencilIndexDirection[w]) & (KS_MAX << 3u)) >> 3u;
+                //std::cout<<"dir: "<<dir<<" stencil Index: "<<stencilIndex<<"owner index: "<<ownerList[w]<<std::endl;
+                m_uiE2EMapping[((ownerList[w]) + m_uiElementLocalBegin)*m_uiNumDirections+dir] = result;
                 // Note : Following is done to enforce that the local elements that points to ghost elements has the inverse mapping.
                 if(result<m_uiElementLocalBegin || result>=m_uiElementLocalEnd) {
-                    m_uiE2EMapping[result * m_uiNumDirections + (1u ^ dir)] = (((*ownerList)[w]) +
+                    m_uiE2EMapping[result * m_uiNumDirections + (1u ^ dir)] = ((ownerList[w]) +
                                                                                m_uiElementLocalBegin); // Note This depends on the OCT_DIR numbering.
                     assert(false);// for sequential case this cannot be true.
                 }
@@ -8635,6 +8759,11 @@ namespace ot {
 
         // assumes that E2E and E2N mapping is done and m_uiAllElements should be sorted otherwise this will chnage the order of elements in m_uiAllElements.
         assert(seq::test::isUniqueAndSorted(m_uiAllElements));
+
+        // element keys for the block key searches below (computed once, not per block).
+        if(m_uiAllElementKeys.size()!=m_uiAllElements.size())
+            computeAllElementKeys();
+
         octree2BlockDecomposition(m_uiAllElements,m_uiLocalBlockList,m_uiMaxDepth,m_uiDmin,m_uiDmax,m_uiElementLocalBegin,m_uiElementLocalEnd,m_uiElementOrder, m_uiCoarsetBlkLev);
         assert(ot::test::isBlockListValid(m_uiAllElements,m_uiLocalBlockList,m_uiDmin,m_uiDmax,m_uiElementLocalBegin,m_uiElementLocalEnd));
 
@@ -8662,15 +8791,16 @@ namespace ot {
         const unsigned int dmax=1u<<(m_uiMaxDepth);
         ot::TreeNode blkNode;
 
-        std::vector<ot::Key> blkKeys;
+        ot::KeyCSR blkKeys;
         std::vector<ot::SearchKey> blkSkeys;
 
         unsigned int sz;
         unsigned int regLev;
         unsigned int blkElem_1D;
 
-        std::vector<unsigned int >* ownerList;
-        std::vector<unsigned int >* directionList;
+        const unsigned int * ownerList;
+        const unsigned int * directionList;
+        unsigned int numOwners;
         unsigned int result;
 
 
@@ -8737,30 +8867,30 @@ namespace ot {
             generateBlkVertexSKeys(m_uiLocalBlockList[e],blkSkeys);
             mergeKeys(blkSkeys,blkKeys);
             blkSkeys.clear();
-            SFC::seqSearch::SFC_treeSearch(&(*(blkKeys.begin())),&(*(m_uiAllElements.begin())),0,blkKeys.size(),0,m_uiAllElements.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+            SFC::seqSearch::SFC_treeSearchBatched(blkKeys.data(),m_uiAllElementKeys.data(),0,blkKeys.size(),0,m_uiAllElementKeys.size(),m_uiMaxDepth);
 
 
             for(unsigned int i=0;i<blkKeys.size();i++)
             {
                 assert(blkKeys[i].getFlag()& OCT_FOUND);
                 if(!(blkKeys[i].getFlag()& OCT_FOUND)) {std::cout<<RED<<"block diagonal key not found"<<NRM<<std::endl;}
-                ownerList=blkKeys[i].getOwnerList();
-                directionList=blkKeys[i].getStencilIndexDirectionList();
+                ownerList=blkKeys.getOwnerList(i);
+                directionList=blkKeys.getStencilIndexDirectionList(i);
+                numOwners=blkKeys.getOwnerListSize(i);
                 result=blkKeys[i].getSearchResult();
 
 
-                assert(ownerList->size()==directionList->size());
-                for(unsigned int w=0;w<ownerList->size();w++)
+                for(unsigned int w=0;w<numOwners;w++)
                 {
-                    if((*directionList)[w]<VERTEX_OFFSET)
+                    if(directionList[w]<VERTEX_OFFSET)
                     {
-                        assert((*directionList)[w]>=EDGE_OFFSET);
-                        m_uiLocalBlockList[e].setBlk2DiagMap((*ownerList)[w],((*directionList)[w]-EDGE_OFFSET),result);
+                        assert(directionList[w]>=EDGE_OFFSET);
+                        m_uiLocalBlockList[e].setBlk2DiagMap(ownerList[w],(directionList[w]-EDGE_OFFSET),result);
                     }
                     else
                     {// this is an vertex neighbour.
-                        assert((*directionList)[w]>=VERTEX_OFFSET);
-                        m_uiLocalBlockList[e].setBlk2VertexMap(((*directionList)[w]-VERTEX_OFFSET),result);
+                        assert(directionList[w]>=VERTEX_OFFSET);
+                        m_uiLocalBlockList[e].setBlk2VertexMap((directionList[w]-VERTEX_OFFSET),result);
                     }
 
                 }
@@ -9443,7 +9573,7 @@ namespace ot {
     }
 
 
-    ot::Mesh* Mesh::ReMesh(unsigned int grainSz,double ld_tol,unsigned int sfK, unsigned int (*getWeight)(const ot::TreeNode *))
+    ot::Mesh* Mesh::ReMesh(unsigned int grainSz,double ld_tol,unsigned int sfK, unsigned int (*getWeight)(const ot::TreeNode *), unsigned int (*getConstraint)(const ot::TreeNode *))
     {
 
         std::vector<ot::TreeNode> balOct1; //new balanced octree.
@@ -9493,7 +9623,10 @@ namespace ot {
 
             ot::TreeNode rootNode(m_uiDim,m_uiMaxDepth);
             SFC::parSort::SFC_treeSort(unBalancedOctree,balOct1,balOct1,balOct1,ld_tol,m_uiMaxDepth,rootNode,ROOT_ROTATION,1,TS_BALANCE_OCTREE,sfK,m_uiCommActive);
-            par::partitionW(balOct1,getWeight,m_uiCommActive);
+            if(getConstraint!=NULL)
+                par::partitionWMC(balOct1,getConstraint,m_uiMaxDepth+1,m_uiCommActive);
+            else
+                par::partitionW(balOct1,getWeight,m_uiCommActive);
             assert(par::test::isUniqueAndSorted(balOct1,m_uiCommActive));
             unBalancedOctree.clear();
 
@@ -9714,7 +9847,7 @@ namespace ot {
 
         }
 
-        ot::Mesh * pMesh = new ot::Mesh(balOct1,1,m_uiElementOrder,m_uiCommGlobal,m_uiIsBlockSetup,m_uiScatterMapType,grainSz,ld_tol,sfK,getWeight,m_uiCoarsetBlkLev);
+        ot::Mesh * pMesh = new ot::Mesh(balOct1,1,m_uiElementOrder,m_uiCommGlobal,m_uiIsBlockSetup,m_uiScatterMapType,grainSz,ld_tol,sfK,getWeight,m_uiCoarsetBlkLev,getConstraint);
         return pMesh;
 
 
@@ -10699,6 +10832,137 @@ namespace ot {
         
     }
 
+    void ot::Mesh::applyElementQTMat(unsigned int currentId, const double* in, double* out) const
+    {
+        if(!m_uiIsActive)
+            return ;
+
+        const unsigned int eleOrder = m_uiElementOrder;
+        const unsigned int npe_1d = eleOrder + 1;
+        const unsigned int npe_2d = (eleOrder + 1) * (eleOrder + 1);
+        const unsigned int nPe = m_uiNpE;
+
+        // note that this is because in the reference element interpolation operators are transposed to support on the fly interpolations. 
+        const DendroScalar *I0 = m_uiRefEl.getIMTChild0();
+        const DendroScalar *I1 = m_uiRefEl.getIMTChild1();
+
+        // face nodes are given by base + outer * s_outer + inner * s_inner, (outer, inner) ordering matches the kron ordering in getElementQMat
+        const unsigned int faceBase[NUM_FACES]  = {0, eleOrder, 0, eleOrder*npe_1d, 0, eleOrder*npe_2d};
+        const unsigned int faceOuter[NUM_FACES] = {npe_2d, npe_2d, npe_2d, npe_2d, npe_1d, npe_1d};
+        const unsigned int faceInner[NUM_FACES] = {npe_1d, npe_1d, 1, 1, 1, 1};
+        const unsigned int faceDir[NUM_FACES]   = {OCT_DIR_LEFT, OCT_DIR_RIGHT, OCT_DIR_DOWN, OCT_DIR_UP, OCT_DIR_BACK, OCT_DIR_FRONT};
+
+        // edge nodes are given by base + i * stride, edge is only applied if both adjacent faces are not hanging. 
+        const unsigned int edgeBase[NUM_EDGES]   = {0, eleOrder*npe_1d, 0, eleOrder*npe_2d,
+                                                    eleOrder, eleOrder*npe_1d + eleOrder, eleOrder, eleOrder*npe_2d + eleOrder,
+                                                    0, eleOrder*npe_2d, eleOrder*npe_1d, eleOrder*npe_2d + eleOrder*npe_1d};
+        const unsigned int edgeStride[NUM_EDGES] = {npe_2d, npe_2d, npe_1d, npe_1d, npe_2d, npe_2d, npe_1d, npe_1d, 1, 1, 1, 1};
+        const unsigned int edgeFace[NUM_EDGES][2] = {{0,2},{0,3},{0,4},{0,5},{1,2},{1,3},{1,4},{1,5},{2,4},{2,5},{3,4},{3,5}};
+        const unsigned int edgeDir[NUM_EDGES] = {OCT_DIR_LEFT_DOWN, OCT_DIR_LEFT_UP, OCT_DIR_LEFT_BACK, OCT_DIR_LEFT_FRONT,
+                                                 OCT_DIR_RIGHT_DOWN, OCT_DIR_RIGHT_UP, OCT_DIR_RIGHT_BACK, OCT_DIR_RIGHT_FRONT,
+                                                 OCT_DIR_DOWN_BACK, OCT_DIR_DOWN_FRONT, OCT_DIR_UP_BACK, OCT_DIR_UP_FRONT};
+
+        bool faceHang[NUM_FACES];
+        bool edgeHang[NUM_EDGES];
+        unsigned int cnumFace[NUM_FACES];
+        unsigned int cnumEdge[NUM_EDGES];
+
+        for(unsigned int f=0; f < NUM_FACES; f++)
+            faceHang[f] = this->isFaceHanging(currentId,faceDir[f],cnumFace[f]);
+
+        for(unsigned int e=0; e < NUM_EDGES; e++)
+            edgeHang[e] = this->isEdgeHanging(currentId,edgeDir[e],cnumEdge[e]) && (!faceHang[edgeFace[e][0]] && !faceHang[edgeFace[e][1]]);
+
+        // row owner of Q, (0 - identity, 1+f face f, 1+NUM_FACES+e edge e). Later writes overwrite earlier ones as in getElementQMat. 
+        // per element scratch, on the stack for the supported orders since this runs for every element of the matvec.
+        unsigned char ownerBuf[DENDRO_MESH_STACK_NPE];
+        double wBuf[3*DENDRO_MESH_STACK_NPE];
+        const bool isStack = (nPe <= DENDRO_MESH_STACK_NPE);
+        unsigned char * owner = (isStack) ? ownerBuf : new unsigned char[nPe];
+        double * w  = (isStack) ? wBuf : new double[3*npe_2d];
+        double * im = w + npe_2d;
+        double * y  = im + npe_2d;
+
+        for(unsigned int i=0; i < nPe; i++)
+            owner[i] = 0;
+
+        for(unsigned int f=0; f < NUM_FACES; f++)
+        {
+            if(!faceHang[f]) continue;
+            for(unsigned int a=0; a < npe_1d; a++)
+             for(unsigned int b=0; b < npe_1d; b++)
+                owner[faceBase[f] + a*faceOuter[f] + b*faceInner[f]] = 1 + f;
+        }
+
+        for(unsigned int e=0; e < NUM_EDGES; e++)
+        {
+            if(!edgeHang[e]) continue;
+            for(unsigned int a=0; a < npe_1d; a++)
+                owner[edgeBase[e] + a*edgeStride[e]] = 1 + NUM_FACES + e;
+        }
+
+        // identity rows
+        for(unsigned int i=0; i < nPe; i++)
+            out[i] = (owner[i]==0) ? in[i] : 0.0;
+
+        // hanging faces: out_face += (I_outer \otimes I_inner)^T in_face
+        for(unsigned int f=0; f < NUM_FACES; f++)
+        {
+            if(!faceHang[f]) continue;
+
+            for(unsigned int a=0; a < npe_1d; a++)
+             for(unsigned int b=0; b < npe_1d; b++)
+             {
+                const unsigned int rid = faceBase[f] + a*faceOuter[f] + b*faceInner[f];
+                w[a*npe_1d + b] = (owner[rid] == (1 + f)) ? in[rid] : 0.0;
+             }
+
+            const DendroScalar * Iouter = (cnumFace[f] & 2u) ? I1 : I0;
+            const DendroScalar * Iinner = (cnumFace[f] & 1u) ? I1 : I0;
+
+            DENDRO_TENSOR_IAX_APPLY_ELEM_2D(npe_1d,Iinner,w,im);
+            DENDRO_TENSOR_AIX_APPLY_ELEM_2D(npe_1d,Iouter,im,y);
+
+            for(unsigned int a=0; a < npe_1d; a++)
+             for(unsigned int b=0; b < npe_1d; b++)
+                out[faceBase[f] + a*faceOuter[f] + b*faceInner[f]] += y[a*npe_1d + b];
+
+        }
+
+        // hanging edges: out_edge += I^T in_edge
+        for(unsigned int e=0; e < NUM_EDGES; e++)
+        {
+            if(!edgeHang[e]) continue;
+
+            const DendroScalar * I1d = (cnumEdge[e]==0) ? I0 : I1;
+
+            for(unsigned int a=0; a < npe_1d; a++)
+            {
+                const unsigned int rid = edgeBase[e] + a*edgeStride[e];
+                w[a] = (owner[rid] == (1 + NUM_FACES + e)) ? in[rid] : 0.0;
+            }
+
+            for(unsigned int b=0; b < npe_1d; b++)
+            {
+                double s = 0.0;
+                for(unsigned int a=0; a < npe_1d; a++)
+                    s += I1d[a*npe_1d + b] * w[a];
+                
+                out[edgeBase[e] + b*edgeStride[e]] += s;
+            }
+
+        }
+
+        if(!isStack)
+        {
+            delete [] owner;
+            delete [] w;
+        }
+
+        return;
+
+    }
+
     void ot::Mesh::computeElementOwnerRanks(std::vector<unsigned int > & elementOwner)
     {
         // should not be called if the mesh is not active
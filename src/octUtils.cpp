@@ -662,11 +662,11 @@ void octree2BlockDecomposition(std::vector<ot::TreeNode>& pNodes, std::vector<ot
 
             for (int i = 0; i < NUM_CHILDREN; i++) {
                 childHasRegLev[i]=0;
-                hindex = (rotations[2 * NUM_CHILDREN * rot_id + i] - '0');
+                hindex = (SFC::ROT_PERM[rot_id][i]);
                 if (i == (NUM_CHILDREN-1))
                     hindexN = i + 1;
                 else
-                    hindexN = (rotations[2 * NUM_CHILDREN * rot_id + i + 1] - '0');
+                    hindexN = (SFC::ROT_PERM[rot_id][i + 1]);
                 assert(splitters[hindex] <= splitters[hindexN]);
 
                 for(unsigned int elem=splitters[hindex];elem<splitters[hindexN];elem++)
@@ -682,13 +682,13 @@ void octree2BlockDecomposition(std::vector<ot::TreeNode>& pNodes, std::vector<ot
 
             for(unsigned int i=0;i<(NUM_CHILDREN);i++)
             {
-                hindex = (rotations[2 * NUM_CHILDREN * rot_id + i] - '0');
+                hindex = (SFC::ROT_PERM[rot_id][i]);
                 if (i == (NUM_CHILDREN-1))
                     hindexN = i + 1;
                 else
-                    hindexN = (rotations[2 * NUM_CHILDREN * rot_id + i + 1] - '0');
+                    hindexN = (SFC::ROT_PERM[rot_id][i + 1]);
                 assert(splitters[hindex] <= splitters[hindexN]);
-                index = HILBERT_TABLE[NUM_CHILDREN * rot_id + hindex];
+                index = SFC::ROT_NEXT[rot_id][hindex];
 
 
                 x=parent.getX() +(((int)((bool)(hindex & 1u)))<<(pMaxDepthBit));
@@ -927,6 +927,38 @@ void mergeKeys(std::vector<ot::SearchKey>& sKeys,std::vector<ot::Key> & keys)
 }
 
 
+void mergeKeys(std::vector<ot::SearchKey>& sKeys,ot::KeyCSR& keys)
+{
+
+    if(sKeys.size()==0) return;
+
+    ot::SearchKey rootSkey(m_uiDim,m_uiMaxDepth);
+    std::vector<ot::SearchKey> tmpSKeys;
+    SFC::seqSort::SFC_treeSort(&(*(sKeys.begin())),sKeys.size(),tmpSKeys,tmpSKeys,tmpSKeys,m_uiMaxDepth,m_uiMaxDepth,rootSkey,ROOT_ROTATION,1,TS_SORT_ONLY);
+    assert(seq::test::isSorted(sKeys));
+
+    keys.reserve(keys.size()+sKeys.size(),sKeys.size());
+
+    unsigned int skip=0;
+    for(unsigned int e=0;e<(sKeys.size());e++)
+    {
+        keys.addKey(sKeys[e]);
+
+        skip=0;
+        while(((e+skip)<sKeys.size()) && (sKeys[e]==sKeys[e+skip]))
+        {
+            if(sKeys[e+skip].getOwner()>=0)
+                keys.addOwner(sKeys[e+skip].getOwner(),sKeys[e+skip].getStencilIndexDirectionList());
+            skip++;
+        }
+
+        e+=(skip-1);
+
+    }
+
+}
+
+
 void generateBlkEdgeSKeys(const ot::Block & blk, std::vector<ot::SearchKey>& sKeys)
 {
     const unsigned int domain_max = 1u<<(m_uiMaxDepth);
@@ -544,7 +544,7 @@ namespace ot
             ot::SearchKey root(ot::TreeNode(0,0,0,0,m_uiDim,m_uiMaxDepth));
             SFC::seqSort::SFC_treeSort(&(*(keys.begin())),keys.size(),tmp,tmp,tmp,m_uiMaxDepth,m_uiMaxDepth,root,ROOT_ROTATION,1,TS_SORT_ONLY);
 
-            std::vector<ot::Key> key_merged;
+            ot::KeyCSR key_merged;
             mergeKeys(keys,key_merged);
 
             std::vector<ot::Key> sEleKeys;
@@ -554,7 +554,7 @@ namespace ot
                 sEleKeys[p]=Key(sElements[2*p]);
             }
                 
-            SFC::seqSearch::SFC_treeSearch(&(*(sEleKeys.begin())),&(*(key_merged.begin())),0,sEleKeys.size(),0,key_merged.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
+            SFC::seqSearch::SFC_treeSearch(&(*(sEleKeys.begin())),key_merged.data(),0,sEleKeys.size(),0,key_merged.size(),m_uiMaxDepth,m_uiMaxDepth,ROOT_ROTATION);
             unsigned int sBegin=0;
             unsigned int sEnd;
 
@@ -568,9 +568,9 @@ namespace ot
                 
                 for(unsigned int k=sBegin;k<sEnd;k++)
                 {
-                    for (unsigned int w = 0; w < key_merged[k].getOwnerList()->size(); w++)
+                    for (unsigned int w = 0; w < key_merged.getOwnerListSize(k); w++)
                     {
-                        const unsigned kowner = (*(key_merged[k].getOwnerList()))[w];
+                        const unsigned kowner = key_merged.getOwnerList(k)[w];
                         if(kowner >= 0)
                         {
                             ownerranks[kowner] =p;
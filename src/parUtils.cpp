@@ -18,6 +18,34 @@
 
 namespace par {
 
+  /**@brief: deletes the NBX call counter attribute*/
+  static int nbxCounterDelete(MPI_Comm comm, int keyval, void* attr, void* extra_state)
+  {
+    delete (unsigned int*)attr;
+    return MPI_SUCCESS;
+  }
+
+  int nbxTag(MPI_Comm comm)
+  {
+    static int keyval = MPI_KEYVAL_INVALID;
+    if(keyval == MPI_KEYVAL_INVALID)
+      MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, nbxCounterDelete, &keyval, NULL);
+
+    unsigned int* counter;
+    int flag;
+    MPI_Comm_get_attr(comm, keyval, &counter, &flag);
+    if(!flag)
+    {
+      counter = new unsigned int(0);
+      MPI_Comm_set_attr(comm, keyval, counter);
+    }
+
+    const int tag = NBX_TAG + (int)((*counter) & 1u);
+    (*counter)++;
+    return tag;
+  }
+
+
   unsigned int splitCommBinary( MPI_Comm orig_comm, MPI_Comm *new_comm) {
     int npes, rank;
 
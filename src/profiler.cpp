@@ -23,11 +23,34 @@
         }
 
         void profiler_t::start() {
+            // inside parallel regions (e.g. concurrent block kernels) every thread keeps its own start time. 
+            if(omp_in_parallel())
+            {
+                const int tid = omp_get_thread_num();
+                if(tid < PROFILER_MAX_THREADS)
+                    _pri_thread_seconds[tid] = omp_get_wtime();
+                return;
+            }
+
             _pri_seconds = omp_get_wtime();
             flops_papi();
         }
 
         void profiler_t::stop() {
+            if(omp_in_parallel())
+            {
+                const int tid = omp_get_thread_num();
+                if(tid < PROFILER_MAX_THREADS)
+                {
+                    const long double t_elapsed = omp_get_wtime() - _pri_thread_seconds[tid];
+                    #pragma omp atomic
+                    seconds += t_elapsed;
+                    #pragma omp atomic
+                    snap += t_elapsed;
+                }
+                return;
+            }
+
             seconds -= _pri_seconds;
             p_flpops -= _pri_p_flpops;
             snap-=_pri_seconds;
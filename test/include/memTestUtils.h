@@ -0,0 +1,162 @@
+/**
+ * @file memTestUtils.h
+ * @brief Test utilities for the memory pool and the field sets.
+ * @version 0.1
+ *
+ * School of Computing, University of Utah.
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#pragma once
+#include <iostream>
+#include <vector>
+#include <stdint.h>
+#include <omp.h>
+#include "memory_pool.h"
+#include "fieldSet.h"
+
+namespace mem
+{
+    namespace test
+    {
+        /**
+         * @brief checks the size classes of the pool. Each request up to maxBytes gets an aligned block of its class size, which is at
+         * most 25% above the padded request (4 classes per power of 2). A freed block is reused by the next request of the same class.
+         * @param[in] pool : memory pool (no blocks should be handed out by other threads during the check)
+         * @param[in] maxBytes : largest request
+         */
+        bool isPoolClassRoundingValid(memory_pool& pool, size_t maxBytes);
+
+        /**
+         * @brief checks the reuse of the blocks across threads. Each thread allocates numBlocks blocks and fills them, the blocks are
+         * freed by the next thread. A second round of allocations should be served from the free lists (thread caches, or the shared
+         * lists if the cache cap is exceeded) without new allocations. The blocks handed out at the same time must not overlap.
+         * @param[in] pool : memory pool (no blocks should be handed out by other threads during the check)
+         * @param[in] numBlocks : number of blocks per thread
+         * @param[in] bytes : block size
+         */
+        bool isPoolThreadReuseValid(memory_pool& pool, unsigned int numBlocks, size_t bytes);
+
+        /**
+         * @brief checks the layout and the capacity reuse of a field set. The variables are aligned and do not overlap, allocate with
+         * the same size keeps the buffer and its content, smaller sizes and fewer variables reuse the buffer, and only a size above
+         * the capacity reallocates.
+         * @param[in] numVars : number of variables
+         * @param[in] szPerVar : number of entries per variable
+         */
+        template<typename T>
+        bool isFieldSetReuseValid(unsigned int numVars, size_t szPerVar);
+
+    }// end of namespace test
+
+}// end of namespace mem
+
+
+template<typename T>
+bool mem::test::isFieldSetReuseValid(unsigned int numVars, size_t szPerVar)
+{
+    bool state = true;
+    ot::FieldSet<T> fs;
+
+    // layout of the field set with v variables of sz entries.
+    auto isLayoutValid = [&fs](unsigned int v, size_t sz)
+    {
+        if(fs.get_num_vars() != v || fs.get_size_per_var() != sz || fs.get_stride() < sz || fs.get_stride()*v > fs.get_capacity())
+            return false;
+
+        if(((uintptr_t)fs[0]) % DENDRO_FIELD_SET_ALIGN != 0)
+            return false;
+
+        for(unsigned int k=0; k < v; k++)
+            if(fs.ptrs()[k] != fs[0] + k*fs.get_stride() || ((uintptr_t)fs[k]) % DENDRO_FIELD_ALIGN != 0)
+                return false;
+
+        return true;
+    };
+
+    auto fill = [&fs](unsigned int v, size_t sz)
+    {
+        for(unsigned int k=0; k < v; k++)
+            for(size_t n=0; n < sz; n++)
+                fs[k][n] = (T)(k*sz + n);
+    };
+
+    auto isFilled = [&fs](unsigned int v, size_t sz)
+    {
+        for(unsigned int k=0; k < v; k++)
+            for(size_t n=0; n < sz; n++)
+                if(fs[k][n] != (T)(k*sz + n))
+                    return false;
+        return true;
+    };
+
+    if(!fs.allocate(numVars, szPerVar) || !isLayoutValid(numVars, szPerVar))
+    {
+        std::cout<<"field set: invalid layout, vars: "<<numVars<<" size: "<<szPerVar<<" stride: "<<fs.get_stride()<<" capacity: "<<fs.get_capacity()<<std::endl;
+        return false;
+    }
+
+    fill(numVars, szPerVar);
+    T* const data = fs[0];
+    const size_t capacity = fs.get_capacity();
+
+    // same size, the content is preserved.
+    if(fs.allocate(numVars, szPerVar) || fs[0] != data || !isLayoutValid(numVars, szPerVar) || !isFilled(numVars, szPerVar))
+    {
+        std::cout<<"field set: allocate with the same size did not keep the buffer or its content"<<std::endl;
+        state = false;
+    }
+
+    // smaller sizes and fewer variables reuse the buffer.
+    const size_t szHalf = szPerVar/2 + 1;
+    const unsigned int vHalf = numVars/2 + 1;
+    if(fs.allocate(numVars, szHalf) || fs[0] != data || !isLayoutValid(numVars, szHalf) ||
+       fs.allocate(vHalf, szPerVar) || fs[0] != data || !isLayoutValid(vHalf, szPerVar) ||
+       fs.allocate(numVars, szPerVar) || fs[0] != data || !isLayoutValid(numVars, szPerVar) || fs.get_capacity() != capacity)
+    {
+        std::cout<<"field set: smaller allocation did not reuse the buffer"<<std::endl;
+        state = false;
+    }
+
+    // the capacity is exceeded only above the current capacity.
+    const size_t szCap = capacity/numVars - (DENDRO_FIELD_ALIGN/sizeof(T));
+    const size_t szBig = capacity/numVars + 1;
+    if(fs.allocate(numVars, szCap) || fs[0] != data || !isLayoutValid(numVars, szCap))
+    {
+        std::cout<<"field set: allocation of "<<szCap<<" per var. did not fit in the capacity "<<capacity<<std::endl;
+        state = false;
+    }
+
+    if(!fs.allocate(numVars, szBig) || !isLayoutValid(numVars, szBig) || fs.get_capacity() < numVars*szBig)
+    {
+        std::cout<<"field set: allocation of "<<szBig<<" per var. above the capacity "<<capacity<<" was not reallocated"<<std::endl;
+        state = false;
+    }
+
+    // moves keep the buffer.
+    fill(numVars, szBig);
+    T* const dataBig = fs[0];
+    ot::FieldSet<T> fs1(std::move(fs));
+    if(fs.get_capacity() != 0 || fs.ptrs() != NULL || fs1[0] != dataBig || fs1.get_num_vars() != numVars)
+    {
+        std::cout<<"field set: move did not transfer the buffer"<<std::endl;
+        state = false;
+    }
+
+    fs = std::move(fs1);
+    if(fs[0] != dataBig || !isFilled(numVars, szBig))
+    {
+        std::cout<<"field set: move assignment did not keep the content"<<std::endl;
+        state = false;
+    }
+
+    fs.release();
+    if(fs.get_capacity() != 0 || fs.get_num_vars() != 0)
+    {
+        std::cout<<"field set: release did not free the buffer"<<std::endl;
+        state = false;
+    }
+
+    return state;
+}
@@ -125,6 +125,18 @@ namespace par {
       template <typename T>
       bool  isComplete (const std::vector<T>& nodes, MPI_Comm comm);
 
+      /**
+       * @brief checks a multi-constraint partition (par::partitionWMC) against the brute force O(n npes nc) scan of all the splitter
+       * positions. For each proc k the imbalance of its splitter should be the minimum imbalance over all the positions.
+       * @param[in] nodes : partitioned vector
+       * @param[in] getConstraint : constraint id of an element (< numConstraints)
+       * @param[in] numConstraints : number of constraints
+       * @param[in] tol : relative tolerance of the imbalance
+       * @return true on all the procs if the partition is optimal
+       */
+      template <typename T>
+      bool isPartitionWMCOptimal(const std::vector<T>& nodes, unsigned int (*getConstraint)(const T *), unsigned int numConstraints, double tol, MPI_Comm comm);
+
 
   }//end namespace
 }//end namespace
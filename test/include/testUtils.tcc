@@ -14,6 +14,8 @@
 #include "seqUtils.h"
 #include <iostream>
 #include <stdint.h>
+#include <limits>
+#include <algorithm>
 
 namespace seq { 
   namespace test {
@@ -633,6 +635,83 @@ namespace test {
         }
 
 
+        template <typename T>
+        bool isPartitionWMCOptimal(const std::vector<T>& nodes, unsigned int (*getConstraint)(const T *), unsigned int numConstraints, double tol, MPI_Comm comm)
+        {
+          int rank,npes;
+          MPI_Comm_rank(comm, &rank);
+          MPI_Comm_size(comm,&npes);
+
+          const unsigned int nc = numConstraints;
+
+          // global constraint sequence and the splitter (global offset) of each proc.
+          std::vector<unsigned int> lCid(nodes.size());
+          for(unsigned int i=0; i < nodes.size(); i++)
+            lCid[i] = (*getConstraint)(&nodes[i]);
+
+          int lSz = nodes.size();
+          std::vector<int> counts(npes);
+          std::vector<int> offsets(npes);
+          par::Mpi_Allgather(&lSz, counts.data(), 1, comm);
+
+          offsets[0] = 0;
+          for(int k=1; k < npes; k++)
+            offsets[k] = offsets[k-1] + counts[k-1];
+
+          const DendroIntL n = offsets[npes-1] + counts[npes-1];
+          std::vector<unsigned int> cid(n);
+          par::Mpi_Allgatherv(lCid.data(), lSz, cid.data(), counts.data(), offsets.data(), comm);
+
+          std::vector<DendroIntL> gCount(nc,0);
+          for(DendroIntL i=0; i < n; i++)
+            gCount[cid[i]]++;
+
+          std::vector<double> share(nc);
+          for(unsigned int c=0; c < nc; c++)
+            share[c] = std::max(1.0, (double)gCount[c] / npes);
+
+          // imbalance of the splitter k at every position p, (prefix holds the counts of the elements before p).
+          std::vector<DendroIntL> prefix(nc);
+          std::vector<double> minCost(npes, std::numeric_limits<double>::max());
+          std::vector<double> splitCost(npes, 0.0);
+          for(int k=1; k < npes; k++)
+          {
+            std::fill(prefix.begin(), prefix.end(), 0);
+            for(DendroIntL p=0; p <= n; p++)
+            {
+              double cost = 0;
+              for(unsigned int c=0; c < nc; c++)
+              {
+                if(gCount[c] == 0)
+                  continue;
+                const double d = (prefix[c] - ((double)k * gCount[c]) / npes) / share[c];
+                cost += d * d;
+              }
+
+              minCost[k] = std::min(minCost[k], cost);
+              if(p == offsets[k])
+                splitCost[k] = cost;
+
+              if(p < n)
+                prefix[cid[p]]++;
+            }
+          }
+
+          bool state = true;
+          for(int k=1; k < npes; k++)
+          {
+            if(splitCost[k] > minCost[k] + tol * std::max(1.0, minCost[k]))
+            {
+              if(!rank)
+                std::cout<<"proc "<<k<<" splitter: "<<offsets[k]<<" imbalance: "<<splitCost[k]<<" min. imbalance: "<<minCost[k]<<std::endl;
+              state = false;
+            }
+          }
+
+          return state;
+        }
+
+
   }//end namespace
 }//end namespace
 
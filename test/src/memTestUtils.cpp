@@ -0,0 +1,138 @@
+/**
+ * @file memTestUtils.cpp
+ * @brief Test utilities for the memory pool and the field sets.
+ * @version 0.1
+ *
+ * School of Computing, University of Utah.
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include "memTestUtils.h"
+
+
+bool mem::test::isPoolClassRoundingValid(memory_pool& pool, size_t maxBytes)
+{
+    const size_t align = pool.get_alignment();
+    bool state = true;
+
+    for(size_t bytes=1; bytes <= maxBytes; bytes = (bytes < 4*align) ? bytes + 1 : bytes + bytes/7)
+    {
+        const unsigned long used0 = pool.used();
+        void* buf = pool.allocate(bytes);
+        const size_t csz = pool.used() - used0;
+        const size_t s = ((bytes + align - 1)/align)*align;
+
+        if(((uintptr_t)buf) % align != 0)
+        {
+            std::cout<<"mem_pool: request "<<bytes<<" block "<<buf<<" is not aligned to "<<align<<std::endl;
+            state = false;
+        }
+
+        if(csz < s || 4*(csz - s) >= s)
+        {
+            std::cout<<"mem_pool: request "<<bytes<<" (padded "<<s<<") class size "<<csz<<std::endl;
+            state = false;
+        }
+
+        // the class size request gets the same class, i.e. the block just freed.
+        pool.free(buf);
+        const unsigned long reserved0 = pool.get_stats().reserved;
+        void* buf1 = pool.allocate(csz);
+        if(buf1 != buf || pool.used() - used0 != csz || pool.get_stats().reserved != reserved0)
+        {
+            std::cout<<"mem_pool: request "<<csz<<" did not reuse the block of the request "<<bytes<<std::endl;
+            state = false;
+        }
+
+        pool.free(buf1);
+        if(pool.used() != used0)
+        {
+            std::cout<<"mem_pool: used "<<pool.used()<<" after free, expected "<<used0<<std::endl;
+            state = false;
+        }
+    }
+
+    return state;
+}
+
+bool mem::test::isPoolThreadReuseValid(memory_pool& pool, unsigned int numBlocks, size_t bytes)
+{
+    const unsigned long used0 = pool.used();
+    const size_t n = bytes/sizeof(unsigned long);
+    bool state = true;
+
+    std::vector<unsigned long*> blocks;
+    unsigned long reserved1 = 0;
+
+    for(unsigned int round=0; round < 2; round++)
+    {
+        pool.reset_stats();
+
+        #pragma omp parallel
+        {
+            const unsigned int nt  = omp_get_num_threads();
+            const unsigned int tid = omp_get_thread_num();
+
+            #pragma omp single
+            blocks.resize(nt*numBlocks);
+
+            for(unsigned int k=0; k < numBlocks; k++)
+            {
+                unsigned long* b = (unsigned long*)pool.allocate(bytes);
+                for(size_t i=0; i < n; i++)
+                    b[i] = tid*numBlocks + k;
+                blocks[tid*numBlocks + k] = b;
+            }
+
+            #pragma omp barrier
+
+            bool isValid = true;
+            for(unsigned int k=0; k < numBlocks; k++)
+                for(size_t i=0; i < n; i++)
+                    if(blocks[tid*numBlocks + k][i] != tid*numBlocks + k)
+                        isValid = false;
+
+            if(!isValid)
+            {
+                #pragma omp critical (mem_test_print)
+                {
+                    std::cout<<"mem_pool: thread "<<tid<<" blocks were overwritten (overlapping blocks)"<<std::endl;
+                    state = false;
+                }
+            }
+
+            #pragma omp barrier
+
+            // the blocks are freed by the next thread.
+            const unsigned int t1 = (tid + 1) % nt;
+            for(unsigned int k=0; k < numBlocks; k++)
+                pool.free(blocks[t1*numBlocks + k]);
+        }
+
+        const mem_pool_stats st = pool.get_stats();
+        if(pool.used() != used0 || st.allocs != blocks.size() || st.frees != blocks.size())
+        {
+            std::cout<<"mem_pool: round "<<round<<" used "<<pool.used()<<" (expected "<<used0<<") allocs "<<st.allocs<<" frees "<<st.frees<<" (expected "<<blocks.size()<<")"<<std::endl;
+            state = false;
+        }
+
+        // all the blocks of the second round are reused.
+        if(round == 0)
+            reserved1 = st.reserved;
+        else if(st.hits != st.allocs || st.reserved != reserved1)
+        {
+            std::cout<<"mem_pool: second round hits "<<st.hits<<" of "<<st.allocs<<" allocs, reserved "<<st.reserved<<" (expected "<<reserved1<<")"<<std::endl;
+            state = false;
+        }
+    }
+
+    pool.purge();
+    if(pool.get_stats().reserved != pool.used())
+    {
+        std::cout<<"mem_pool: reserved "<<pool.get_stats().reserved<<" after purge, used "<<pool.used()<<std::endl;
+        state = false;
+    }
+
+    return state;
+}